@@ -0,0 +1,395 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**@file*/
+
+// This is a templated file.
+// Do not include a copyright header function.
+
+// This file is meant to be #included in another .c file
+// Do not define VBX_TEMPLATE_T locally in this file.
+// Only define it externally in the file that includes
+// this file.
+
+// Protect this file from inclusion if VBX_TEMPLATE_T is not properly defined.
+#ifdef VBX_TEMPLATE_T
+#if (VBX_TEMPLATE_T==VBX_BYTESIZE_DEF  || \
+		VBX_TEMPLATE_T==VBX_HALFSIZE_DEF  || \
+		VBX_TEMPLATE_T==VBX_WORDSIZE_DEF  || \
+		VBX_TEMPLATE_T==VBX_UBYTESIZE_DEF || \
+		VBX_TEMPLATE_T==VBX_UHALFSIZE_DEF || \
+		VBX_TEMPLATE_T==VBX_UWORDSIZE_DEF )
+
+#include "vbw_mtx_conv_t.h"
+#include "vbw_stream.h"
+
+// Parts that do not depend on the data type
+#ifndef __VBW_MTX_CONV_T_C
+#define __VBW_MTX_CONV_T_C
+
+typedef struct {
+	const int32_t *row_coeffs; // taps along each row: the whole kernel, or the row pass of a separable one
+	const int32_t *col_coeffs; // taps down each column of a separable kernel; NULL for a general kernel
+	vbx_void_t    *v_coeffs;   // row_coeffs as words in the scratchpad for the accumulate form; NULL for the multiply and add form
+	int kernel_rows;
+	int kernel_cols;
+	int shift;
+	int saturate;
+} vbw_conv_arg_t;
+
+static int vbw_conv_waves(const int n, const int lanes)
+{
+	return (n + lanes-1)/lanes;
+}
+
+// True if a row of taps costs fewer cycles per output as one accumulating
+// 2D row per output than as one multiply and one add over the tile per tap.
+// Both forms read their sources at an offset from the destination, which
+// costs one more wave per accumulating row but is spread over the whole
+// tile by the multiply and add.
+static int vbw_conv_use_acc(const int num_taps, const int lanes)
+{
+	return (vbw_conv_waves(num_taps, lanes)+1)*lanes < 2*num_taps;
+}
+
+#endif // __VBW_MTX_CONV_T_C
+
+// Accumulators are signed words, so that negative sums saturate to 0 in an
+// unsigned range; unsigned words are accumulated unsigned
+#undef VBW_CONV_VV
+#undef VBW_CONV_SV
+#undef vbw_conv_acc_t
+#if VBX_TEMPLATE_T == VBX_UWORDSIZE_DEF
+#define VBW_CONV_VV VVWU
+#define VBW_CONV_SV SVWU
+#define vbw_conv_acc_t vbx_uword_t
+#else
+#define VBW_CONV_VV VVW
+#define VBW_CONV_SV SVW
+#define vbw_conv_acc_t vbx_word_t
+#endif
+
+// Words of the data type's signedness, as widened and narrowed by TW and WT modes
+#undef vbw_conv_tw_t
+#if (VBX_TEMPLATE_T==VBX_BYTESIZE_DEF || VBX_TEMPLATE_T==VBX_HALFSIZE_DEF || VBX_TEMPLATE_T==VBX_WORDSIZE_DEF)
+#define vbw_conv_tw_t vbx_word_t
+#else
+#define vbw_conv_tw_t vbx_uword_t
+#endif
+
+// Range of the data type, for saturation; words have nothing to saturate
+#undef VBW_CONV_MIN
+#undef VBW_CONV_MAX
+#if VBX_TEMPLATE_T == VBX_BYTESIZE_DEF
+#define VBW_CONV_MIN -128
+#define VBW_CONV_MAX  127
+#elif VBX_TEMPLATE_T == VBX_HALFSIZE_DEF
+#define VBW_CONV_MIN -32768
+#define VBW_CONV_MAX  32767
+#elif VBX_TEMPLATE_T == VBX_UBYTESIZE_DEF
+#define VBW_CONV_MIN  0
+#define VBW_CONV_MAX  255
+#elif VBX_TEMPLATE_T == VBX_UHALFSIZE_DEF
+#define VBW_CONV_MIN  0
+#define VBW_CONV_MAX  65535
+#endif
+
+/// Adds one row of taps over n results: v_acc[j] (+)= sum of taps[c]*v_src[j+c]
+/// With v_wide, the words of v_src, each result is one accumulating 2D row
+/// against v_taps; otherwise each nonzero tap is a multiply and an add over
+/// all results. Trashes v_mult, n words.
+static void VBX_T(vbw_conv_taps)(vbw_conv_acc_t *v_acc, vbx_sp_t *v_src, vbw_conv_acc_t *v_wide, vbw_conv_acc_t *v_taps,
+                                 const int32_t *taps, const int num_taps, const int n, int first, vbw_conv_acc_t *v_mult)
+{
+	int c;
+
+	if (v_wide) {
+		vbx_set_vl(num_taps);
+		vbx_set_2D(n, sizeof(vbw_conv_acc_t), sizeof(vbw_conv_acc_t), 0);
+		vbx_acc_2D(VBW_CONV_VV, VMUL, first ? v_acc : v_mult, v_wide, v_taps);
+		if (!first) {
+			vbx_set_vl(n);
+			vbx(VBW_CONV_VV, VADD, v_acc, v_acc, v_mult);
+		}
+		return;
+	}
+
+	vbx_set_vl(n);
+	for (c = 0; c < num_taps; c++) {
+		if (!taps[c]) {
+			continue;
+		}
+		if (first) {
+			vbx(SV(TW), VMULLO, (vbw_conv_tw_t *)v_acc, taps[c], v_src+c);
+			first = 0;
+		} else {
+			vbx(SV(TW), VMULLO, (vbw_conv_tw_t *)v_mult, taps[c], v_src+c);
+			vbx(VBW_CONV_VV, VADD, v_acc, v_acc, v_mult);
+		}
+	}
+	if (first) {
+		vbx(VBW_CONV_SV, VMOV, v_acc, 0, 0);
+	}
+}
+
+/// Rounds, shifts and saturates the sums of a tile, whose rows are pitch
+/// apart, and writes them to the output rows. Trashes v_temp.
+static void VBX_T(vbw_conv_output)(vbx_sp_t *v_out, vbw_conv_acc_t *v_acc, vbw_conv_acc_t *v_temp,
+                                   const int rows, const int width, const int pitch, const int shift, const int saturate)
+{
+	vbx_set_vl((rows-1)*pitch + width);
+	if (shift > 0) {
+		vbx(VBW_CONV_SV, VADD, v_acc, 1 << (shift-1), v_acc);
+		vbx(VBW_CONV_SV, VSHR, v_acc, shift, v_acc);
+	}
+#ifdef VBW_CONV_MAX
+	if (saturate) {
+		vbx(SVW, VSUB,     v_temp, VBW_CONV_MAX, v_acc);
+		vbx(SVW, VCMV_LTZ, v_acc,  VBW_CONV_MAX, v_temp);
+		vbx(SVW, VSUB,     v_temp, VBW_CONV_MIN, v_acc);
+		vbx(SVW, VCMV_GTZ, v_acc,  VBW_CONV_MIN, v_temp);
+	}
+#endif
+
+	// Narrow into the output rows, dropping the columns that fall in the halo
+	vbx_set_vl(width);
+	vbx_set_2D(rows, width*sizeof(vbx_sp_t), pitch*sizeof(vbw_conv_acc_t), 0);
+	vbx_2D(VV(WT), VMOV, v_out, (vbw_conv_tw_t *)v_acc, 0);
+}
+
+// The tile is processed as one vector; each result j = y*pitch+x is the
+// pixel at row y, column x, and the columns past width are not meaningful
+static void VBX_T(vbw_conv_chunk)(const vbw_stream_chunk_t *chunk, void *arg)
+{
+	const vbw_conv_arg_t *conv = (const vbw_conv_arg_t *)arg;
+	const int kr    = conv->kernel_rows;
+	const int kc    = conv->kernel_cols;
+	const int pitch = chunk->in_pitch[0];
+	const int n_in  = (chunk->rows + kr-1)*pitch;
+	const int n     = (chunk->rows-1)*pitch + chunk->row_len;
+	vbx_sp_t   *v_top  = (vbx_sp_t *)chunk->v_in[0] - ((kr-1)/2)*pitch - (kc-1)/2;
+	vbw_conv_acc_t *v_acc  = (vbw_conv_acc_t *)chunk->v_temp;
+	vbw_conv_acc_t *v_mult = v_acc + n_in;
+	vbw_conv_acc_t *v_wide = NULL;
+	int r;
+
+	if (conv->v_coeffs) {
+#if (VBX_TEMPLATE_T==VBX_WORDSIZE_DEF || VBX_TEMPLATE_T==VBX_UWORDSIZE_DEF)
+		v_wide = (vbw_conv_acc_t *)v_top;
+#else
+		v_wide = v_mult + n_in;
+		vbx_set_vl(n_in);
+		vbx(VV(TW), VMOV, (vbw_conv_tw_t *)v_wide, v_top, 0);
+#endif
+	}
+
+	for (r = 0; r < kr; r++) {
+		VBX_T(vbw_conv_taps)(v_acc, v_top + r*pitch, v_wide ? v_wide + r*pitch : NULL,
+		                     v_wide ? (vbw_conv_acc_t *)conv->v_coeffs + r*kc : NULL, conv->row_coeffs + r*kc, kc, n, !r, v_mult);
+	}
+	VBX_T(vbw_conv_output)((vbx_sp_t *)chunk->v_out[0], v_acc, v_mult,
+	                       chunk->rows, chunk->row_len, pitch, conv->shift, conv->saturate);
+}
+
+// A row pass over all rows of the tile, then a column pass over its results
+static void VBX_T(vbw_conv_sep_chunk)(const vbw_stream_chunk_t *chunk, void *arg)
+{
+	const vbw_conv_arg_t *conv = (const vbw_conv_arg_t *)arg;
+	const int kr    = conv->kernel_rows;
+	const int kc    = conv->kernel_cols;
+	const int pitch = chunk->in_pitch[0];
+	const int n_in  = (chunk->rows + kr-1)*pitch;
+	const int m     = n_in - (kc-1);
+	const int n     = (chunk->rows-1)*pitch + chunk->row_len;
+	vbx_sp_t   *v_top  = (vbx_sp_t *)chunk->v_in[0] - ((kr-1)/2)*pitch - (kc-1)/2;
+	vbw_conv_acc_t *v_rows = (vbw_conv_acc_t *)chunk->v_temp;
+	vbw_conv_acc_t *v_acc  = v_rows + n_in;
+	vbw_conv_acc_t *v_mult = v_acc + n_in;
+	vbw_conv_acc_t *v_wide = NULL;
+	int r, first = 1;
+
+	if (conv->v_coeffs) {
+#if (VBX_TEMPLATE_T==VBX_WORDSIZE_DEF || VBX_TEMPLATE_T==VBX_UWORDSIZE_DEF)
+		v_wide = (vbw_conv_acc_t *)v_top;
+#else
+		v_wide = v_mult + n_in;
+		vbx_set_vl(n_in);
+		vbx(VV(TW), VMOV, (vbw_conv_tw_t *)v_wide, v_top, 0);
+#endif
+	}
+	VBX_T(vbw_conv_taps)(v_rows, v_top, v_wide, (vbw_conv_acc_t *)conv->v_coeffs, conv->row_coeffs, kc, m, 1, v_mult);
+
+	// Column taps are pitch apart, so they are always a multiply and add
+	vbx_set_vl(n);
+	for (r = 0; r < kr; r++) {
+		if (!conv->col_coeffs[r]) {
+			continue;
+		}
+		if (first) {
+			vbx(VBW_CONV_SV, VMULLO, v_acc, conv->col_coeffs[r], v_rows + r*pitch);
+			first = 0;
+		} else {
+			vbx(VBW_CONV_SV, VMULLO, v_mult, conv->col_coeffs[r], v_rows + r*pitch);
+			vbx(VBW_CONV_VV, VADD, v_acc, v_acc, v_mult);
+		}
+	}
+	if (first) {
+		vbx(VBW_CONV_SV, VMOV, v_acc, 0, 0);
+	}
+	VBX_T(vbw_conv_output)((vbx_sp_t *)chunk->v_out[0], v_acc, v_mult,
+	                       chunk->rows, chunk->row_len, pitch, conv->shift, conv->saturate);
+}
+
+// Streams the pixels whose kernel fits inside the image, then zeroes the border
+static int VBX_T(vbw_conv_run)(vbx_mm_t *output, vbx_mm_t *input, vbw_conv_arg_t *conv,
+                               const int image_width, const int image_height, const int image_pitch)
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	const int kr     = conv->kernel_rows;
+	const int kc     = conv->kernel_cols;
+	const int top    = (kr-1)/2;
+	const int left   = (kc-1)/2;
+	const int rows   = image_height - (kr-1);
+	const int cols   = image_width  - (kc-1);
+	const int num_coeffs = conv->col_coeffs ? kc : kr*kc;
+	int temp_words = conv->col_coeffs ? 3 : 2;
+	int i, status = 0;
+
+	if (kr < 1 || kc < 1 || kr > VBW_CONV_MAX_TAPS || kc > VBW_CONV_MAX_TAPS || conv->shift < 0 || conv->shift > 31) {
+		return -1;
+	}
+
+	vbx_sp_push();
+	conv->v_coeffs = NULL;
+	if (rows > 0 && cols > 0 && vbw_conv_use_acc(kc, this_mxp->vector_lanes)) {
+		conv->v_coeffs = vbx_sp_malloc(num_coeffs*sizeof(vbx_word_t));
+		if (!conv->v_coeffs) {
+			vbx_sp_pop();
+			printf("Out of scratchpad memory\n");
+			return -1;
+		}
+		vbx_set_vl(1);
+		for (i = 0; i < num_coeffs; i++) {
+			vbx(SVW, VMOV, (vbx_word_t *)conv->v_coeffs + i, conv->row_coeffs[i], 0);
+		}
+#if !(VBX_TEMPLATE_T==VBX_WORDSIZE_DEF || VBX_TEMPLATE_T==VBX_UWORDSIZE_DEF)
+		temp_words++; // words of the input tile
+#endif
+	}
+
+	if (rows > 0 && cols > 0) {
+		vbw_stream_t in  = { input  + top*image_pitch + left, sizeof(vbx_sp_t), image_pitch, top, kr-1-top, left, kc-1-left };
+		vbw_stream_t out = { output + top*image_pitch + left, sizeof(vbx_sp_t), image_pitch, 0, 0 };
+		status = vbw_stream_tiled(&in, 1, &out, 1, rows, cols, temp_words*sizeof(vbx_word_t),
+		                          conv->col_coeffs ? VBX_T(vbw_conv_sep_chunk) : VBX_T(vbw_conv_chunk), conv);
+	}
+	vbx_sp_pop();
+
+	if (status || vbw_stream_zero_border(output, sizeof(vbx_sp_t), image_pitch, image_width, image_height,
+	                                     top, kr-1-top, left, kc-1-left)) {
+		printf("Out of scratchpad memory\n");
+		return -1;
+	}
+	return 0;
+}
+
+/** 2D convolution with a general kernel.
+ *
+ * @brief NxM convolution of an image with runtime kernel size, shift and saturation
+ *
+ * Each output pixel is the sum of the kernel_rows x kernel_cols input
+ * pixels around it, each multiplied by its coefficient, rounded and
+ * shifted right by @a shift. The kernel is centred on the pixel, or one
+ * above and left of centre for an even size, and is not flipped. The sums
+ * are 32-bit. Each row of the kernel is either one accumulating 2D
+ * instruction over the tile, when kernel_cols is long for the vector
+ * lanes, or a multiply and an add per nonzero coefficient. The image is
+ * processed in tiles, so it may be any width, and the output may
+ * overwrite the input. The output pixels the kernel does not fit around
+ * are 0.
+ *
+ * @param[out] output      output image
+ * @param[in] input        input image
+ * @param[in] coeffs       kernel_rows rows of kernel_cols coefficients
+ * @param[in] kernel_rows  kernel height, 1 to @ref VBW_CONV_MAX_TAPS
+ * @param[in] kernel_cols  kernel width, 1 to @ref VBW_CONV_MAX_TAPS
+ * @param[in] image_width  input/output image width
+ * @param[in] image_height input/output image height
+ * @param[in] image_pitch  input/output image pitch
+ * @param[in] shift        fraction bits of the coefficients, 0 to 31
+ * @param[in] saturate     clamp results to the range of the data type rather than keep their low bits; words always keep their low bits
+ * @retval 0 if successful; -1 if the kernel is too large or out of scratchpad memory
+ */
+int VBX_T(vbw_mtx_conv)(vbx_mm_t *output, vbx_mm_t *input, const int32_t *coeffs, const int kernel_rows, const int kernel_cols,
+                        const int image_width, const int image_height, const int image_pitch, const int shift, const int saturate)
+{
+	vbw_conv_arg_t conv = { coeffs, NULL, NULL, kernel_rows, kernel_cols, shift, saturate };
+	return VBX_T(vbw_conv_run)(output, input, &conv, image_width, image_height, image_pitch);
+}
+
+/** 2D convolution with a separable kernel.
+ *
+ * @brief NxM convolution with a kernel that is the product of a column and a row
+ *
+ * As @ref vbw_mtx_conv_byte with the kernel col_coeffs[r]*row_coeffs[c],
+ * in a row pass and a column pass: kernel_rows+kernel_cols multiplies per
+ * pixel rather than kernel_rows*kernel_cols. The row pass keeps full 32-bit
+ * sums, and the shift applies once to the result of the column pass.
+ *
+ * @param[out] output      output image
+ * @param[in] input        input image
+ * @param[in] row_coeffs   kernel_cols coefficients along each row
+ * @param[in] col_coeffs   kernel_rows coefficients down each column
+ * @param[in] kernel_rows  kernel height, 1 to @ref VBW_CONV_MAX_TAPS
+ * @param[in] kernel_cols  kernel width, 1 to @ref VBW_CONV_MAX_TAPS
+ * @param[in] image_width  input/output image width
+ * @param[in] image_height input/output image height
+ * @param[in] image_pitch  input/output image pitch
+ * @param[in] shift        fraction bits of the product of the two passes, 0 to 31
+ * @param[in] saturate     clamp results to the range of the data type rather than keep their low bits; words always keep their low bits
+ * @retval 0 if successful; -1 if the kernel is too large or out of scratchpad memory
+ */
+int VBX_T(vbw_mtx_conv_sep)(vbx_mm_t *output, vbx_mm_t *input, const int32_t *row_coeffs, const int32_t *col_coeffs,
+                            const int kernel_rows, const int kernel_cols,
+                            const int image_width, const int image_height, const int image_pitch, const int shift, const int saturate)
+{
+	vbw_conv_arg_t conv = { row_coeffs, col_coeffs, NULL, kernel_rows, kernel_cols, shift, saturate };
+	return VBX_T(vbw_conv_run)(output, input, &conv, image_width, image_height, image_pitch);
+}
+
+#endif // properly defined VBX_TEMPLATE_T
+#endif // defined(VBX_TEMPLATE_T)
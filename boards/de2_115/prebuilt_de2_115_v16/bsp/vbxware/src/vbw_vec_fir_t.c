@@ -55,17 +55,53 @@
 		VBX_TEMPLATE_T==VBX_UWORDSIZE_DEF )
 
 #include "vbw_vec_fir_t.h"
+#include "vbw_stream.h"
 
+// Parts that do not depend on the data type
+#ifndef __VBW_VEC_FIR_T_C
+#define __VBW_VEC_FIR_T_C
 
-/** 1D Fir Filter.
+typedef struct {
+	const void *coeffs;   // taps in host memory, for the transposed form
+	vbx_void_t *v_coeffs; // taps in the scratchpad, for the accumulate form; NULL if it is not used
+	int num_taps;
+	int num_channels;
+} vbw_fir_arg_t;
+
+static int vbw_fir_waves(const int n, const int per_wave)
+{
+	return (n + per_wave-1)/per_wave;
+}
+
+// True if a chunk of outputs costs fewer cycles as one accumulating 2D row
+// per output than as one multiply and one add over the chunk per tap. The
+// accumulate form wins for long filters on few lanes, and for chunks so
+// short that each multiply and add only fills a few waves. Both forms read
+// their sources at an offset from the destination, costing one more wave
+// per accumulating row, or per instruction of the transposed form.
+static int vbw_fir_use_acc(const int num_taps, const int outputs, const int elem_size)
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	const int per_wave = this_mxp->vector_lanes*sizeof(vbx_word_t)/elem_size;
+	return outputs*(vbw_fir_waves(num_taps, per_wave)+1) < 2*num_taps*(vbw_fir_waves(outputs, per_wave)+1);
+}
+
+#endif // __VBW_VEC_FIR_T_C
+
+
+/** 1D Fir Filter, with the taps already in the scratchpad.
+ *  Saves reloading the taps on every call, e.g. with taps from
+ *  @ref vbx_sp_cache_get or @ref vbx_sp_heap_malloc. The caller keeps
+ *  v_coeffs up to date: after changing the host taps, call
+ *  @ref vbx_sp_cache_invalidate before getting them again.
  *
  *  @param[in] input.
  *  @param[out] output.
- *  @param[in] coeffs.
+ *  @param[in] v_coeffs.
  *  @param[in] sample_size.
  *  @param[in] num_taps.
  */
-void VBX_T(vbw_vec_fir_1d)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs, const int sample_size, const int num_taps)
+void VBX_T(vbw_vec_fir_1d_sp)(vbx_mm_t *output, vbx_mm_t *input, vbx_sp_t *v_coeffs, const int sample_size, const int num_taps)
 {
 
 	int chunk_size_old, chunk_size, chunk_size_new, chunk_start_old, chunk_start, chunk_start_new;
@@ -73,19 +109,20 @@ void VBX_T(vbw_vec_fir_1d)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs,
 
 	vbx_set_vl(num_taps);
 
-	vbx_mm_t *coeffs_shared = vbx_shared_malloc( num_taps*sizeof(vbx_mm_t) );
-	for( j = 0; j < num_taps; j++ ) {
-		coeffs_shared[j] = coeffs[j];
-	}
-
 	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
-	const int VBX_WIDTH_BYTES = this_mxp->vector_lanes * sizeof(int);
+	const int VBX_SP_ALIGN = this_mxp->scratchpad_alignment_bytes;
 	const int align = this_mxp->dma_alignment_bytes;
 
-	chunk_size_old = (this_mxp->scratchpad_size-(5*num_taps*sizeof(vbx_mm_t)))/(2*sizeof(vbx_mm_t)+2*sizeof(vbx_mm_t));
-	chunk_size_old = VBX_PAD_UP(chunk_size_old-2*VBX_WIDTH_BYTES+1, align);
+	// four buffers of a chunk and the num_taps samples after it
+	chunk_size_old = (vbx_sp_getfree()-4*VBX_SP_ALIGN-4*num_taps*(int)sizeof(vbx_sp_t))/(4*(int)sizeof(vbx_sp_t));
+	chunk_size_old = VBX_PAD_DN(chunk_size_old, align);
 
-	vbx_sp_t *v_coeffs = (vbx_sp_t *)vbx_sp_malloc(num_taps*sizeof(vbx_sp_t));
+	if( chunk_size_old <= 0 ) {
+		printf("Failed malloc!\n");
+		VBX_EXIT(0xBADDEAD);
+	}
+
+	vbx_sp_push();
 	vbx_sp_t *v_sample_a = (vbx_sp_t *)vbx_sp_malloc((chunk_size_old+num_taps)*sizeof(vbx_sp_t));
 	vbx_sp_t *v_sample_b = (vbx_sp_t *)vbx_sp_malloc((chunk_size_old+num_taps)*sizeof(vbx_sp_t));
 	vbx_sp_t *v_output_a = (vbx_sp_t *)vbx_sp_malloc((chunk_size_old+num_taps)*sizeof(vbx_sp_t));
@@ -98,8 +135,6 @@ void VBX_T(vbw_vec_fir_1d)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs,
 		VBX_EXIT(0xBADDEAD);
 	}
 
-	vbx_dma_to_vector(v_coeffs, coeffs_shared, num_taps*sizeof(vbx_sp_t));
-
 	v_sample_to_vpu = v_sample_a;
 	v_sample_on_vpu = v_sample_b;
 	v_output_to_host = v_output_a;
@@ -149,39 +184,67 @@ void VBX_T(vbw_vec_fir_1d)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs,
 		chunk_start     = chunk_start_new;
 	}
 
-	vbx_sp_free();
+	vbx_sp_pop();
 	vbx_sync();
 }
 
-/** 2D Fir Filter.
+/** 1D Fir Filter.
  *
  *  @param[in] input.
  *  @param[out] output.
- *  @param[in] coeffs.
+ *  @param[in] coeffs -- copied to the scratchpad on every call.
  *  @param[in] sample_size.
  *  @param[in] num_taps.
  */
-void VBX_T(vbw_vec_fir_2d)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs, const int sample_size, const int num_taps)
+void VBX_T(vbw_vec_fir_1d)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs, const int sample_size, const int num_taps)
+{
+	vbx_sp_push();
+	vbx_sp_t *v_coeffs = (vbx_sp_t *)vbx_sp_malloc(num_taps*sizeof(vbx_sp_t));
+
+	if( v_coeffs == NULL ) {
+		printf("Failed malloc!\n");
+		VBX_EXIT(0xBADDEAD);
+	}
+
+	vbx_dcache_flush(coeffs, num_taps*sizeof(vbx_sp_t));
+	vbx_dma_to_vector(v_coeffs, coeffs, num_taps*sizeof(vbx_sp_t));
+	VBX_T(vbw_vec_fir_1d_sp)(output, input, v_coeffs, sample_size, num_taps);
+	vbx_sp_pop();
+}
+
+/** 2D Fir Filter, with the taps already in the scratchpad.
+ *  Saves reloading the taps on every call, e.g. with taps from
+ *  @ref vbx_sp_cache_get or @ref vbx_sp_heap_malloc. The caller keeps
+ *  v_coeffs up to date: after changing the host taps, call
+ *  @ref vbx_sp_cache_invalidate before getting them again.
+ *
+ *  @param[in] input.
+ *  @param[out] output.
+ *  @param[in] v_coeffs.
+ *  @param[in] sample_size.
+ *  @param[in] num_taps.
+ */
+void VBX_T(vbw_vec_fir_2d_sp)(vbx_mm_t *output, vbx_mm_t *input, vbx_sp_t *v_coeffs, const int sample_size, const int num_taps)
 {
 
 	int chunk_size_old,chunk_size,chunk_size_new,chunk_start_old,chunk_start,chunk_start_new;
-	int j;
 
 	vbx_set_vl(num_taps);
 
-	vbx_mm_t *coeffs_shared = vbx_shared_malloc(num_taps*sizeof(vbx_sp_t));
-	for( j = 0; j < num_taps; j++ ) {
-		coeffs_shared[j] = coeffs[j];
-	}
-
 	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
-	const int VBX_WIDTH_BYTES = this_mxp->vector_lanes * sizeof(int);
+	const int VBX_SP_ALIGN = this_mxp->scratchpad_alignment_bytes;
 	const int align = this_mxp->dma_alignment_bytes;
 
-	chunk_size_old = (this_mxp->scratchpad_size-(2*(sizeof(vbx_uword_t)-sizeof(vbx_sp_t)))-(5*num_taps*sizeof(vbx_sp_t)))/(2*sizeof(vbx_sp_t)+2*sizeof(vbx_sp_t));
-	chunk_size_old = VBX_PAD_UP(chunk_size_old-2*VBX_WIDTH_BYTES+1, align);
+	// four buffers of a chunk and the num_taps samples after it, the outputs padded to a word
+	chunk_size_old = (vbx_sp_getfree()-4*VBX_SP_ALIGN-2*(int)(sizeof(vbx_uword_t)-sizeof(vbx_sp_t))-4*num_taps*(int)sizeof(vbx_sp_t))/(4*(int)sizeof(vbx_sp_t));
+	chunk_size_old = VBX_PAD_DN(chunk_size_old, align);
 
-	vbx_sp_t *v_coeffs = (vbx_sp_t *)vbx_sp_malloc(num_taps*sizeof(vbx_sp_t));
+	if( chunk_size_old <= 0 ) {
+		printf("Failed malloc!\n");
+		VBX_EXIT(0xBADDEAD);
+	}
+
+	vbx_sp_push();
 	vbx_sp_t *v_sample_a = (vbx_sp_t *)vbx_sp_malloc((chunk_size_old+num_taps)*sizeof(vbx_sp_t));
 	vbx_sp_t *v_sample_b = (vbx_sp_t *)vbx_sp_malloc((chunk_size_old+num_taps)*sizeof(vbx_sp_t));
 	vbx_sp_t *output_a = (vbx_sp_t *)vbx_sp_malloc((chunk_size_old+num_taps)*sizeof(vbx_sp_t)+(sizeof(vbx_uword_t)-sizeof(vbx_sp_t)));
@@ -194,8 +257,6 @@ void VBX_T(vbw_vec_fir_2d)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs,
 		VBX_EXIT(0xBADDEAD);
 	}
 
-	vbx_dma_to_vector(v_coeffs, coeffs_shared, num_taps*sizeof(vbx_sp_t));
-
 	v_sample_to_vpu = v_sample_a;
 	v_sample_on_vpu = v_sample_b;
 	v_output_to_host = output_a;
@@ -244,10 +305,34 @@ void VBX_T(vbw_vec_fir_2d)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs,
 		chunk_start     = chunk_start_new;
 	}
 
-	vbx_sp_free();
+	vbx_sp_pop();
 	vbx_sync();
 }
 
+/** 2D Fir Filter.
+ *
+ *  @param[in] input.
+ *  @param[out] output.
+ *  @param[in] coeffs -- copied to the scratchpad on every call.
+ *  @param[in] sample_size.
+ *  @param[in] num_taps.
+ */
+void VBX_T(vbw_vec_fir_2d)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs, const int sample_size, const int num_taps)
+{
+	vbx_sp_push();
+	vbx_sp_t *v_coeffs = (vbx_sp_t *)vbx_sp_malloc(num_taps*sizeof(vbx_sp_t));
+
+	if( v_coeffs == NULL ) {
+		printf("Failed malloc!\n");
+		VBX_EXIT(0xBADDEAD);
+	}
+
+	vbx_dcache_flush(coeffs, num_taps*sizeof(vbx_sp_t));
+	vbx_dma_to_vector(v_coeffs, coeffs, num_taps*sizeof(vbx_sp_t));
+	VBX_T(vbw_vec_fir_2d_sp)(output, input, v_coeffs, sample_size, num_taps);
+	vbx_sp_pop();
+}
+
 
 /** VBX 1D Transposed Fir Filter.
  * Uses the vbx length to scan over the
@@ -366,5 +451,111 @@ void VBX_T(vbw_vec_fir_transpose)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *c
 	vbx_sync();
 }
 
+// Filters a chunk of frames, whose taps follow it in the scratchpad
+static void VBX_T(vbw_fir_chunk)(const vbw_stream_chunk_t *chunk, void *arg)
+{
+	const vbw_fir_arg_t *fir = (const vbw_fir_arg_t *)arg;
+	const vbx_mm_t *coeffs = (const vbx_mm_t *)fir->coeffs;
+	const int n = chunk->rows*chunk->row_len;
+	vbx_sp_t *v_in  = (vbx_sp_t *)chunk->v_in[0];
+	vbx_sp_t *v_out = (vbx_sp_t *)chunk->v_out[0];
+	vbx_sp_t *v_mult = (vbx_sp_t *)chunk->v_temp;
+	int j, first = 1;
+
+	if (fir->v_coeffs && vbw_fir_use_acc(fir->num_taps, n, sizeof(vbx_sp_t))) {
+		vbx_set_vl(fir->num_taps);
+		vbx_set_2D(n, sizeof(vbx_sp_t), 0, sizeof(vbx_sp_t));
+		vbx_acc_2D(VV(T), VMULLO, v_out, (vbx_sp_t *)fir->v_coeffs, v_in);
+		return;
+	}
+
+	// Tap j of every channel is num_channels elements further on
+	vbx_set_vl(n);
+	for (j = 0; j < fir->num_taps; j++) {
+		if (!coeffs[j]) {
+			continue;
+		}
+		if (first) {
+			vbx(SV(T), VMULLO, v_out, coeffs[j], v_in + j*fir->num_channels);
+			first = 0;
+		} else {
+			vbx(SV(T), VMULLO, v_mult, coeffs[j], v_in + j*fir->num_channels);
+			vbx(VV(T), VADD, v_out, v_out, v_mult);
+		}
+	}
+	if (first) {
+		vbx(SV(T), VMOV, v_out, 0, 0);
+	}
+}
+
+/** FIR filter that picks its form per chunk, with the taps also in the scratchpad.
+ *  As @ref vbw_vec_fir_byte, but takes a scratchpad copy of the taps from
+ *  the caller instead of copying them on every call, e.g. from
+ *  @ref vbx_sp_cache_get or @ref vbx_sp_heap_malloc. The two copies must
+ *  hold the same taps: after changing coeffs, call @ref vbx_sp_cache_invalidate
+ *  before getting them again.
+ *
+ *  @param[out] output -- sample_size frames of num_channels samples
+ *  @param[in] input -- sample_size+num_taps-1 frames of num_channels samples
+ *  @param[in] coeffs -- taps in host memory, for the transposed form
+ *  @param[in] v_coeffs -- the same taps in the scratchpad, for the accumulate form; may be NULL
+ *  @param[in] sample_size -- samples of each channel
+ *  @param[in] num_taps
+ *  @param[in] num_channels -- samples per frame
+ *  @retval 0 if successful; -1 if out of scratchpad memory
+ */
+int VBX_T(vbw_vec_fir_sp)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs, vbx_sp_t *v_coeffs, const int sample_size, const int num_taps, const int num_channels)
+{
+	vbw_stream_t in  = { input,  sizeof(vbx_sp_t), num_channels, 0, num_taps-1 };
+	vbw_stream_t out = { output, sizeof(vbx_sp_t), num_channels, 0, 0 };
+	vbw_fir_arg_t fir = { coeffs, num_channels == 1 ? v_coeffs : NULL, num_taps, num_channels };
+	int status;
+
+	status = vbw_stream(&in, 1, &out, 1, sample_size, num_channels, num_channels*sizeof(vbx_sp_t), VBX_T(vbw_fir_chunk), &fir);
+	if (status) {
+		printf("Out of scratchpad memory\n");
+	}
+	return status;
+}
+
+/** FIR filter that picks its form per chunk.
+ *  Streams the samples through the scratchpad with double or triple
+ *  buffered DMA. Each chunk is filtered either by one accumulating 2D
+ *  instruction, one row per output as @ref vbw_vec_fir_2d_byte, or in
+ *  transposed form, a multiply and an add over the chunk per nonzero tap
+ *  as @ref vbw_vec_fir_transpose_byte, whichever takes fewer cycles for
+ *  the number of taps, vector lanes and samples in the chunk.
+ *  Interleaved channels are filtered independently with the same taps.
+ *  The taps of one channel are not adjacent in interleaved samples, so
+ *  more than one channel always uses the transposed form.
+ *  The taps are read afresh on every call, so they may change between
+ *  calls; @ref vbw_vec_fir_sp_byte keeps them in the scratchpad instead.
+ *
+ *  @param[out] output -- sample_size frames of num_channels samples
+ *  @param[in] input -- sample_size+num_taps-1 frames of num_channels samples
+ *  @param[in] coeffs
+ *  @param[in] sample_size -- samples of each channel
+ *  @param[in] num_taps
+ *  @param[in] num_channels -- samples per frame
+ *  @retval 0 if successful; -1 if out of scratchpad memory
+ */
+int VBX_T(vbw_vec_fir)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs, const int sample_size, const int num_taps, const int num_channels)
+{
+	vbx_sp_t *v_coeffs = NULL;
+	int status;
+
+	vbx_sp_push();
+	if (num_channels == 1) {
+		v_coeffs = (vbx_sp_t *)vbx_sp_malloc(num_taps*sizeof(vbx_sp_t));
+		if (v_coeffs) {
+			vbx_dcache_flush(coeffs, num_taps*sizeof(vbx_sp_t));
+			vbx_dma_to_vector(v_coeffs, coeffs, num_taps*sizeof(vbx_sp_t));
+		}
+	}
+	status = VBX_T(vbw_vec_fir_sp)(output, input, coeffs, v_coeffs, sample_size, num_taps, num_channels);
+	vbx_sp_pop();
+	return status;
+}
+
 #endif // properly defined VBX_TEMPLATE_T
 #endif // defined(VBX_TEMPLATE_T)
@@ -54,14 +54,24 @@ extern "C" {
 #include "vbx_types.h"
 
 
+// Build with -DVBX_RELEASE=1 for release: runtime checks and debug
+// messages are compiled out, and the scratchpad allocator is inlined.
+#ifndef VBX_RELEASE
+#define VBX_RELEASE 0
+#endif
+
 #ifndef VBX_SKIP_ALL_CHECKS
 #define VBX_SKIP_ALL_CHECKS  1 /*(mxp_cpu->skip_all_checks)*/
 #endif
 
 #ifndef VBX_DEBUG_LEVEL
+#if VBX_RELEASE
+#define VBX_DEBUG_LEVEL      0
+#else
 //Set below 4 for running tests, should be higher for debugging
 #define VBX_DEBUG_LEVEL      3 /*(mxp_cpu->debug_level)*/
 #endif
+#endif
 
 #ifndef VBX_SAFE_TO_CLOBBER_SOURCE
 #define VBX_SAFE_TO_CLOBBER_SOURCE  0   /* some algorithms operate faster if they can clobber source operand memory */
@@ -72,7 +82,9 @@ extern "C" {
 #define VBX_DEBUG_SP_MALLOC 0
 #define VBX_DEBUG_NO_SPSTACK 0
 #define VBX_DEBUG_VBXLIB 0
+#ifndef VBX_USE_GLOBAL_MXP_PTR
 #define VBX_USE_GLOBAL_MXP_PTR 1
+#endif
 #define VBX_USE_AXI_INSTR_PORT_NORMAL_MEMORY 0
 #define VBX_USE_AXI_INSTR_PORT_DEVICE_MEMORY 1
 #define VBX_USE_AXI_INSTR_PORT_ADDR_INCR 0
@@ -82,6 +94,9 @@ extern "C" {
 
 #if VBX_USE_GLOBAL_MXP_PTR
 extern vbx_mxp_t* vbx_mxp_ptr;
+#elif VBX_RELEASE
+// without it, every VBX_GET_THIS_MXP() reads an MXP register
+#error "VBX_RELEASE requires VBX_USE_GLOBAL_MXP_PTR"
 #endif
 
 #ifdef __cplusplus
@@ -40,6 +40,8 @@
 #include "vbx_copyright.h"
 VBXCOPYRIGHT( api )
 
+#include <string.h>
+
 #include "vbx.h"
 #include "vbx_port.h"
 
@@ -59,6 +61,10 @@ vbx_mxp_t *vbx_mxp_ptr;
 #define sp_stack_top  (this_mxp->spstack_top)
 #define sp_stack_max  (this_mxp->spstack_max)
 
+static void vbx_sp_heap_reset( struct vbx_sp_heap *heap );
+static size_t vbx_sp_cache_reclaim( vbx_mxp_t *this_mxp, size_t num_bytes );
+static int vbx_sp_cache_reclaimable( vbx_mxp_t *this_mxp );
+
 // --------------------------------------------------------
 // System-wide initialization
 
@@ -72,6 +78,10 @@ void _vbx_init( vbx_mxp_t *this_mxp )
 	// max = depth of scratchpad
 	this_mxp->spstack_max = (int)( this_mxp->scratchpad_size / this_mxp->vector_lanes );
 	this_mxp->spstack_top = 0;
+	this_mxp->sp_limit = this_mxp->scratchpad_end;
+	if( this_mxp->sp_heap ) {
+		vbx_sp_heap_reset( this_mxp->sp_heap );
+	}
 // don't malloc spstack for MicroBlaze simulation, because axi_bram isn't
 // large enough.
 #if !VBX_DEBUG_NO_SPSTACK
@@ -96,12 +106,73 @@ void _vbx_init( vbx_mxp_t *this_mxp )
 	// FIXME WARNING: the function call below only works for uniprocessors
 	// The function must only be called by the CPU that owns the accelerator
 	// described by 'mxp' instance.
-	vbx_set_reg( VBX_REG_MXPCPU, (int)this_mxp ); // FIXME
+	vbx_set_reg( VBX_REG_MXPCPU, (int)(intptr_t)this_mxp ); // FIXME
 
 	this_mxp->init = 1;
 }
 
 
+// --------------------------------------------------------
+// Fences
+//
+// The simulator provides its own fences (see lib/vbxsim). On the MXP, a fence
+// is a VMOV of its number into the free scratchpad word at the scratchpad
+// pointer, followed by a DMA of that word to an uncached host word. Both are
+// queued behind everything issued before them, and DMA transfers complete in
+// order, so the host word holds the number of the last complete fence. The
+// hazard checks of the MXP hold back any later write to the word until the
+// DMA has read it, so the word need not be allocated.
+
+#if !VBX_SIMULATOR
+static volatile vbx_fence_t *fence_host;
+static vbx_fence_t fence_last;
+
+vbx_fence_t vbx_fence()
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	vbx_uword_t *v_fence = (vbx_uword_t *)this_mxp->sp;
+	int vl;
+
+	if( !fence_host ) {
+		fence_host = (volatile vbx_fence_t *)vbx_shared_malloc( sizeof(vbx_fence_t) );
+		if( !fence_host ) {
+			VBX_PRINTF("ERROR: failed to malloc %d bytes for fences.\n", (int)sizeof(vbx_fence_t));
+			VBX_FATAL(__LINE__, __FILE__, -1);
+		}
+		*fence_host = fence_last;
+	}
+
+	fence_last++;
+	// not vbx_sp_getfree(), which counts cache entries that are still resident
+	if( (size_t)(this_mxp->sp_limit - this_mxp->sp) < sizeof(vbx_uword_t) ) {
+		// no free word: complete the fence now
+		vbx_sync();
+		*fence_host = fence_last;
+		return fence_last;
+	}
+
+	vbx_get_vl( &vl );
+	vbx_set_vl_nodebug( 1 );
+	vbx( SVWU, VMOV, v_fence, fence_last, 0 );
+	vbx_set_vl_nodebug( vl );
+	vbx_dma_to_host_nodebug( (void *)fence_host, v_fence, sizeof(vbx_fence_t) );
+	return fence_last;
+}
+
+int vbx_fence_done( vbx_fence_t fence )
+{
+	// fence numbers wrap around
+	return !fence_host || (int32_t)(*fence_host - fence) >= 0;
+}
+
+void vbx_fence_wait( vbx_fence_t fence )
+{
+	while( !vbx_fence_done( fence ) )
+		;
+}
+#endif // !VBX_SIMULATOR
+
+
 // --------------------------------------------------------
 // Allocate and deallocate scratchpad memory.
 
@@ -127,7 +198,10 @@ vbx_void_t *vbx_sp_malloc_debug( int LINE,const char *FNAME, size_t num_bytes )
 
 	// pad to scratchpad width to reduce occurrence of false hazards
 	size_t padded = VBX_PAD_UP( num_bytes, this_mxp->scratchpad_alignment_bytes );
-	size_t freesp = (size_t)(this_mxp->scratchpad_end - this_mxp->sp); //VBX_SCRATCHPAD_END - (size_t)vbx_sp; // vbx_sp_getfree();
+	size_t freesp = (size_t)(this_mxp->sp_limit - this_mxp->sp); // vbx_sp_getfree();
+	if( freesp < padded ) {
+		freesp = vbx_sp_cache_reclaim( this_mxp, padded );
+	}
 
 	vbx_void_t  *result = NULL;
 	if( VBX_DEBUG_LEVEL && (num_bytes==0) ) {
@@ -166,10 +240,13 @@ vbx_void_t *vbx_sp_malloc_nodebug( size_t num_bytes )
 	// pad to scratchpad width to reduce occurrence of false hazards
 	size_t padded = VBX_PAD_UP( num_bytes, this_mxp->scratchpad_alignment_bytes );
 	vbx_void_t *old_sp = this_mxp->sp;
+	if( (size_t)(this_mxp->sp_limit - old_sp) < padded ) {
+		vbx_sp_cache_reclaim( this_mxp, padded );
+	}
 	this_mxp->sp += padded;
 
 	// scratchpad full
-	if( this_mxp->sp > this_mxp->scratchpad_end ) {
+	if( this_mxp->sp > this_mxp->sp_limit ) {
 		this_mxp->sp = old_sp;
 		return NULL;
 	}
@@ -216,8 +293,9 @@ int vbx_sp_getfree()
 {
 	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
 	int free = 0;
+	// include what evicting the unlocked cache entries would give vbx_sp_malloc()
 	if( this_mxp )
-		free = (int)(this_mxp->scratchpad_end - this_mxp->sp);
+		free = (int)(this_mxp->sp_limit - this_mxp->sp) + vbx_sp_cache_reclaimable( this_mxp );
 	return free;
 }
 
@@ -234,7 +312,7 @@ void vbx_sp_set_debug( int LINE, const char *FNAME, vbx_void_t *new_sp )
 	if( !this_mxp )  {
 		VBX_PRINTF( "ERROR: failed to call _vbx_init().\n" );
 		VBX_FATAL(LINE,FNAME,-1);
-	} else if( (this_mxp->scratchpad_addr <= new_sp && new_sp <= this_mxp->scratchpad_end)
+	} else if( (this_mxp->scratchpad_addr <= new_sp && new_sp <= this_mxp->sp_limit)
 	           && VBX_IS_ALIGNED(new_sp, 4) ) {
 		this_mxp->sp = new_sp;
 	} else {
@@ -253,7 +331,7 @@ void vbx_sp_set_nodebug( vbx_void_t *new_sp )
 	// do it, but do not print pretty error messages
 	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
 	if( this_mxp
-	           && (this_mxp->scratchpad_addr <= new_sp && new_sp <= this_mxp->scratchpad_end)
+	           && (this_mxp->scratchpad_addr <= new_sp && new_sp <= this_mxp->sp_limit)
 	           && VBX_IS_ALIGNED(new_sp, 4) ) {
 		this_mxp->sp = new_sp;
 	}
@@ -291,6 +369,500 @@ void vbx_sp_pop_debug( int LINE, const char *FNAME )
 }
 
 
+// --------------------------------------------------------
+// Scratchpad heap
+//
+// The heap takes blocks from the top of the scratchpad, lowering sp_limit,
+// the end of the space vbx_sp_malloc() allocates from, so the stack
+// allocator keeps its bump pointer. The heap is described by a table of
+// blocks in host memory, sorted by address, which covers [sp_limit,
+// scratchpad_end) exactly. Free neighbours are merged, and a free block at
+// the bottom is given back to the stack allocator, so the heap never holds
+// more than it needs. A request takes the free block it fits best,
+// placing the allocation at the top of the block, and only grows the heap
+// if no block fits.
+//
+// The residency cache keeps copies of read-only host buffers in heap
+// blocks of its own pool, keyed on host address and size. Entries are
+// locked while a kernel uses them; the unlocked ones are evicted in LRU
+// order when a cache miss or vbx_sp_malloc() runs out of space.
+
+#ifndef VBX_SP_HEAP_BLOCKS
+#define VBX_SP_HEAP_BLOCKS 64
+#endif
+#ifndef VBX_SP_HEAP_POOLS
+#define VBX_SP_HEAP_POOLS  8
+#endif
+#ifndef VBX_SP_CACHE_ENTRIES
+#define VBX_SP_CACHE_ENTRIES 16
+#endif
+
+typedef struct {
+	vbx_void_t *addr;
+	int         bytes;
+	int         pool; ///< index of its pool, or -1 if free
+} vbx_sp_block_t;
+
+typedef struct {
+	const void *host;
+	int         bytes;
+	vbx_void_t *addr;
+	unsigned    last_use;
+	int         locks;
+} vbx_sp_entry_t;
+
+struct vbx_sp_heap {
+	int            nblocks;
+	int            npools;
+	int            high_water;
+	vbx_sp_block_t block[VBX_SP_HEAP_BLOCKS];
+	vbx_sp_pool_t  pool[VBX_SP_HEAP_POOLS];
+
+	int                  nentries;
+	unsigned             clock;
+	vbx_sp_pool_t       *cache_pool;
+	vbx_sp_cache_stats_t cache;
+	vbx_sp_entry_t       entry[VBX_SP_CACHE_ENTRIES];
+};
+
+static void vbx_sp_heap_reset( struct vbx_sp_heap *heap )
+{
+	heap->nblocks = 0;
+	heap->npools = 1;
+	heap->high_water = 0;
+	heap->pool[0].name = "default";
+	heap->pool[0].alignment = 0;
+	heap->pool[0].used = 0;
+	heap->pool[0].high_water = 0;
+	heap->pool[0].blocks = 0;
+	heap->nentries = 0;
+	heap->clock = 0;
+	heap->cache_pool = NULL;
+	memset( &heap->cache, 0, sizeof(heap->cache) );
+}
+
+static struct vbx_sp_heap *vbx_sp_heap_get( vbx_mxp_t *this_mxp )
+{
+	if( !this_mxp ) {
+		return NULL;
+	}
+	if( !this_mxp->sp_heap ) {
+		this_mxp->sp_heap = (struct vbx_sp_heap *)malloc( sizeof(struct vbx_sp_heap) );
+		if( !this_mxp->sp_heap ) {
+			VBX_PRINTF("ERROR: failed to malloc %d bytes for the scratchpad heap.\n", (int)sizeof(struct vbx_sp_heap));
+			return NULL;
+		}
+		vbx_sp_heap_reset( this_mxp->sp_heap );
+	}
+	return this_mxp->sp_heap;
+}
+
+// Insert a block before entry i
+static void sp_heap_insert( struct vbx_sp_heap *heap, int i, vbx_void_t *addr, int bytes, int pool )
+{
+	memmove( &heap->block[i+1], &heap->block[i], (heap->nblocks-i)*sizeof(vbx_sp_block_t) );
+	heap->block[i].addr = addr;
+	heap->block[i].bytes = bytes;
+	heap->block[i].pool = pool;
+	heap->nblocks++;
+}
+
+static void sp_heap_remove( struct vbx_sp_heap *heap, int i )
+{
+	heap->nblocks--;
+	memmove( &heap->block[i], &heap->block[i+1], (heap->nblocks-i)*sizeof(vbx_sp_block_t) );
+}
+
+vbx_sp_pool_t *vbx_sp_pool( const char *name, int alignment )
+{
+	struct vbx_sp_heap *heap = vbx_sp_heap_get( VBX_GET_THIS_MXP() );
+	vbx_sp_pool_t *pool;
+	int i;
+
+	if( !heap ) {
+		return NULL;
+	}
+	for( i = 0; i < heap->npools; i++ ) {
+		if( !strcmp( heap->pool[i].name, name ) ) {
+			return &heap->pool[i];
+		}
+	}
+	if( heap->npools == VBX_SP_HEAP_POOLS ) {
+		VBX_PRINTF("ERROR: no room for scratchpad pool '%s', increase VBX_SP_HEAP_POOLS.\n", name);
+		return NULL;
+	}
+	if( alignment & (alignment-1) ) {
+		VBX_PRINTF("ERROR: scratchpad pool '%s' alignment %d is not a power of 2.\n", name, alignment);
+		return NULL;
+	}
+	pool = &heap->pool[heap->npools++];
+	pool->name = name;
+	pool->alignment = alignment;
+	pool->used = 0;
+	pool->high_water = 0;
+	pool->blocks = 0;
+	return pool;
+}
+
+// Allocate a block, or return NULL without a message
+static vbx_void_t *sp_heap_alloc( vbx_mxp_t *this_mxp, struct vbx_sp_heap *heap,
+                                  vbx_sp_pool_t *pool, size_t num_bytes )
+{
+	vbx_sp_block_t *b;
+	vbx_void_t *addr, *top;
+	int i, p, best, padded, align, size;
+
+	p = pool - heap->pool;
+	padded = VBX_PAD_UP( num_bytes, this_mxp->scratchpad_alignment_bytes );
+	align = pool->alignment > this_mxp->scratchpad_alignment_bytes ?
+	        pool->alignment : this_mxp->scratchpad_alignment_bytes;
+
+	// the hole it fits best, at its top
+	best = -1;
+	for( i = 0; i < heap->nblocks; i++ ) {
+		b = &heap->block[i];
+		if( b->pool < 0 && b->bytes >= padded &&
+		    (vbx_void_t *)VBX_PAD_DN( b->addr + b->bytes - padded, align ) >= b->addr &&
+		    (best < 0 || b->bytes < heap->block[best].bytes) ) {
+			best = i;
+		}
+	}
+
+	// room for the block and for the two holes it may leave
+	if( heap->nblocks+2 > VBX_SP_HEAP_BLOCKS ) {
+		return NULL;
+	}
+
+	if( best < 0 ) {
+		// grow the heap down into the free space of the stack allocator
+		top = this_mxp->sp_limit;
+		addr = (vbx_void_t *)VBX_PAD_DN( top - padded, align );
+		if( top - padded < this_mxp->sp || addr < this_mxp->sp ) {
+			return NULL;
+		}
+		if( addr + padded < top ) {
+			sp_heap_insert( heap, 0, addr + padded, top - (addr + padded), -1 );
+		}
+		sp_heap_insert( heap, 0, addr, padded, p );
+		this_mxp->sp_limit = addr;
+	} else {
+		b = &heap->block[best];
+		top = b->addr + b->bytes;
+		addr = (vbx_void_t *)VBX_PAD_DN( top - padded, align );
+		if( addr + padded < top ) {
+			sp_heap_insert( heap, best+1, addr + padded, top - (addr + padded), -1 );
+		}
+		if( addr > b->addr ) {
+			heap->block[best].bytes = addr - heap->block[best].addr;
+			best++;
+			sp_heap_insert( heap, best, addr, padded, p );
+		} else {
+			heap->block[best].bytes = padded;
+			heap->block[best].pool = p;
+		}
+	}
+
+	pool->used += padded;
+	pool->blocks++;
+	if( pool->used > pool->high_water ) {
+		pool->high_water = pool->used;
+	}
+	size = (int)(this_mxp->scratchpad_end - this_mxp->sp_limit);
+	if( size > heap->high_water ) {
+		heap->high_water = size;
+	}
+	return addr;
+}
+
+vbx_void_t *vbx_sp_heap_malloc( vbx_sp_pool_t *pool, size_t num_bytes )
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	struct vbx_sp_heap *heap = vbx_sp_heap_get( this_mxp );
+	vbx_void_t *addr;
+
+	if( !heap || num_bytes == 0 ) {
+		return NULL;
+	}
+	if( !pool ) {
+		pool = &heap->pool[0];
+	}
+	addr = sp_heap_alloc( this_mxp, heap, pool, num_bytes );
+	if( !addr && heap->nblocks+2 > VBX_SP_HEAP_BLOCKS ) {
+		VBX_PRINTF("ERROR: no room for another scratchpad heap block, increase VBX_SP_HEAP_BLOCKS.\n");
+	} else if( !addr && VBX_DEBUG_LEVEL ) {
+		VBX_PRINTF("ERROR: scratchpad heap needs %d bytes in pool '%s', but only %d bytes are free.\n",
+		           (int)VBX_PAD_UP( num_bytes, this_mxp->scratchpad_alignment_bytes ), pool->name, vbx_sp_getfree());
+	}
+	return addr;
+}
+
+void vbx_sp_heap_free( vbx_void_t *addr )
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	struct vbx_sp_heap *heap = this_mxp ? this_mxp->sp_heap : NULL;
+	vbx_sp_pool_t *pool;
+	int i;
+
+	if( !addr ) {
+		return;
+	}
+	for( i = 0; heap && i < heap->nblocks && heap->block[i].addr != addr; i++ )
+		;
+	if( !heap || i == heap->nblocks || heap->block[i].pool < 0 ) {
+		VBX_PRINTF("ERROR: vbx_sp_heap_free() of 0x%08lx, which is not a scratchpad heap block.\n", (long int)addr);
+		return;
+	}
+
+	pool = &heap->pool[heap->block[i].pool];
+	pool->used -= heap->block[i].bytes;
+	pool->blocks--;
+	heap->block[i].pool = -1;
+
+	// merge with free neighbours
+	if( i+1 < heap->nblocks && heap->block[i+1].pool < 0 ) {
+		heap->block[i].bytes += heap->block[i+1].bytes;
+		sp_heap_remove( heap, i+1 );
+	}
+	if( i > 0 && heap->block[i-1].pool < 0 ) {
+		heap->block[i-1].bytes += heap->block[i].bytes;
+		sp_heap_remove( heap, i );
+		i--;
+	}
+
+	// give the bottom of the heap back to the stack allocator
+	if( i == 0 ) {
+		this_mxp->sp_limit += heap->block[0].bytes;
+		sp_heap_remove( heap, 0 );
+	}
+}
+
+void vbx_sp_heap_stats( vbx_sp_heap_stats_t *stats )
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	struct vbx_sp_heap *heap = this_mxp ? this_mxp->sp_heap : NULL;
+	int i;
+
+	memset( stats, 0, sizeof(*stats) );
+	if( !heap ) {
+		return;
+	}
+	stats->size = (int)(this_mxp->scratchpad_end - this_mxp->sp_limit);
+	stats->high_water = heap->high_water;
+	for( i = 0; i < heap->nblocks; i++ ) {
+		if( heap->block[i].pool < 0 ) {
+			stats->free += heap->block[i].bytes;
+			stats->holes++;
+			if( heap->block[i].bytes > stats->largest_free ) {
+				stats->largest_free = heap->block[i].bytes;
+			}
+		} else {
+			stats->used += heap->block[i].bytes;
+			stats->blocks++;
+		}
+	}
+}
+
+void vbx_sp_heap_print()
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	struct vbx_sp_heap *heap = this_mxp ? this_mxp->sp_heap : NULL;
+	vbx_sp_heap_stats_t stats;
+	int i;
+
+	vbx_sp_heap_stats( &stats );
+	printf( "scratchpad heap: %d bytes (high water %d), %d used in %d blocks, %d free in %d holes",
+	        stats.size, stats.high_water, stats.used, stats.blocks, stats.free, stats.holes );
+	if( stats.free ) {
+		printf( ", %d%% fragmented", 100 - 100*stats.largest_free/stats.free );
+	}
+	printf( "\n" );
+	for( i = 0; heap && i < heap->npools; i++ ) {
+		printf( "  pool %-12s %6d bytes (high water %6d) in %d blocks\n", heap->pool[i].name,
+		        heap->pool[i].used, heap->pool[i].high_water, heap->pool[i].blocks );
+	}
+	if( heap && (heap->cache.hits || heap->cache.misses) ) {
+		vbx_sp_cache_stats_t cache;
+		vbx_sp_cache_stats( &cache );
+		printf( "  cache: %d entries in %d bytes, %d hits, %d misses, %d evictions\n",
+		        cache.entries, cache.bytes, cache.hits, cache.misses, cache.evictions );
+	}
+}
+
+// Drop entry i and free its block
+static void sp_cache_drop( struct vbx_sp_heap *heap, int i )
+{
+	vbx_sp_heap_free( heap->entry[i].addr );
+	heap->entry[i] = heap->entry[--heap->nentries];
+}
+
+// Evict the least recently used unlocked entry, or return 0 if all are locked
+static int sp_cache_evict( struct vbx_sp_heap *heap )
+{
+	int i, lru = -1;
+
+	for( i = 0; i < heap->nentries; i++ ) {
+		if( !heap->entry[i].locks &&
+		    (lru < 0 || (int)(heap->entry[i].last_use - heap->entry[lru].last_use) < 0) ) {
+			lru = i;
+		}
+	}
+	if( lru < 0 ) {
+		return 0;
+	}
+	sp_cache_drop( heap, lru );
+	heap->cache.evictions++;
+	return 1;
+}
+
+// Evict until vbx_sp_malloc() has num_bytes free, or nothing is left to evict
+static size_t vbx_sp_cache_reclaim( vbx_mxp_t *this_mxp, size_t num_bytes )
+{
+	while( this_mxp->sp_heap && (size_t)(this_mxp->sp_limit - this_mxp->sp) < num_bytes &&
+	       sp_cache_evict( this_mxp->sp_heap ) )
+		;
+	return (size_t)(this_mxp->sp_limit - this_mxp->sp);
+}
+
+// Bytes vbx_sp_cache_reclaim() can give back: the unlocked entries and holes at the bottom of the heap
+static int vbx_sp_cache_reclaimable( vbx_mxp_t *this_mxp )
+{
+	struct vbx_sp_heap *heap = this_mxp->sp_heap;
+	int i, j, bytes = 0;
+
+	for( i = 0; heap && i < heap->nblocks; i++ ) {
+		if( heap->block[i].pool >= 0 ) {
+			if( !heap->cache_pool || heap->block[i].pool != heap->cache_pool - heap->pool ) {
+				break;
+			}
+			for( j = 0; j < heap->nentries && heap->entry[j].addr != heap->block[i].addr; j++ )
+				;
+			if( j == heap->nentries || heap->entry[j].locks ) {
+				break;
+			}
+		}
+		bytes += heap->block[i].bytes;
+	}
+	return bytes;
+}
+
+vbx_void_t *vbx_sp_cache_get( const void *host_ptr, size_t num_bytes )
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	struct vbx_sp_heap *heap = vbx_sp_heap_get( this_mxp );
+	vbx_sp_entry_t *e;
+	vbx_void_t *addr;
+	int i;
+
+	if( !heap || !host_ptr || num_bytes == 0 ) {
+		return NULL;
+	}
+	for( i = 0; i < heap->nentries; i++ ) {
+		e = &heap->entry[i];
+		if( e->host == host_ptr && e->bytes == (int)num_bytes ) {
+			e->locks++;
+			e->last_use = ++heap->clock;
+			heap->cache.hits++;
+			return e->addr;
+		}
+	}
+
+	heap->cache.misses++;
+	if( !heap->cache_pool ) {
+		heap->cache_pool = vbx_sp_pool( "cache", 0 );
+		if( !heap->cache_pool ) {
+			return NULL;
+		}
+	}
+	if( heap->nentries == VBX_SP_CACHE_ENTRIES && !sp_cache_evict( heap ) ) {
+		return NULL;
+	}
+	while( !(addr = sp_heap_alloc( this_mxp, heap, heap->cache_pool, num_bytes )) ) {
+		if( !sp_cache_evict( heap ) ) {
+			return NULL;
+		}
+	}
+
+	vbx_dcache_flush( (void *)host_ptr, num_bytes );
+	vbx_dma_to_vector_nodebug( addr, (void *)host_ptr, num_bytes );
+
+	e = &heap->entry[heap->nentries++];
+	e->host = host_ptr;
+	e->bytes = (int)num_bytes;
+	e->addr = addr;
+	e->last_use = ++heap->clock;
+	e->locks = 1;
+	return addr;
+}
+
+void vbx_sp_cache_put( vbx_void_t *v_ptr )
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	struct vbx_sp_heap *heap = this_mxp ? this_mxp->sp_heap : NULL;
+	int i;
+
+	for( i = 0; heap && i < heap->nentries && heap->entry[i].addr != v_ptr; i++ )
+		;
+	if( !heap || i == heap->nentries || !heap->entry[i].locks ) {
+		VBX_PRINTF("ERROR: vbx_sp_cache_put() of 0x%08lx, which is not a locked cache entry.\n", (long int)v_ptr);
+		return;
+	}
+	heap->entry[i].locks--;
+}
+
+void vbx_sp_cache_invalidate( const void *host_ptr )
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	struct vbx_sp_heap *heap = this_mxp ? this_mxp->sp_heap : NULL;
+	int i = 0;
+
+	while( heap && i < heap->nentries ) {
+		if( heap->entry[i].host != host_ptr ) {
+			i++;
+		} else if( heap->entry[i].locks ) {
+			VBX_PRINTF("ERROR: vbx_sp_cache_invalidate() of 0x%08lx, which is in use.\n", (long int)host_ptr);
+			i++;
+		} else {
+			sp_cache_drop( heap, i );
+		}
+	}
+}
+
+void vbx_sp_cache_flush()
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	struct vbx_sp_heap *heap = this_mxp ? this_mxp->sp_heap : NULL;
+	int i = 0;
+
+	while( heap && i < heap->nentries ) {
+		if( heap->entry[i].locks ) {
+			i++;
+		} else {
+			sp_cache_drop( heap, i );
+		}
+	}
+}
+
+void vbx_sp_cache_stats( vbx_sp_cache_stats_t *stats )
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	struct vbx_sp_heap *heap = this_mxp ? this_mxp->sp_heap : NULL;
+	int i;
+
+	memset( stats, 0, sizeof(*stats) );
+	if( !heap ) {
+		return;
+	}
+	*stats = heap->cache;
+	stats->entries = heap->nentries;
+	for( i = 0; i < heap->nentries; i++ ) {
+		stats->bytes += heap->entry[i].bytes;
+		if( heap->entry[i].locks ) {
+			stats->locked++;
+		}
+	}
+}
+
+
 // --------------------------------------------------------
 // Memory allocation routines
 
@@ -359,34 +931,34 @@ int runtime_check_suppress=~0;
 void print_sp_range(int enable){
 	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
 	RTC_printf(enable,"note: scratchpad range is [0x%08X - 0x%08X]\n",
-		       (unsigned)this_mxp->scratchpad_addr,
-		       (unsigned)this_mxp->scratchpad_end);
+		       (unsigned)(uintptr_t)this_mxp->scratchpad_addr,
+		       (unsigned)(uintptr_t)this_mxp->scratchpad_end);
 }
 void vbx_generic_check(int dest_len, void* dest, int srcA_len,
 	                  void* srcA, int srcB_len,void* srcB, vinstr_t v_op)
 {
 	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
-	unsigned base = (unsigned) this_mxp->scratchpad_addr;
-	unsigned end = (unsigned) this_mxp->scratchpad_end;
-	if((unsigned)dest < base ||
-	   (unsigned)dest + dest_len >end){
+	uintptr_t base = (uintptr_t) this_mxp->scratchpad_addr;
+	uintptr_t end = (uintptr_t) this_mxp->scratchpad_end;
+	if((uintptr_t)dest < base ||
+	   (uintptr_t)dest + dest_len >end){
 		RTC_printf(RT_CHECK_SP_BOUND,
 		           "warning: Destination range [0x%08X - 0x%08X ] is not contained in scratchpad\n\t",
-			       (unsigned)dest,(unsigned)dest +dest_len);
+			       (unsigned)(uintptr_t)dest,(unsigned)(uintptr_t)dest +dest_len);
 		print_sp_range(RT_CHECK_SP_BOUND);
 		RUNTIME_CHECK_FAILED=1;
-	}else if((unsigned)srcA < base ||
-	         (unsigned)srcA + srcA_len >end){
+	}else if(srcA && ((uintptr_t)srcA < base ||
+	         (uintptr_t)srcA + srcA_len >end)){
 		RTC_printf(RT_CHECK_SP_BOUND,
 		           "warning: Source A range [0x%08X - 0x%08X ] is not contained in scratchpad\n\t",
-			       (unsigned)srcA,(unsigned)srcA +srcA_len);
+			       (unsigned)(uintptr_t)srcA,(unsigned)(uintptr_t)srcA +srcA_len);
 		print_sp_range(RT_CHECK_SP_BOUND);
 		RUNTIME_CHECK_FAILED=1;
-	}else if(((unsigned)srcA < base ||
-	          (unsigned)srcA + srcB_len >end)&& v_op != VMOV){
+	}else if(srcB && ((uintptr_t)srcB < base ||
+	          (uintptr_t)srcB + srcB_len >end)&& v_op != VMOV){
 		RTC_printf(RT_CHECK_SP_BOUND,
 		           "warning: Source B range [0x%08X - 0x%08X ] is not contained in scratchpad\n\t",
-			       (unsigned)srcB,(unsigned)srcA +srcB_len);
+			       (unsigned)(uintptr_t)srcB,(unsigned)(uintptr_t)srcB +srcB_len);
 		print_sp_range(RT_CHECK_SP_BOUND);
 		RUNTIME_CHECK_FAILED=1;
 	}
@@ -472,21 +1044,21 @@ int addr_in_sp(void* addr)
 {
 
 	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
-	unsigned base = (unsigned) this_mxp->scratchpad_addr;
-	unsigned end = (unsigned) this_mxp->scratchpad_end;
-	return ((unsigned)addr>=base && (unsigned)addr <= end);
+	uintptr_t base = (uintptr_t) this_mxp->scratchpad_addr;
+	uintptr_t end = (uintptr_t) this_mxp->scratchpad_end;
+	return ((uintptr_t)addr>=base && (uintptr_t)addr <= end);
 }
 void dma_check(void* external, void* internal,int len){
 	if ( addr_in_sp(external) || addr_in_sp(external+len)){
 		RTC_printf(RT_CHECK_DMA,"warning: host buffer range [0x%08X - 0x%08X ] overlaps scratchpad\n",
-		           (unsigned)external,(unsigned)external +len);
+		           (unsigned)(uintptr_t)external,(unsigned)(uintptr_t)external +len);
 		print_sp_range(RT_CHECK_DMA);
 		RUNTIME_CHECK_FAILED=1;
  	}
 	if( !addr_in_sp(internal) || !addr_in_sp(internal+len)){
 		RTC_printf(RT_CHECK_DMA,
 		           "DMA Warning: MXP buffer [0x%08X - 0x%08X ] is not contained in scratchpad\n",
-		       (unsigned)internal, (unsigned)internal+len);
+		       (unsigned)(uintptr_t)internal, (unsigned)(uintptr_t)internal+len);
 		print_sp_range(RT_CHECK_DMA);
 		RUNTIME_CHECK_FAILED=1;
 	}
@@ -553,22 +1125,207 @@ void vbx_set_3D_debug(int nmats,int incd, int inca,int incb)
 	vbx_set_3D_nodebug(nmats+1,incd,inca,incb);
 }
 
-//TODO:make this have finer grain warnings
+// Copy forward hazards
+//
+// An instruction runs one row after another, and each row one wave of
+// elements after another. A wave holds as many elements of the widest
+// operand as fit in the vector lanes; its sources are all read before its
+// results are written. A source byte that the destination writes before
+// the wave or row that reads it is a hazard: depending on how far ahead the
+// pipeline reads, the instruction sees either the old or the new value.
+
+static const char *cop_fwd_instr_name[] = {
+	"VMOV", "VAND", "VOR", "VXOR", "VADD", "VSUB", "VADDC", "VSUBB",
+	"VMUL", "VMULHI", "VMULFXP", "VSHL", "VSHR", "VROTL", "VROTR",
+	"VCMV_LEZ", "VCMV_GTZ", "VCMV_LTZ", "VCMV_GEZ", "VCMV_Z", "VCMV_NZ",
+	"VABSDIFF", "VCUSTOM0", "VCUSTOM1", "VCUSTOM2", "VCUSTOM3"
+};
+
+static intptr_t cop_fwd_div_floor( intptr_t n, intptr_t d )
+{
+	return n >= 0 ? n/d : -((-n+d-1)/d);
+}
+
+// first t in [lo,hi] with L < base + t*step < R, or -1
+static int cop_fwd_first_row( intptr_t base, intptr_t step, int lo, int hi, intptr_t L, intptr_t R )
+{
+	intptr_t tmin, tmax, tmp;
+	if( step == 0 ) {
+		return ( lo <= hi && L < base && base < R ) ? lo : -1;
+	}
+	if( step < 0 ) {
+		base = -base;
+		step = -step;
+		tmp = L;
+		L = -R;
+		R = -tmp;
+	}
+	tmin =  cop_fwd_div_floor( L-base, step ) + 1;
+	tmax = -cop_fwd_div_floor( base-R, step ) - 1;
+	if( tmin < lo ) tmin = lo;
+	if( tmax > hi ) tmax = hi;
+	return tmin <= tmax ? (int)tmin : -1;
+}
+
+// The source row starts off bytes after the destination row. Find a
+// destination element that overwrites a source element of a later wave.
+static int cop_fwd_row( intptr_t off, int vl, int dest_size, int src_size, int wave,
+                        int *dest_elem, int *src_elem )
+{
+	intptr_t dlo, dhi, slo, shi, x;
+	int w0, w1;
+	if( off >= (intptr_t)vl*dest_size || off + (intptr_t)vl*src_size <= 0 ) {
+		return 0;
+	}
+	for( w0 = 0; w0 < vl; w0 += wave ) {
+		w1 = w0 + wave < vl ? w0 + wave : vl;
+		if( w1 == vl ) {
+			break;
+		}
+		dlo = (intptr_t)w0*dest_size;
+		dhi = (intptr_t)w1*dest_size;
+		slo = off + (intptr_t)w1*src_size;
+		shi = off + (intptr_t)vl*src_size;
+		if( dlo < shi && slo < dhi ) {
+			x = dlo > slo ? dlo : slo;
+			*dest_elem = (int)(x/dest_size);
+			*src_elem  = (int)((x-off)/src_size);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static void cop_fwd_where( char *buf, size_t size, int dims, int mat, int row )
+{
+	if( dims == 3 ) {
+		snprintf( buf, size, " matrix %d row %d", mat, row );
+	} else if( dims == 2 ) {
+		snprintf( buf, size, " row %d", row );
+	} else {
+		buf[0] = '\0';
+	}
+}
+
+static void cop_fwd_report( int dims, vinstr_t v_op, void *dest, int dmat, int drow, int delem, intptr_t dstart,
+                            const char *src_name, int smat, int srow, int selem )
+{
+	char dwhere[48], swhere[48];
+	cop_fwd_where( dwhere, sizeof(dwhere), dims, dmat, drow );
+	cop_fwd_where( swhere, sizeof(swhere), dims, smat, srow );
+	RTC_printf( RT_CHECK_COP_FWD,
+	            "warning: copy forward hazard in %s: dest%s element %d (0x%08X) is written before %s%s element %d reads it\n",
+	            (unsigned)v_op <= MAX_INSTR_VAL ? cop_fwd_instr_name[v_op] : "?",
+	            dwhere, delem, (unsigned)((uintptr_t)dest + dstart), src_name, swhere, selem );
+	RUNTIME_CHECK_FAILED=1;
+}
+
+static void cop_fwd_extent( uintptr_t addr, int len, int nrows, int inc2, int nmats, int inc3,
+                            uintptr_t *lo, uintptr_t *hi )
+{
+	intptr_t l = 0, h = 0;
+	if( inc2 < 0 ) l += (intptr_t)(nrows-1)*inc2; else h += (intptr_t)(nrows-1)*inc2;
+	if( inc3 < 0 ) l += (intptr_t)(nmats-1)*inc3; else h += (intptr_t)(nmats-1)*inc3;
+	*lo = addr + l;
+	*hi = addr + h + len;
+}
+
+static int cop_fwd_check( int dims, vinstr_t v_op, int vl, int wave, int nrows, int nmats,
+                          int dest_size, void *dest, int id2, int id3,
+                          const char *src_name, int src_size, void *src, int is2, int is3 )
+{
+	intptr_t dlen = (intptr_t)vl*dest_size;
+	intptr_t slen = (intptr_t)vl*src_size;
+	intptr_t rel  = (intptr_t)((uintptr_t)src - (uintptr_t)dest);
+	intptr_t diff, x;
+	uintptr_t dlo, dhi, slo, shi;
+	int m, mm, r, rr, delem, selem;
+
+	cop_fwd_extent( (uintptr_t)dest, dlen, nrows, id2, nmats, id3, &dlo, &dhi );
+	cop_fwd_extent( (uintptr_t)src,  slen, nrows, is2, nmats, is3, &slo, &shi );
+	if( dhi <= slo || shi <= dlo ) {
+		return 0;
+	}
+
+	for( m = 0; m < nmats; m++ ) {
+		for( r = 0; r < nrows; r++ ) {
+			// the waves of this row
+			diff = rel + (intptr_t)m*(is3-id3) + (intptr_t)r*(is2-id2);
+			if( cop_fwd_row( diff, vl, dest_size, src_size, wave, &delem, &selem ) ) {
+				cop_fwd_report( dims, v_op, dest, m, r, delem, (intptr_t)m*id3 + (intptr_t)r*id2 + (intptr_t)delem*dest_size,
+				                src_name, m, r, selem );
+				return 1;
+			}
+			// later rows, in this matrix and then in later ones
+			for( mm = m; mm < nmats; mm++ ) {
+				diff = rel + (intptr_t)mm*is3 - (intptr_t)m*id3 - (intptr_t)r*id2;
+				rr = cop_fwd_first_row( diff, is2, mm == m ? r+1 : 0, nrows-1, -slen, dlen );
+				if( rr >= 0 ) {
+					diff += (intptr_t)rr*is2;
+					x = diff > 0 ? diff : 0;
+					cop_fwd_report( dims, v_op, dest, m, r, (int)(x/dest_size), (intptr_t)m*id3 + (intptr_t)r*id2 + x,
+					                src_name, mm, rr, (int)((x-diff)/src_size) );
+					return 1;
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static void vbx_check_cop_fwd( int dims, size_t dest_size, void* dest, size_t srcA_size,
+                               void* srcA, size_t srcB_size, void* srcB, vinstr_t v_op )
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	int vl, wave, widest;
+	int nrows = 1, id2 = 0, ia2 = 0, ib2 = 0;
+	int nmats = 1, id3 = 0, ia3 = 0, ib3 = 0;
+
+	// scalar and enumerated operands are passed as NULL, and VMOV has no srcB
+	if( v_op == VMOV ) {
+		srcB = NULL;
+	}
+	vbx_get_vl( &vl );
+	if( dims >= 2 ) {
+		vbx_get_2D( &nrows, &id2, &ia2, &ib2 );
+	}
+	if( dims == 3 ) {
+		vbx_get_3D( &nmats, &id3, &ia3, &ib3 );
+	}
+	if( vl <= 0 || nrows <= 0 || nmats <= 0 ) {
+		return;
+	}
+
+	widest = dest_size;
+	if( srcA && srcA_size > widest ) widest = srcA_size;
+	if( srcB && srcB_size > widest ) widest = srcB_size;
+	wave = this_mxp->vector_lanes*sizeof(vbx_word_t) / widest;
+	if( wave < 1 ) {
+		wave = 1;
+	}
+
+	if( srcA && cop_fwd_check( dims, v_op, vl, wave, nrows, nmats, dest_size, dest, id2, id3,
+	                           "srcA", srcA_size, srcA, ia2, ia3 ) ) {
+		return;
+	}
+	if( srcB ) {
+		cop_fwd_check( dims, v_op, vl, wave, nrows, nmats, dest_size, dest, id2, id3,
+		               "srcB", srcB_size, srcB, ib2, ib3 );
+	}
+}
+
 void vbx_check_1D_cop_fwd(size_t dest_size, void* dest, size_t srcA_size,
                           void* srcA, size_t srcB_size,void* srcB, vinstr_t v_op)
 {
-	if ( dest>srcA  || (v_op!=VMOV && dest>srcB) ){
-		RTC_printf(RT_CHECK_COP_FWD,"warning: possible copy forward hazard risk\n");
-		RUNTIME_CHECK_FAILED=1;
-	}
+	vbx_check_cop_fwd(1,dest_size,dest,srcA_size,srcA,srcB_size,srcB,v_op);
 }
 void vbx_check_2D_cop_fwd(size_t dest_size, void* dest, size_t srcA_size,
                           void* srcA, size_t srcB_size,void* srcB, vinstr_t v_op)
 {
-	vbx_check_1D_cop_fwd(dest_size,dest,srcA_size,srcA,srcB_size,srcB,v_op);
+	vbx_check_cop_fwd(2,dest_size,dest,srcA_size,srcA,srcB_size,srcB,v_op);
 }
 void vbx_check_3D_cop_fwd(size_t dest_size, void* dest, size_t srcA_size,
                           void* srcA, size_t srcB_size,void* srcB, vinstr_t v_op)
 {
-	vbx_check_1D_cop_fwd(dest_size,dest,srcA_size,srcA,srcB_size,srcB,v_op);
+	vbx_check_cop_fwd(3,dest_size,dest,srcA_size,srcA,srcB_size,srcB,v_op);
 }
@@ -0,0 +1,438 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**@file*/
+#include "vbx_copyright.h"
+VBXCOPYRIGHT(vbw_stream)
+
+#include "vbx.h"
+#include "vbw_stream.h"
+
+// Elements per row of an input in the scratchpad
+#define IN_PITCH(s, row_len) ((row_len) + (s)->halo_left + (s)->halo_right)
+
+// Rows of the tallest input halo
+static int stream_halo_rows( const vbw_stream_t *in, int num_in )
+{
+	int i, halo = 0;
+	for( i = 0; i < num_in; i++ ) {
+		if( in[i].halo_before + in[i].halo_after > halo ) {
+			halo = in[i].halo_before + in[i].halo_after;
+		}
+	}
+	return halo;
+}
+
+// Whether an output overwrites an input that has a halo, so later chunks
+// and strips read some of the pixels that earlier ones write
+static int stream_in_place( const vbw_stream_t *in, int num_in, const vbw_stream_t *out, int num_out,
+                            int rows, int row_len )
+{
+	int i, o;
+	const char *in_first, *in_last, *out_first, *out_last;
+
+	for( i = 0; i < num_in; i++ ) {
+		if( !(in[i].halo_before | in[i].halo_after | in[i].halo_left | in[i].halo_right) ) {
+			continue;
+		}
+		in_first = (const char *)in[i].host - (in[i].halo_before*in[i].pitch + in[i].halo_left)*in[i].elem_size;
+		in_last  = (const char *)in[i].host + ((rows-1 + in[i].halo_after)*in[i].pitch + row_len + in[i].halo_right)*in[i].elem_size;
+		for( o = 0; o < num_out; o++ ) {
+			out_first = (const char *)out[o].host;
+			out_last  = (const char *)out[o].host + ((rows-1)*out[o].pitch + row_len)*out[o].elem_size;
+			if( out_first < in_last && in_first < out_last ) {
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+// Rows per chunk that fit in free_bytes with depth buffers per stream
+static int stream_fit( const vbw_stream_t *in, int num_in, const vbw_stream_t *out, int num_out,
+                       int row_len, int temp_bytes_per_row, int depth, int free_bytes, int align )
+{
+	int i, row_bytes;
+	int per_row = temp_bytes_per_row;
+	int fixed   = temp_bytes_per_row ? temp_bytes_per_row*stream_halo_rows( in, num_in ) + align : 0;
+
+	for( i = 0; i < num_in; i++ ) {
+		row_bytes = in[i].elem_size*IN_PITCH( &in[i], row_len );
+		per_row += depth*row_bytes;
+		fixed   += depth*((in[i].halo_before + in[i].halo_after)*row_bytes + align);
+	}
+	for( i = 0; i < num_out; i++ ) {
+		row_bytes = out[i].elem_size*row_len;
+		per_row += depth*row_bytes;
+		fixed   += depth*align;
+	}
+	if( per_row <= 0 || free_bytes <= fixed ) {
+		return 0;
+	}
+	return (free_bytes - fixed)/per_row;
+}
+int vbw_stream_plan( const vbw_stream_t *in, int num_in, const vbw_stream_t *out, int num_out,
+                     int rows, int row_len, int temp_bytes_per_row, int *depth )
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	const int free_bytes = vbx_sp_getfree();
+	const int align = this_mxp->scratchpad_alignment_bytes;
+	int i, widest = 1, min_rows, chunk, chunks;
+
+	*depth = 1;
+	if( rows <= 0 || row_len <= 0 ) {
+		return 0;
+	}
+
+	// everything at once
+	chunk = stream_fit( in, num_in, out, num_out, row_len, temp_bytes_per_row, 1, free_bytes, align );
+	if( chunk >= rows ) {
+		return rows;
+	}
+
+	// triple buffering if the chunks still fill the lanes for a while,
+	// otherwise double, otherwise no overlap at all
+	for( i = 0; i < num_in; i++ ) {
+		widest = in[i].elem_size > widest ? in[i].elem_size : widest;
+	}
+	for( i = 0; i < num_out; i++ ) {
+		widest = out[i].elem_size > widest ? out[i].elem_size : widest;
+	}
+	min_rows = (VBW_STREAM_MIN_WAVES*this_mxp->vector_lanes*sizeof(vbx_word_t)/widest + row_len-1)/row_len;
+
+	chunk = stream_fit( in, num_in, out, num_out, row_len, temp_bytes_per_row, 3, free_bytes, align );
+	if( chunk >= min_rows ) {
+		*depth = 3;
+	} else {
+		chunk = stream_fit( in, num_in, out, num_out, row_len, temp_bytes_per_row, 2, free_bytes, align );
+		if( chunk > 0 ) {
+			*depth = 2;
+		} else {
+			chunk = stream_fit( in, num_in, out, num_out, row_len, temp_bytes_per_row, 1, free_bytes, align );
+		}
+	}
+	if( chunk <= 0 ) {
+		return 0;
+	}
+
+	// the same number of chunks, as even as possible, so there is no short last chunk
+	chunks = (rows + chunk-1)/chunk;
+	chunk = (rows + chunks-1)/chunks;
+
+	// in place, a chunk's halo rows above must be loaded before the chunks
+	// that write them are written back, which the prefetch does only for
+	// the depth-1 chunks before it
+	if( stream_in_place( in, num_in, out, num_out, rows, row_len ) ) {
+		for( i = 0; i < num_in; i++ ) {
+			if( in[i].halo_before > (*depth-1)*chunk ) {
+				return 0;
+			}
+		}
+	}
+	return chunk;
+}
+
+static void stream_in( const vbw_stream_t *s, vbx_void_t *v_buf, int row, int rows, int row_len )
+{
+	const int row_bytes = s->elem_size*IN_PITCH( s, row_len );
+	char *host = (char *)s->host + ((row - s->halo_before)*s->pitch - s->halo_left)*s->elem_size;
+
+	rows += s->halo_before + s->halo_after;
+	if( s->pitch == IN_PITCH( s, row_len ) || rows == 1 ) {
+		vbx_dma_to_vector( v_buf, host, rows*row_bytes );
+	} else {
+		vbx_dma_to_vector_2D( v_buf, host, row_bytes, rows, row_bytes, s->pitch*s->elem_size );
+	}
+}
+
+static void stream_out( const vbw_stream_t *s, vbx_void_t *v_buf, int row, int rows, int row_len )
+{
+	const int row_bytes = s->elem_size*row_len;
+	char *host = (char *)s->host + row*s->pitch*s->elem_size;
+
+	if( s->pitch == row_len || rows == 1 ) {
+		vbx_dma_to_host( host, v_buf, rows*row_bytes );
+	} else {
+		vbx_dma_to_host_2D( host, v_buf, row_bytes, rows, s->pitch*s->elem_size, row_bytes );
+	}
+}
+
+
+// Queues the chunks of one strip; the caller waits for them
+static int stream_run( const vbw_stream_t *in, int num_in, const vbw_stream_t *out, int num_out,
+                       int rows, int row_len, int col, int temp_bytes_per_row, vbw_stream_fn_t compute, void *arg )
+{
+	vbx_void_t *v_in[VBW_STREAM_MAX][3];
+	vbx_void_t *v_out[VBW_STREAM_MAX][3];
+	vbw_stream_chunk_t chunk;
+	int i, b, c, depth, chunk_rows, chunks, row;
+
+	chunk_rows = vbw_stream_plan( in, num_in, out, num_out, rows, row_len, temp_bytes_per_row, &depth );
+	if( !chunk_rows ) {
+		return -1;
+	}
+
+	vbx_sp_push();
+	for( b = 0; b < depth; b++ ) {
+		for( i = 0; i < num_in; i++ ) {
+			v_in[i][b] = vbx_sp_malloc( (chunk_rows + in[i].halo_before + in[i].halo_after)*in[i].elem_size*IN_PITCH( &in[i], row_len ) );
+		}
+		for( i = 0; i < num_out; i++ ) {
+			v_out[i][b] = vbx_sp_malloc( chunk_rows*out[i].elem_size*row_len );
+		}
+	}
+	chunk.v_temp = temp_bytes_per_row ? vbx_sp_malloc( (chunk_rows + stream_halo_rows( in, num_in ))*temp_bytes_per_row ) : NULL;
+	chunk.col = col;
+	chunk.row_len = row_len;
+	for( i = 0; i < VBW_STREAM_MAX; i++ ) {
+		chunk.v_in[i] = NULL;
+		chunk.v_out[i] = NULL;
+		chunk.in_pitch[i] = i < num_in ? IN_PITCH( &in[i], row_len ) : 0;
+	}
+
+	// queue the first depth-1 chunks in; each iteration then queues the
+	// chunk depth-1 ahead, the compute, and the chunk out
+	chunks = (rows + chunk_rows-1)/chunk_rows;
+	for( c = 0; c < depth-1 && c < chunks; c++ ) {
+		row = c*chunk_rows;
+		for( i = 0; i < num_in; i++ ) {
+			stream_in( &in[i], v_in[i][c], row, rows-row < chunk_rows ? rows-row : chunk_rows, row_len );
+		}
+	}
+	for( c = 0; c < chunks; c++ ) {
+		if( c+depth-1 < chunks ) {
+			row = (c+depth-1)*chunk_rows;
+			b = (c+depth-1) % depth;
+			for( i = 0; i < num_in; i++ ) {
+				stream_in( &in[i], v_in[i][b], row, rows-row < chunk_rows ? rows-row : chunk_rows, row_len );
+			}
+		}
+
+		b = c % depth;
+		chunk.row  = c*chunk_rows;
+		chunk.rows = rows-chunk.row < chunk_rows ? rows-chunk.row : chunk_rows;
+		for( i = 0; i < num_in; i++ ) {
+			chunk.v_in[i] = (char *)v_in[i][b] + (in[i].halo_before*chunk.in_pitch[i] + in[i].halo_left)*in[i].elem_size;
+		}
+		for( i = 0; i < num_out; i++ ) {
+			chunk.v_out[i] = v_out[i][b];
+		}
+		compute( &chunk, arg );
+
+		for( i = 0; i < num_out; i++ ) {
+			stream_out( &out[i], v_out[i][b], chunk.row, chunk.rows, row_len );
+		}
+	}
+
+	// later allocations reuse these buffers only behind the queued work
+	vbx_sp_pop();
+	return 0;
+}
+
+int vbw_stream( const vbw_stream_t *in, int num_in, const vbw_stream_t *out, int num_out,
+                int rows, int row_len, int temp_bytes_per_row, vbw_stream_fn_t compute, void *arg )
+{
+	int ret;
+
+	if( rows <= 0 ) {
+		return 0;
+	}
+	if( num_in > VBW_STREAM_MAX || num_out > VBW_STREAM_MAX ) {
+		return -1;
+	}
+	ret = stream_run( in, num_in, out, num_out, rows, row_len, 0, temp_bytes_per_row, compute, arg );
+	vbx_sync();
+	return ret;
+}
+
+// Scratchpad bytes per row of the temp for a strip
+static int tiled_temp_bytes( const vbw_stream_t *in, int num_in, int width, int temp_bytes_per_elem )
+{
+	int i, pitch = width;
+	for( i = 0; i < num_in; i++ ) {
+		if( IN_PITCH( &in[i], width ) > pitch ) {
+			pitch = IN_PITCH( &in[i], width );
+		}
+	}
+	return pitch*temp_bytes_per_elem;
+}
+
+int vbw_stream_tiled_plan( const vbw_stream_t *in, int num_in, const vbw_stream_t *out, int num_out,
+                           int rows, int cols, int temp_bytes_per_elem, int *strip_width, int *depth )
+{
+	int i, strips, width, last_width = 0, chunk_rows, min_rows, min_width = 1;
+	int best_rows = 0, best_width = 0, best_depth = 1;
+
+	*strip_width = 0;
+	*depth = 1;
+	if( rows <= 0 || cols <= 0 ) {
+		return 0;
+	}
+
+	// tiles shorter or narrower than this spend most of their DMA on halo
+	min_rows = VBW_STREAM_HALO_RATIO*stream_halo_rows( in, num_in );
+	min_rows = min_rows < 1 ? 1 : min_rows > rows ? rows : min_rows;
+	for( i = 0; i < num_in; i++ ) {
+		if( VBW_STREAM_HALO_RATIO*(in[i].halo_left + in[i].halo_right) > min_width ) {
+			min_width = VBW_STREAM_HALO_RATIO*(in[i].halo_left + in[i].halo_right);
+		}
+	}
+
+	// in place, a strip would overwrite the halo columns of its neighbours
+	if( stream_in_place( in, num_in, out, num_out, rows, cols ) ) {
+		*strip_width = cols;
+		return vbw_stream_plan( in, num_in, out, num_out, rows, cols,
+		                        tiled_temp_bytes( in, num_in, cols, temp_bytes_per_elem ), depth );
+	}
+
+	// the widest strips, as even as possible, whose chunks are tall enough;
+	// failing that, the strips with the most output per chunk
+	for( strips = 1; strips <= cols; strips++ ) {
+		width = (cols + strips-1)/strips;
+		if( width == last_width ) {
+			continue;
+		}
+		last_width = width;
+		chunk_rows = vbw_stream_plan( in, num_in, out, num_out, rows, width,
+		                              tiled_temp_bytes( in, num_in, width, temp_bytes_per_elem ), depth );
+		if( chunk_rows >= min_rows ) {
+			*strip_width = width;
+			return chunk_rows;
+		}
+		if( chunk_rows*width > best_rows*best_width ) {
+			best_rows  = chunk_rows;
+			best_width = width;
+			best_depth = *depth;
+		}
+		if( width < min_width && best_rows ) {
+			break;
+		}
+	}
+	*strip_width = best_width;
+	*depth = best_depth;
+	return best_rows;
+}
+
+int vbw_stream_tiled( const vbw_stream_t *in, int num_in, const vbw_stream_t *out, int num_out,
+                      int rows, int cols, int temp_bytes_per_elem, vbw_stream_fn_t compute, void *arg )
+{
+	vbw_stream_t strip_in[VBW_STREAM_MAX], strip_out[VBW_STREAM_MAX];
+	int i, col, width, depth, ret = 0;
+
+	if( rows <= 0 || cols <= 0 ) {
+		return 0;
+	}
+	if( num_in > VBW_STREAM_MAX || num_out > VBW_STREAM_MAX ) {
+		return -1;
+	}
+	if( !vbw_stream_tiled_plan( in, num_in, out, num_out, rows, cols, temp_bytes_per_elem, &width, &depth ) ) {
+		return -1;
+	}
+
+	for( i = 0; i < num_in; i++ ) {
+		strip_in[i] = in[i];
+	}
+	for( i = 0; i < num_out; i++ ) {
+		strip_out[i] = out[i];
+	}
+	// the next strip's first chunks queue right behind this strip's last
+	for( col = 0; col < cols && !ret; col += width ) {
+		if( col + width > cols ) {
+			width = cols - col;
+		}
+		for( i = 0; i < num_in; i++ ) {
+			strip_in[i].host = (char *)in[i].host + col*in[i].elem_size;
+		}
+		for( i = 0; i < num_out; i++ ) {
+			strip_out[i].host = (char *)out[i].host + col*out[i].elem_size;
+		}
+		ret = stream_run( strip_in, num_in, strip_out, num_out, rows, width, col,
+		                  tiled_temp_bytes( in, num_in, width, temp_bytes_per_elem ), compute, arg );
+	}
+
+	vbx_sync();
+	return ret;
+}
+
+int vbw_stream_zero_border( void *host, int elem_size, int pitch, int width, int height,
+                            int top, int bottom, int left, int right )
+{
+	vbx_ubyte_t *v_zero;
+	char *dst;
+	int n, x, y, c, len, row;
+
+	if( width <= 0 || height <= 0 ) {
+		return 0;
+	}
+	top    = top    > height ? height : top;
+	bottom = bottom > height-top ? height-top : bottom;
+	left   = left   > width ? width : left;
+	right  = right  > width-left ? width-left : right;
+
+	// one zero vector, as long as the longer side if it fits, written in pieces
+	n = width > height ? width : height;
+	if( n*elem_size > vbx_sp_getfree() ) {
+		n = vbx_sp_getfree()/elem_size;
+	}
+	if( n <= 0 ) {
+		return -1;
+	}
+	vbx_sp_push();
+	v_zero = (vbx_ubyte_t *)vbx_sp_malloc( n*elem_size );
+	vbx_set_vl( n*elem_size );
+	vbx( SVBU, VMOV, v_zero, 0, 0 );
+
+	for( row = 0; row < top+bottom; row++ ) {
+		y = row < top ? row : height-bottom + row-top;
+		for( x = 0; x < width; x += n ) {
+			len = width-x < n ? width-x : n;
+			vbx_dma_to_host( (char *)host + (y*pitch + x)*elem_size, v_zero, len*elem_size );
+		}
+	}
+	for( c = 0; c < left+right; c++ ) {
+		x = c < left ? c : width-right + c-left;
+		for( y = top; y < height-bottom; y += n ) {
+			len = height-bottom-y < n ? height-bottom-y : n;
+			dst = (char *)host + (y*pitch + x)*elem_size;
+			vbx_dma_to_host_2D( dst, v_zero, elem_size, len, pitch*elem_size, elem_size );
+		}
+	}
+
+	vbx_sync();
+	vbx_sp_pop();
+	return 0;
+}
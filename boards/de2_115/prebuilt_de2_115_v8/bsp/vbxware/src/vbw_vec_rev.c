@@ -167,7 +167,7 @@ vbx_half_t *vbw_vec_reverse_half( vbx_half_t *v_src, const int N )
 	//vbx_word_t *vwsrc = (vbx_word_t*) ((int)v_src&(~1));
 	vbx_half_t *v_dst = NULL;
 
-	if( !(N&1) && VBX_IS_ALIGNED((int)v_src,4) && N < 4096  ) {
+	if( !(N&1) && VBX_IS_ALIGNED((uintptr_t)v_src,4) && N < 4096  ) {
 		// Fast case: N is even, v_src is word-aligned
 		v_dst = (vbx_half_t *) vbx_sp_malloc( N*sizeof(vbx_half_t) );
 		if( !v_dst ) VBX_EXIT(-1);
@@ -176,7 +176,7 @@ vbx_half_t *vbw_vec_reverse_half( vbx_half_t *v_src, const int N )
 	}
 
 	// if v_src is unaligned, bring it back into alignment first
-	if( VBX_IS_MISALIGNED((int)v_src,4) ) {
+	if( VBX_IS_MISALIGNED((uintptr_t)v_src,4) ) {
 		v_dst = (vbx_half_t *) vbx_sp_malloc( N*sizeof(vbx_half_t) );
 		if( !v_dst ) VBX_EXIT(-1);
 		vbx_sp_push();
@@ -210,7 +210,7 @@ vbx_byte_t *vbw_vec_reverse_byte( vbx_byte_t *v_src, const int N )
 	int NN = N/4 + isOdd;
 	vbx_byte_t *v_dst = NULL;
 
-	if( !(N&3) && VBX_IS_ALIGNED((int)v_src,4) && N < 16384 ) {
+	if( !(N&3) && VBX_IS_ALIGNED((uintptr_t)v_src,4) && N < 16384 ) {
 		// Fast case: N is even, v_src is word-aligned
 		v_dst = (vbx_byte_t *) vbx_sp_malloc( N );
 		if( !v_dst ) VBX_EXIT(-1);
@@ -219,7 +219,7 @@ vbx_byte_t *vbw_vec_reverse_byte( vbx_byte_t *v_src, const int N )
 	}
 
 	// if v_src is unaligned, bring it back into alignment first
-	if( VBX_IS_MISALIGNED((int)v_src,4) ) {
+	if( VBX_IS_MISALIGNED((uintptr_t)v_src,4) ) {
 		v_dst = (vbx_byte_t *) vbx_sp_malloc( N );
 		if( !v_dst ) VBX_EXIT(-1);
 		vbx_sp_push();
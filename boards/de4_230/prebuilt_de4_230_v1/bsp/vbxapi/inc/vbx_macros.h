@@ -86,19 +86,20 @@ extern "C" {
 //#define VPTR_MASK    (~(VECTOR_MEMORY_SIZE*1024-1))
 //#define IS_VPTR(PTR) ( (((vbx_void_t *)PTR)&(VPTR_MASK))==(VBX_SCRATCHPAD_ADDR) )
 
+// These are applied to both sizes and pointers, so use a pointer-sized type.
 #define VBX_PAD_UP(BYTES,ALIGNMENT) \
 	({ \
-		uint32_t __mask__ = ((uint32_t)(ALIGNMENT))-1; \
-		( ((uint32_t)(BYTES)) + __mask__) & ~__mask__; \
+		uintptr_t __mask__ = ((uintptr_t)(ALIGNMENT))-1; \
+		( ((uintptr_t)(BYTES)) + __mask__) & ~__mask__; \
 	})
 
 #define VBX_PAD_DN(BYTES,ALIGNMENT) \
 	({ \
-		uint32_t __mask__ = ((uint32_t)(ALIGNMENT))-1; \
-		((uint32_t)(BYTES))  &  ~__mask__; \
+		uintptr_t __mask__ = ((uintptr_t)(ALIGNMENT))-1; \
+		((uintptr_t)(BYTES))  &  ~__mask__; \
 	})
 
-#define VBX_IS_MISALIGNED(LENGTH,ALIGNMENT)	((((uint32_t)(LENGTH))&((uint32_t)(ALIGNMENT)-1))?1:0)
+#define VBX_IS_MISALIGNED(LENGTH,ALIGNMENT)	((((uintptr_t)(LENGTH))&((uintptr_t)(ALIGNMENT)-1))?1:0)
 #define VBX_IS_ALIGNED(LENGTH,ALIGNMENT)	(!VBX_IS_MISALIGNED((LENGTH),(ALIGNMENT)))
 
 // ---------------------------------
@@ -107,6 +108,14 @@ extern "C" {
 
 // ---------------------------------
 
+#if VBX_RELEASE
+// the inline fast paths in vbx_api.h
+#define VBX_DEBUG_FUNC1(fname,...) \
+	fname##_release(__VA_ARGS__)
+
+#define VBX_DEBUG_FUNC0(fname)\
+	fname##_release()
+#else
 #define VBX_DEBUG_FUNC1(fname,...) \
 	VBX_SKIP_ALL_CHECKS ? \
 		fname##_nodebug(__VA_ARGS__) : \
@@ -116,6 +125,7 @@ extern "C" {
 	VBX_SKIP_ALL_CHECKS ? \
 		fname##_nodebug() : \
 		fname##_debug(__LINE__,__FILE__)
+#endif
 
 /** Malloc in scratchpad.
  *
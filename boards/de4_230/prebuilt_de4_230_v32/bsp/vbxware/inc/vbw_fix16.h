@@ -63,6 +63,7 @@
  */
 
 #include "vbx.h"
+#include "vbw_minmax_all.h"
 
 #define USE_OVERFLOW 1
 typedef fix16_t fxp_t;
@@ -82,16 +83,12 @@ static inline fix16_t fix16_min(fix16_t x, fix16_t y)
 */
 static inline void vbw_fix16_min( vbx_word_t* v_result, vbx_word_t* v_x, vbx_word_t* v_y, vbx_word_t* v_temp )
 {
-  vbx(VVW, VSUB, v_temp, v_y, v_x );
-  vbx(VVW, VCMV_GTZ, v_result, v_y, v_temp);
-  vbx(VVW, VCMV_LEZ, v_result, v_x, v_temp);
+  vbw_min_word( v_result, v_x, v_y, v_temp );
 }
 
 static inline void vbw_fix16_max( vbx_word_t* v_result, vbx_word_t* v_x, vbx_word_t* v_y, vbx_word_t* v_temp )
 {
-  vbx(VVW, VSUB, v_temp, v_y, v_x );
-  vbx(VVW, VCMV_LTZ, v_result, v_y, v_temp);
-  vbx(VVW, VCMV_GEZ, v_result, v_x, v_temp);
+  vbw_max_word( v_result, v_x, v_y, v_temp );
 }
 
 
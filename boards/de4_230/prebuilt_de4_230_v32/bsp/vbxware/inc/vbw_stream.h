@@ -0,0 +1,204 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**
+ * @file
+ * @defgroup Stream Stream
+ * @brief Streaming kernels with double or triple buffered DMA
+ * @ingroup VBXware
+ *
+ * A streaming kernel reads rows from one or more host buffers and writes
+ * the same number of rows to one or more host buffers, a chunk of rows at
+ * a time. @ref vbw_stream sizes the chunks from the free scratchpad,
+ * allocates two or three buffers per stream, and queues the DMA of the
+ * next chunks in and of the last chunks out around the compute of each
+ * chunk, so the DMA engine and the vector unit work at the same time.
+ *
+ * The rows of a chunk are contiguous in the scratchpad, so the compute can
+ * treat them as one vector of rows*row_len elements. 1D data is streamed
+ * as rows of one element.
+ *
+ * @ref vbw_stream_tiled runs a kernel over an image in vertical strips as
+ * narrow as the free scratchpad needs, so rows of any width fit. Inputs
+ * read by a stencil carry a halo: rows above and below each chunk, and
+ * columns left and right of each strip. The compute sees a tile of input
+ * rows @ref vbw_stream_chunk_t::in_pitch elements apart, and writes output
+ * rows of row_len elements.
+ */
+///@{
+
+#ifndef __VBW_STREAM_H
+#define __VBW_STREAM_H
+
+#include "vbx.h"
+
+#define VBW_STREAM_MAX 4 ///< Maximum number of input streams, and of output streams
+
+/// Waves of the vector lanes per chunk below which triple buffering is not worth its smaller chunks
+#define VBW_STREAM_MIN_WAVES 32
+
+/// Tile rows per halo row, and strip columns per halo column, below which a tile is not narrowed further
+#define VBW_STREAM_HALO_RATIO 4
+
+/** A host buffer of rows, read or written by a streaming kernel. */
+typedef struct {
+	void *host;       ///< First row in host memory
+	int   elem_size;  ///< Bytes per element
+	int   pitch;      ///< Elements between the starts of rows in host memory
+	int   halo_before; ///< Input only: rows before each chunk that the compute also reads; they must exist in host memory
+	int   halo_after;  ///< Input only: rows after each chunk that the compute also reads; they must exist in host memory
+	int   halo_left;   ///< Input only: columns left of each row that the compute also reads; they must exist in host memory
+	int   halo_right;  ///< Input only: columns right of each row that the compute also reads; they must exist in host memory
+} vbw_stream_t;
+
+/** A chunk of rows in the scratchpad, passed to the compute function. */
+typedef struct {
+	vbx_void_t *v_in[VBW_STREAM_MAX];  ///< First element of the chunk of each input; its halo is around it
+	vbx_void_t *v_out[VBW_STREAM_MAX]; ///< First row of the chunk of each output
+	vbx_void_t *v_temp; ///< temp_bytes_per_row bytes for each row of the chunk and of the tallest input halo, or NULL
+	int in_pitch[VBW_STREAM_MAX]; ///< Elements between the rows of each input in the scratchpad: row_len plus its halo columns
+	int row;     ///< Index of the first row of the chunk
+	int rows;    ///< Rows in the chunk
+	int col;     ///< Index of the first column of the strip
+	int row_len; ///< Elements per output row
+} vbw_stream_chunk_t;
+
+/** Computes the outputs of one chunk. It only issues vector instructions:
+ *  it must not allocate scratchpad memory, DMA or wait for the MXP.
+ */
+typedef void (*vbw_stream_fn_t)( const vbw_stream_chunk_t *chunk, void *arg );
+
+/** Choose the chunk size and buffer depth of a streaming kernel.
+ *  An output may overwrite an input in place. If the input has halo rows
+ *  above, each chunk then has to be loaded before the chunks whose rows it
+ *  reads are written back, so it needs double or triple buffering unless
+ *  all rows fit in one chunk.
+ *
+ * @param[in] in -- input streams
+ * @param[in] num_in -- number of input streams, up to @ref VBW_STREAM_MAX
+ * @param[in] out -- output streams
+ * @param[in] num_out -- number of output streams, up to @ref VBW_STREAM_MAX
+ * @param[in] rows -- rows to stream
+ * @param[in] row_len -- elements per row, the same for every stream
+ * @param[in] temp_bytes_per_row -- scratchpad bytes the compute needs per row of the chunk and of the tallest input halo
+ * @param[out] depth -- buffers per stream: 3, 2, or 1 if all rows fit in one chunk
+ * @retval rows per chunk, or 0 if not even one row fits in the free scratchpad
+ */
+int vbw_stream_plan( const vbw_stream_t *in, int num_in, const vbw_stream_t *out, int num_out,
+                     int rows, int row_len, int temp_bytes_per_row, int *depth );
+
+/** Run a streaming kernel.
+ *  Queues the DMA of each chunk into the scratchpad ahead of its compute,
+ *  and its DMA back to the host right after, with the buffers and chunk
+ *  size given by @ref vbw_stream_plan. Input halo rows are read again for
+ *  each chunk. Returns when the outputs are in host memory.
+ *
+ * @param[in] in -- input streams
+ * @param[in] num_in -- number of input streams, up to @ref VBW_STREAM_MAX
+ * @param[in] out -- output streams
+ * @param[in] num_out -- number of output streams, up to @ref VBW_STREAM_MAX
+ * @param[in] rows -- rows to stream
+ * @param[in] row_len -- elements per row, the same for every stream
+ * @param[in] temp_bytes_per_row -- scratchpad bytes the compute needs per row of the chunk and of the tallest input halo
+ * @param[in] compute -- called once per chunk, in order
+ * @param[in] arg -- passed to @a compute
+ * @retval 0 if successful; -1 if out of scratchpad memory
+ */
+int vbw_stream( const vbw_stream_t *in, int num_in, const vbw_stream_t *out, int num_out,
+                int rows, int row_len, int temp_bytes_per_row, vbw_stream_fn_t compute, void *arg );
+
+/** Choose the strip width, chunk size and buffer depth of a tiled kernel.
+ *  Strips are only narrower than the image when a chunk of full rows would
+ *  be shorter than @ref VBW_STREAM_HALO_RATIO times the tallest input halo,
+ *  or does not fit at all. An output that overwrites an input with a halo
+ *  in place needs a single strip, as for @ref vbw_stream_plan.
+ *
+ * @param[in] in -- input streams
+ * @param[in] num_in -- number of input streams, up to @ref VBW_STREAM_MAX
+ * @param[in] out -- output streams
+ * @param[in] num_out -- number of output streams, up to @ref VBW_STREAM_MAX
+ * @param[in] rows -- output rows
+ * @param[in] cols -- output columns
+ * @param[in] temp_bytes_per_elem -- scratchpad bytes the compute needs per element of the input tile
+ * @param[out] strip_width -- output columns per strip
+ * @param[out] depth -- buffers per stream, as for @ref vbw_stream_plan
+ * @retval rows per chunk, or 0 if not even one row of a one column strip fits
+ */
+int vbw_stream_tiled_plan( const vbw_stream_t *in, int num_in, const vbw_stream_t *out, int num_out,
+                           int rows, int cols, int temp_bytes_per_elem, int *strip_width, int *depth );
+
+/** Run a tiled kernel.
+ *  Streams each vertical strip of the image in turn, left to right, with
+ *  the strip width and chunk size given by @ref vbw_stream_tiled_plan.
+ *  Input halo rows and columns are read again for each tile. Returns when
+ *  the outputs are in host memory.
+ *
+ * @param[in] in -- input streams
+ * @param[in] num_in -- number of input streams, up to @ref VBW_STREAM_MAX
+ * @param[in] out -- output streams
+ * @param[in] num_out -- number of output streams, up to @ref VBW_STREAM_MAX
+ * @param[in] rows -- output rows
+ * @param[in] cols -- output columns
+ * @param[in] temp_bytes_per_elem -- scratchpad bytes the compute needs per element of the input tile
+ * @param[in] compute -- called once per tile
+ * @param[in] arg -- passed to @a compute
+ * @retval 0 if successful; -1 if out of scratchpad memory
+ */
+int vbw_stream_tiled( const vbw_stream_t *in, int num_in, const vbw_stream_t *out, int num_out,
+                      int rows, int cols, int temp_bytes_per_elem, vbw_stream_fn_t compute, void *arg );
+
+/** Zero the border of a host image.
+ *  Clears the first @a top and last @a bottom rows, and the first @a left
+ *  and last @a right columns of the rows between, for the pixels a stencil
+ *  kernel does not compute. Returns when the border is in host memory.
+ *
+ * @param[out] host -- first row of the image
+ * @param[in] elem_size -- bytes per element
+ * @param[in] pitch -- elements between the starts of rows
+ * @param[in] width -- image columns
+ * @param[in] height -- image rows
+ * @param[in] top -- rows to clear at the top
+ * @param[in] bottom -- rows to clear at the bottom
+ * @param[in] left -- columns to clear at the left
+ * @param[in] right -- columns to clear at the right
+ * @retval 0 if successful; -1 if out of scratchpad memory
+ */
+int vbw_stream_zero_border( void *host, int elem_size, int pitch, int width, int height,
+                            int top, int bottom, int left, int right );
+
+#endif // __VBW_STREAM_H
+///@}
@@ -46,5 +46,13 @@ void VBX_T(vbw_vec_fir_1d)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs,
 
 void VBX_T(vbw_vec_fir_2d)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs, const int sample_size, const int num_taps);
 
+void VBX_T(vbw_vec_fir_1d_sp)(vbx_mm_t *output, vbx_mm_t *input, vbx_sp_t *v_coeffs, const int sample_size, const int num_taps);
+
+void VBX_T(vbw_vec_fir_2d_sp)(vbx_mm_t *output, vbx_mm_t *input, vbx_sp_t *v_coeffs, const int sample_size, const int num_taps);
+
 void VBX_T(vbw_vec_fir_transpose)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs, const int sample_size, const int num_taps);
 
+int VBX_T(vbw_vec_fir)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs, const int sample_size, const int num_taps, const int num_channels);
+
+int VBX_T(vbw_vec_fir_sp)(vbx_mm_t *output, vbx_mm_t *input, vbx_mm_t *coeffs, vbx_sp_t *v_coeffs, const int sample_size, const int num_taps, const int num_channels);
+
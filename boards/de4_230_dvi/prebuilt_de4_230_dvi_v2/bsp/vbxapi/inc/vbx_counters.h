@@ -34,14 +34,14 @@
 #  define VBX_GET_DMA_QUEUE_STALL_CYCLES()  _GET_COUNTER( VBX_STATUS_DMA_QUEUE_STALL_CYCLES)
 #  define VBX_COUNTER_RESET()               _GET_COUNTER( VBX_STATUS_RESET)
 #elif VBX_SIMULATOR
-#  define VBX_GET_TOTAL_CYCLES()            0
+#  define VBX_GET_TOTAL_CYCLES()            vbxsim_get_total_cycles()
 #  define VBX_GET_WRITEBACK_CYCLES()        vbxsim_get_instr_cycles(-1,VBX_GET_THIS_MXP()->vector_lanes)
 #  define VBX_GET_INSTRUCTIONS()            vbxsim_get_instr_count(-1)
 #  define VBX_GET_DMA_CYCLES()              vbxsim_get_dma_cycles(VBX_GET_THIS_MXP()->dma_alignment_bytes /4)
 #  define VBX_GET_DMAS()                    vbxsim_get_dma_count()
-#  define VBX_GET_INSTR_HAZARD_CYCLES()     0
-#  define VBX_GET_DMA_HAZARD_CYCLES()       0
-#  define VBX_GET_DMA_QUEUE_STALL_CYCLES()  0
+#  define VBX_GET_INSTR_HAZARD_CYCLES()     vbxsim_get_instr_hazard_cycles()
+#  define VBX_GET_DMA_HAZARD_CYCLES()       vbxsim_get_dma_hazard_cycles()
+#  define VBX_GET_DMA_QUEUE_STALL_CYCLES()  vbxsim_get_dma_queue_stall_cycles()
 #  define VBX_COUNTER_RESET()               vbxsim_reset_counts()
 #endif
 
@@ -76,14 +76,14 @@ static inline struct vbx_counters get_counter_snapshot() {
 #elif VBX_SIMULATOR
 static inline struct vbx_counters get_counter_snapshot() {
 	struct vbx_counters to_ret;
-	to_ret.total_cycles          = 0;
+	to_ret.total_cycles          = vbxsim_get_total_cycles();
 	to_ret.writeback_cycles      = vbxsim_get_instr_cycles(-1,VBX_GET_THIS_MXP()->vector_lanes);
 	to_ret.instructions          = vbxsim_get_instr_count(-1);
 	to_ret.dma_cycles            = vbxsim_get_dma_cycles(VBX_GET_THIS_MXP()->dma_alignment_bytes /4);
 	to_ret.dmas                  = vbxsim_get_dma_count();
-	to_ret.instr_hazard_cycles   = 0;
-	to_ret.dma_hazard_cycles     = 0;
-	to_ret.dma_queue_stall_cycles= 0;
+	to_ret.instr_hazard_cycles   = vbxsim_get_instr_hazard_cycles();
+	to_ret.dma_hazard_cycles     = vbxsim_get_dma_hazard_cycles();
+	to_ret.dma_queue_stall_cycles= vbxsim_get_dma_queue_stall_cycles();
 	return to_ret;
 }
 #endif
@@ -53,6 +53,31 @@ extern "C" {
 
 void vbx_sync();
 
+/** A point in the stream of vector instructions and DMA transfers, see @ref vbx_fence */
+typedef uint32_t vbx_fence_t;
+
+/** Insert a fence after all instructions and DMA transfers issued so far.
+ *  Unlike @ref vbx_sync, the host does not wait. The fence is complete when
+ *  everything issued before it has finished, including DMA transfers to the
+ *  host; fences complete in the order they were inserted.
+ *
+ * @retval fence, for @ref vbx_fence_done and @ref vbx_fence_wait
+ */
+vbx_fence_t vbx_fence();
+
+/** Test, without blocking, whether a fence is complete.
+ *
+ * @param[in] fence
+ * @retval 1 if everything issued before @a fence has finished, otherwise 0
+ */
+int  vbx_fence_done( vbx_fence_t fence );
+
+/** Wait until a fence is complete. Work issued after the fence may still be running.
+ *
+ * @param[in] fence
+ */
+void vbx_fence_wait( vbx_fence_t fence );
+
 /** Set the 1D length of vector to operate on.
  *  NOTE: don't call this directly, call through vbx_set_vl macro.
  * @param[in] LENGTH -- number of units to operate on
@@ -191,6 +216,78 @@ int  vbx_sp_checkmark( uint32_t mark );
 vbx_void_t *vbx_sp_malloc_extra( size_t num_bytes);
 void        vbx_sp_free_extra( vbx_void_t *old_sp );
 
+/** Find or create a pool of scratchpad heap blocks.
+ *  The heap keeps data in the scratchpad across kernels: its blocks are
+ *  taken from the top of the scratchpad and are not affected by
+ *  @ref vbx_sp_pop or @ref vbx_sp_free, and they can be freed in any order.
+ *  Pools group blocks by purpose, for the statistics, and give them an alignment.
+ *
+ * @param[in] name -- looked up by content, it must stay valid
+ * @param[in] alignment -- of the blocks, in bytes: a power of 2, or 0 for the scratchpad alignment
+ * @retval the pool, or NULL if there is no room for another pool
+ */
+vbx_sp_pool_t *vbx_sp_pool( const char *name, int alignment );
+
+/** Allocate a scratchpad heap block.
+ *  The space comes from holes left by freed blocks if one fits, otherwise
+ *  from the free space of @ref vbx_sp_malloc, which shrinks accordingly.
+ *
+ * @param[in] pool -- from @ref vbx_sp_pool, or NULL for the default pool
+ * @param[in] num_bytes
+ * @retval the block, or NULL if the scratchpad is full
+ */
+vbx_void_t *vbx_sp_heap_malloc( vbx_sp_pool_t *pool, size_t num_bytes );
+
+/** Free a scratchpad heap block. Free space at the bottom of the heap goes back to @ref vbx_sp_malloc.
+ *
+ * @param[in] addr -- from @ref vbx_sp_heap_malloc
+ */
+void vbx_sp_heap_free( vbx_void_t *addr );
+
+/** Get the size, use and fragmentation of the scratchpad heap.
+ *
+ * @param[out] stats
+ */
+void vbx_sp_heap_stats( vbx_sp_heap_stats_t *stats );
+
+/** Print the scratchpad heap statistics and the use of each pool. */
+void vbx_sp_heap_print();
+
+/** Get a scratchpad copy of a read-only host buffer, keyed on its address and size.
+ *  The copy is kept in the scratchpad heap, in pool "cache", between calls, so
+ *  a kernel that gets the same coefficient table or LUT on every call only
+ *  DMAs it in the first time. The entry is locked until @ref vbx_sp_cache_put;
+ *  unlocked entries are evicted, least recently used first, when the heap or
+ *  @ref vbx_sp_malloc needs their space.
+ *  The host buffer must not change while it is resident, see @ref vbx_sp_cache_invalidate.
+ *
+ * @param[in] host_ptr
+ * @param[in] num_bytes
+ * @retval the scratchpad copy, or NULL if it does not fit; the caller then DMAs the buffer itself
+ */
+vbx_void_t *vbx_sp_cache_get( const void *host_ptr, size_t num_bytes );
+
+/** Unlock an entry from @ref vbx_sp_cache_get, leaving it resident.
+ *
+ * @param[in] v_ptr -- from @ref vbx_sp_cache_get
+ */
+void vbx_sp_cache_put( vbx_void_t *v_ptr );
+
+/** Drop the entries of a host buffer that has changed. They must be unlocked.
+ *
+ * @param[in] host_ptr
+ */
+void vbx_sp_cache_invalidate( const void *host_ptr );
+
+/** Drop all unlocked entries, giving their space back. */
+void vbx_sp_cache_flush();
+
+/** Get the residency cache counters.
+ *
+ * @param[out] stats
+ */
+void vbx_sp_cache_stats( vbx_sp_cache_stats_t *stats );
+
 #if VBX_ASSEMBLER
 // Dummy calls (only used for the simulator)
 #define vbxsim_init(num_lanes, \
@@ -25,7 +25,8 @@
 
 #endif //VBX_RTC_ALL
 
-#if defined ( VBX_RTC_NONE ) || defined ( SKIP_ALL_CHECKS )
+// a release build has no runtime checks, see VBX_RELEASE in vbx_extern.h
+#if defined ( VBX_RTC_NONE ) || defined ( SKIP_ALL_CHECKS ) || VBX_RELEASE
 
 #ifdef VBX_RTC_SP_BOUNDS
 #undef VBX_RTC_SP_BOUNDS
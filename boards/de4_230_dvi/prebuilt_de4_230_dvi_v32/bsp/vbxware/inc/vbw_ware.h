@@ -51,11 +51,14 @@
 #include "vbw_vec_rev.h"
 #include "vbx_math_all.h"
 #include "vbw_mtx_fir_all.h"
+#include "vbw_mtx_conv_all.h"
 #include "vbw_mtx_median_all.h"
 #include "vbw_mtx_mm_all.h"
 #include "vbw_mtx_xp_all.h"
 #include "vbw_vec_fir_all.h"
 #include "vbw_vec_copy_all.h"
+#include "vbw_minmax_all.h"
+#include "vbw_stream.h"
 #include "vbw_fix16.h"
 
 #endif //__VBX_WARE_H
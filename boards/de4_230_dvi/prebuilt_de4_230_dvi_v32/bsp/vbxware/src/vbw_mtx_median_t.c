@@ -55,16 +55,108 @@
 		VBX_TEMPLATE_T==VBX_UWORDSIZE_DEF )
 
 #include "vbw_mtx_median_t.h"
+#include "vbw_minmax_t.h"
 
+#ifndef VBW_MTX_MEDIAN_ONLY_ONCE
+#define VBW_MTX_MEDIAN_ONLY_ONCE
 
-/** VBX median filter using bubble sort.
+// Compare-exchange of slots a and b: CE leaves the smaller value in a and the
+// larger in b. MIN and MAX compute only the output that is used later.
+enum { VBW_MEDIAN_CE, VBW_MEDIAN_MIN, VBW_MEDIAN_MAX };
+
+typedef struct {
+	unsigned char a, b, op;
+} vbw_median_cmp_t;
+
+typedef struct {
+	short size;                   ///< filter height and width
+	short out;                    ///< slot of the median
+	short ncols;                  ///< compare-exchanges in cols
+	short nsel;                   ///< compare-exchanges in sel
+	const vbw_median_cmp_t *cols; ///< sorts a column of the window, by row
+	const vbw_median_cmp_t *sel;  ///< selects the median from the sorted columns, by slot
+} vbw_median_net_t;
+
+// Median selection networks for square filters. Slot c*size+r is the pixel in
+// row r, column c of the window. The columns are sorted first, then each rank
+// across the columns. That leaves a matrix sorted along both directions, and
+// an odd-even merge network selects the median from the slots that can still
+// hold it. Comparators that do not lead to the median have been pruned. Both
+// networks were checked on every 0-1 input.
+static const vbw_median_cmp_t vbw_median_sort3[] = {
+	{0,1,VBW_MEDIAN_CE}, {1,2,VBW_MEDIAN_CE}, {0,1,VBW_MEDIAN_CE}
+};
+
+static const vbw_median_cmp_t vbw_median_sel3[] = {
+	{0,3,VBW_MEDIAN_MAX}, {3,6,VBW_MEDIAN_MAX}, {1,4,VBW_MEDIAN_CE},  {4,7,VBW_MEDIAN_MIN},
+	{1,4,VBW_MEDIAN_MAX}, {2,5,VBW_MEDIAN_CE},  {5,8,VBW_MEDIAN_MIN}, {2,5,VBW_MEDIAN_MIN},
+	{2,4,VBW_MEDIAN_CE},  {2,6,VBW_MEDIAN_MAX}, {4,6,VBW_MEDIAN_MIN}
+};
+
+static const vbw_median_cmp_t vbw_median_sort5[] = {
+	{0,1,VBW_MEDIAN_CE}, {3,4,VBW_MEDIAN_CE}, {2,4,VBW_MEDIAN_CE},
+	{2,3,VBW_MEDIAN_CE}, {0,3,VBW_MEDIAN_CE}, {0,2,VBW_MEDIAN_CE},
+	{1,4,VBW_MEDIAN_CE}, {1,3,VBW_MEDIAN_CE}, {1,2,VBW_MEDIAN_CE}
+};
+
+static const vbw_median_cmp_t vbw_median_sel5[] = {
+	{ 0, 5,VBW_MEDIAN_CE},  {15,20,VBW_MEDIAN_CE},  {10,20,VBW_MEDIAN_CE},  {10,15,VBW_MEDIAN_MAX},
+	{ 0,15,VBW_MEDIAN_MAX}, { 5,20,VBW_MEDIAN_CE},  { 5,15,VBW_MEDIAN_MAX}, { 1, 6,VBW_MEDIAN_CE},
+	{16,21,VBW_MEDIAN_CE},  {11,21,VBW_MEDIAN_CE},  {11,16,VBW_MEDIAN_CE},  { 1,16,VBW_MEDIAN_CE},
+	{ 1,11,VBW_MEDIAN_MAX}, { 6,21,VBW_MEDIAN_CE},  { 6,16,VBW_MEDIAN_CE},  { 6,11,VBW_MEDIAN_MAX},
+	{ 2, 7,VBW_MEDIAN_CE},  {17,22,VBW_MEDIAN_CE},  {12,22,VBW_MEDIAN_CE},  {12,17,VBW_MEDIAN_CE},
+	{ 2,17,VBW_MEDIAN_CE},  { 2,12,VBW_MEDIAN_MAX}, { 7,22,VBW_MEDIAN_MIN}, { 7,17,VBW_MEDIAN_CE},
+	{ 7,12,VBW_MEDIAN_CE},  { 3, 8,VBW_MEDIAN_CE},  {18,23,VBW_MEDIAN_CE},  {13,23,VBW_MEDIAN_CE},
+	{13,18,VBW_MEDIAN_CE},  { 3,18,VBW_MEDIAN_CE},  { 3,13,VBW_MEDIAN_CE},  { 8,23,VBW_MEDIAN_MIN},
+	{ 8,18,VBW_MEDIAN_MIN}, { 8,13,VBW_MEDIAN_CE},  { 4, 9,VBW_MEDIAN_CE},  {19,24,VBW_MEDIAN_CE},
+	{14,24,VBW_MEDIAN_CE},  {14,19,VBW_MEDIAN_CE},  { 4,19,VBW_MEDIAN_CE},  { 4,14,VBW_MEDIAN_CE},
+	{ 9,24,VBW_MEDIAN_MIN}, { 9,19,VBW_MEDIAN_MIN}, { 9,14,VBW_MEDIAN_MIN}, { 3, 4,VBW_MEDIAN_CE},
+	{ 7, 8,VBW_MEDIAN_CE},  { 9,11,VBW_MEDIAN_CE},  {12,13,VBW_MEDIAN_CE},  {15,16,VBW_MEDIAN_CE},
+	{17,20,VBW_MEDIAN_CE},  { 3, 7,VBW_MEDIAN_CE},  { 4, 8,VBW_MEDIAN_CE},  { 9,12,VBW_MEDIAN_CE},
+	{11,13,VBW_MEDIAN_CE},  {15,17,VBW_MEDIAN_CE},  {16,20,VBW_MEDIAN_CE},  { 4, 7,VBW_MEDIAN_CE},
+	{11,12,VBW_MEDIAN_CE},  {16,17,VBW_MEDIAN_CE},  { 3, 9,VBW_MEDIAN_CE},  { 4,11,VBW_MEDIAN_CE},
+	{ 7,12,VBW_MEDIAN_CE},  { 8,13,VBW_MEDIAN_MIN}, {15,21,VBW_MEDIAN_CE},  { 7, 9,VBW_MEDIAN_CE},
+	{ 8,11,VBW_MEDIAN_CE},  {17,21,VBW_MEDIAN_CE},  { 4, 7,VBW_MEDIAN_CE},  { 8, 9,VBW_MEDIAN_CE},
+	{11,12,VBW_MEDIAN_CE},  {16,17,VBW_MEDIAN_CE},  {20,21,VBW_MEDIAN_CE},  { 3,15,VBW_MEDIAN_MAX},
+	{ 4,16,VBW_MEDIAN_MAX}, { 7,17,VBW_MEDIAN_MAX}, { 8,20,VBW_MEDIAN_MIN}, { 9,21,VBW_MEDIAN_MIN},
+	{ 9,15,VBW_MEDIAN_MAX}, {11,16,VBW_MEDIAN_MIN}, {12,17,VBW_MEDIAN_MIN}, { 8,11,VBW_MEDIAN_MAX},
+	{12,15,VBW_MEDIAN_MIN}, {11,12,VBW_MEDIAN_MAX}
+};
+
+#define VBW_MEDIAN_NET_LEN(x) ((short)(sizeof(x)/sizeof((x)[0])))
+
+static const vbw_median_net_t vbw_median_nets[] = {
+	{ 3,  4, VBW_MEDIAN_NET_LEN(vbw_median_sort3), VBW_MEDIAN_NET_LEN(vbw_median_sel3), vbw_median_sort3, vbw_median_sel3 },
+	{ 5, 12, VBW_MEDIAN_NET_LEN(vbw_median_sort5), VBW_MEDIAN_NET_LEN(vbw_median_sel5), vbw_median_sort5, vbw_median_sel5 },
+};
+
+#define VBW_MEDIAN_MAX_SLOTS 25
+
+static const vbw_median_net_t *vbw_median_network( const int filter_height, const int filter_width )
+{
+	int n;
+	if( filter_height != filter_width ) {
+		return NULL;
+	}
+	for( n = 0; n < VBW_MEDIAN_NET_LEN(vbw_median_nets); n++ ) {
+		if( vbw_median_nets[n].size == filter_height ) {
+			return &vbw_median_nets[n];
+		}
+	}
+	return NULL;
+}
+
+#endif // VBW_MTX_MEDIAN_ONLY_ONCE
+
+
+/** VBX median filter using bubble sort, for the filters without a network.
  * Does essentially the same thing as the scalar median,
  * but on a vbx worth of pixels at a time
  *
  * @param[in] input.
  * @param[out] output.
  */
-void VBX_T(vbw_mtx_median)(vbx_mm_t *output, vbx_mm_t *input, const short filter_height, const short filter_width, const short image_height, const short image_width, const short image_pitch)
+static void VBX_T(vbw_mtx_median_bubble)(vbx_mm_t *output, vbx_mm_t *input, const short filter_height, const short filter_width, const short image_height, const short image_width, const short image_pitch)
 {
 	int l,k;
 	int filter_mid, filter_size;
@@ -75,11 +167,10 @@ void VBX_T(vbw_mtx_median)(vbx_mm_t *output, vbx_mm_t *input, const short filter
 	filter_mid = filter_size/2;
 
 	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
-	const int VBX_WIDTH_BYTES = this_mxp->vector_lanes * sizeof(int);
-	const int VBX_DMA_ALIGN   = this_mxp->dma_alignment_bytes;
+	const int VBX_SP_ALIGN = this_mxp->scratchpad_alignment_bytes;
 
-	vl = this_mxp->scratchpad_size/((filter_size+2)*sizeof(vbx_sp_t));
-	vl = VBX_PAD_UP(vl,VBX_DMA_ALIGN) - (VBX_WIDTH_BYTES/sizeof(vbx_sp_t));
+	// a vector per window element, and v_temp
+	vl = (vbx_sp_getfree() - (filter_size+1)*VBX_SP_ALIGN) / ((filter_size+1)*(int)sizeof(vbx_sp_t));
 
 	if(vl < image_width){
 		rows_per_l = 1;
@@ -89,18 +180,29 @@ void VBX_T(vbw_mtx_median)(vbx_mm_t *output, vbx_mm_t *input, const short filter
 		vl = image_width*rows_per_l;
 	}
 
+	if( vl <= filter_width ) {
+		VBX_PRINTF( "ERROR: out of memory\n" );
+		return;
+	}
+
+	vbx_sp_push();
 	vbx_sp_t *v_input = (vbx_sp_t *)vbx_sp_malloc(filter_size*vl*sizeof(vbx_sp_t));
-	vbx_sp_t *v_sub   = (vbx_sp_t *)vbx_sp_malloc(vl*sizeof(vbx_sp_t));
 	vbx_sp_t *v_temp  = (vbx_sp_t *)vbx_sp_malloc(vl*sizeof(vbx_sp_t));
 	vbx_sp_t *v_min,*v_max;
 
+	if( v_input == NULL || v_temp == NULL ) {
+		vbx_sp_pop();
+		VBX_PRINTF( "ERROR: out of memory\n" );
+		return;
+	}
+
 	for(l = 0; l < image_height-filter_height; l+= rows_per_l){
 		if(l+rows_per_l > image_height-filter_height){
 			rows_per_l = (image_height-filter_height)-l;
 			vl = image_width*rows_per_l;
 		}
 		temp_vl = vl;
-		for(k = 0; k < image_width; k += temp_vl){
+		for(k = 0; ; k += temp_vl-(filter_width-1)){
 			if(rows_per_l == 1){
 				if(k + temp_vl > image_width){
 					temp_vl = image_width - k;
@@ -120,8 +222,8 @@ void VBX_T(vbw_mtx_median)(vbx_mm_t *output, vbx_mm_t *input, const short filter
 			}
 			vbx_set_vl(temp_vl);
 
-			for(j = 1; j < filter_height; j++){
-				for(i = 0; i < filter_width; i++){
+			for(j = 1; j < filter_width; j++){
+				for(i = 0; i < filter_height; i++){
 					vbx(VV(T),VMOV,v_input+(j*filter_height+i)*temp_vl,
 								  v_input+i*temp_vl+j,
 								  0);
@@ -135,18 +237,14 @@ void VBX_T(vbw_mtx_median)(vbx_mm_t *output, vbx_mm_t *input, const short filter
 				for(i = j+1; i < filter_size; i++){
 					v_max = v_input+i*temp_vl;
 
-					vbx(VV(T),VMOV,v_temp,v_min,0);
-					vbx(VV(T),VSUB,v_sub,v_max,v_min);
-					vbx(VV(T),VCMV_LTZ,v_min,v_max,v_sub);
-					vbx(VV(T),VCMV_LTZ,v_max,v_temp,v_sub);
+					VBX_T(vbw_cmpx)(v_min,v_max,v_min,v_max,v_temp);
 				}
 			}
 
 			v_min = v_input+filter_mid*temp_vl;
 			for(i = filter_mid+1; i < filter_size; i++){
 				v_max = v_input+i*temp_vl;
-				vbx(VV(T),VSUB,v_sub,v_max,v_min);
-				vbx(VV(T),VCMV_LTZ,v_min,v_max,v_sub);
+				VBX_T(vbw_min)(v_min,v_min,v_max,v_temp);
 			}
 
 
@@ -159,10 +257,165 @@ void VBX_T(vbw_mtx_median)(vbx_mm_t *output, vbx_mm_t *input, const short filter
 							   rows_per_l,
 							   image_pitch*sizeof(vbx_mm_t),
 							   image_width*sizeof(vbx_mm_t));
+
+			// the last filter_width-1 outputs of a chunk read past its pixels,
+			// so the next chunk starts over at them
+			if(k + temp_vl >= image_width){
+				break;
+			}
+		}
+	}
+
+	vbx_sp_pop();
+	vbx_sync();
+}
+
+/** VBX median filter.
+ * 3x3 and 5x5 filters use a median selection network. The columns of every
+ * window are sorted at once by sorting the filter rows against each other,
+ * and each window then reads its columns as views shifted into those rows.
+ * Other filter shapes fall back to a bubble sort.
+ *
+ * @param[in] input.
+ * @param[out] output.
+ */
+void VBX_T(vbw_mtx_median)(vbx_mm_t *output, vbx_mm_t *input, const short filter_height, const short filter_width, const short image_height, const short image_width, const short image_pitch)
+{
+	const vbw_median_net_t *net = vbw_median_network( filter_height, filter_width );
+	vbx_sp_t *v_slot[VBW_MEDIAN_MAX_SLOTS];
+	vbx_sp_t *v_own[VBW_MEDIAN_MAX_SLOTS];
+	int owned[VBW_MEDIAN_MAX_SLOTS];
+	int l,k,n;
+	int filter_size, num_owned, num_bufs;
+	int rows_per_l,vl,temp_vl;
+	int j,i;
+
+	if( net == NULL ) {
+		VBX_T(vbw_mtx_median_bubble)( output, input, filter_height, filter_width, image_height, image_width, image_pitch );
+		return;
+	}
+
+	filter_size = filter_height*filter_width;
+
+	// a slot gets a vector of its own only if the network writes it
+	for( i = 0; i < filter_size; i++ ) {
+		owned[i] = 0;
+	}
+	for( n = 0; n < net->nsel; n++ ) {
+		if( net->sel[n].op != VBW_MEDIAN_MAX ) owned[net->sel[n].a] = 1;
+		if( net->sel[n].op != VBW_MEDIAN_MIN ) owned[net->sel[n].b] = 1;
+	}
+	num_owned = 0;
+	for( i = 0; i < filter_size; i++ ) {
+		num_owned += owned[i];
+	}
+
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	const int VBX_SP_ALIGN = this_mxp->scratchpad_alignment_bytes;
+
+	// filter rows, owned slots and v_temp; the last row needs
+	// filter_width-1 more elements for the shifted views
+	num_bufs = filter_height + num_owned + 1;
+	vl = (vbx_sp_getfree() - num_bufs*VBX_SP_ALIGN - filter_width*(int)sizeof(vbx_sp_t)) / (num_bufs*(int)sizeof(vbx_sp_t));
+
+	if(vl < image_width){
+		rows_per_l = 1;
+	}
+	else {
+		rows_per_l = vl/image_width;
+		vl = image_width*rows_per_l;
+	}
+
+	if( vl <= filter_width ) {
+		VBX_PRINTF( "ERROR: out of memory\n" );
+		return;
+	}
+
+	vbx_sp_push();
+	vbx_sp_t *v_input = (vbx_sp_t *)vbx_sp_malloc((filter_height*vl+filter_width)*sizeof(vbx_sp_t));
+	vbx_sp_t *v_temp  = (vbx_sp_t *)vbx_sp_malloc(vl*sizeof(vbx_sp_t));
+	int oom = v_input == NULL || v_temp == NULL;
+	for( i = 0; i < filter_size; i++ ) {
+		v_own[i] = owned[i] ? (vbx_sp_t *)vbx_sp_malloc(vl*sizeof(vbx_sp_t)) : NULL;
+		oom |= owned[i] && v_own[i] == NULL;
+	}
+	if( oom ) {
+		vbx_sp_pop();
+		VBX_PRINTF( "ERROR: out of memory\n" );
+		return;
+	}
+
+	for(l = 0; l < image_height-filter_height; l+= rows_per_l){
+		if(l+rows_per_l > image_height-filter_height){
+			rows_per_l = (image_height-filter_height)-l;
+			vl = image_width*rows_per_l;
+		}
+		temp_vl = vl;
+		for(k = 0; ; k += temp_vl-(filter_width-1)){
+			if(rows_per_l == 1){
+				if(k + temp_vl > image_width){
+					temp_vl = image_width - k;
+				}
+			}
+
+			for(j = 0; j < filter_height; j++){
+				vbx_dma_to_vector_2D(v_input+temp_vl*j,
+									 input+(l+j)*image_pitch+k,
+									 temp_vl/rows_per_l*sizeof(vbx_mm_t),
+									 rows_per_l,
+									 image_width*sizeof(vbx_mm_t),
+									 image_pitch*sizeof(vbx_mm_t));
+			}
+			vbx_set_vl(temp_vl);
+
+			// sorting the rows against each other sorts the columns of all windows
+			for(n = 0; n < net->ncols; n++){
+				vbx_sp_t *v_a = v_input+net->cols[n].a*temp_vl;
+				vbx_sp_t *v_b = v_input+net->cols[n].b*temp_vl;
+				VBX_T(vbw_cmpx)(v_a, v_b, v_a, v_b, v_temp);
+			}
+
+			// column j of the window starts j elements into the rows
+			for(j = 0; j < filter_width; j++){
+				for(i = 0; i < filter_height; i++){
+					v_slot[j*filter_height+i] = v_input+i*temp_vl+j;
+				}
+			}
+
+			for(n = 0; n < net->nsel; n++){
+				const int a = net->sel[n].a;
+				const int b = net->sel[n].b;
+				switch(net->sel[n].op){
+				case VBW_MEDIAN_CE:
+					VBX_T(vbw_cmpx)(v_own[a], v_own[b], v_slot[a], v_slot[b], v_temp);
+					break;
+				case VBW_MEDIAN_MIN:
+					VBX_T(vbw_min)(v_own[a], v_slot[a], v_slot[b], v_temp);
+					break;
+				default:
+					VBX_T(vbw_max)(v_own[b], v_slot[a], v_slot[b], v_temp);
+					break;
+				}
+				if(net->sel[n].op != VBW_MEDIAN_MAX) v_slot[a] = v_own[a];
+				if(net->sel[n].op != VBW_MEDIAN_MIN) v_slot[b] = v_own[b];
+			}
+
+			vbx_dma_to_host_2D(output+(l*image_pitch)+k,
+							   v_slot[net->out],
+							   temp_vl/rows_per_l*sizeof(vbx_mm_t),
+							   rows_per_l,
+							   image_pitch*sizeof(vbx_mm_t),
+							   image_width*sizeof(vbx_mm_t));
+
+			// the last filter_width-1 outputs of a chunk read past its pixels,
+			// so the next chunk starts over at them
+			if(k + temp_vl >= image_width){
+				break;
+			}
 		}
 	}
 
-	vbx_sp_free();
+	vbx_sp_pop();
 	vbx_sync();
 }
 
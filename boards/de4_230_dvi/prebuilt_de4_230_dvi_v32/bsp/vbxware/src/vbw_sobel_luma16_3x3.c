@@ -41,22 +41,71 @@ VBXCOPYRIGHT(vbw_sobel_luma16_3x3)
 
 #include "vbx.h"
 #include "vbw_mtx_sobel.h"
+#include "vbw_stream.h"
 
 
-/// Apply [1 2 1] low-pass filter to raw input row
-/// NB: Last two output pixels are not meaningful
-static inline void vbw_sobel_3x3_row(vbx_uhalf_t *lpf, vbx_uhalf_t *raw, const short image_width)
+/// Sobel edges of a tile of luma with a one pixel halo
+/// v_luma is the first pixel of the tile; its rows are pitch apart
+/// Trashes v_a and v_b, each (rows+2)*pitch halfwords
+static void vbw_sobel_3x3_tile(vbx_uword_t *v_out, vbx_uhalf_t *v_luma, vbx_uhalf_t *v_a, vbx_uhalf_t *v_b,
+                               const int rows, const int width, const int pitch, const short renorm)
 {
-	vbx_set_vl(image_width-1);
-	vbx(VVHU, VADD, lpf, raw, raw+1);
-	vbx_set_vl(image_width-2);
-	vbx(VVHU, VADD, lpf, lpf, lpf+1);
+	// The tile is processed as one vector; each result j = y*pitch+x is the
+	// pixel at row y, column x, and the columns past width are not meaningful
+	vbx_uhalf_t *v_top = v_luma - pitch - 1;
+	const int n = (rows+2)*pitch;
+	const int m = rows*pitch - 2;
+
+	// Calculate gradient_x
+	// Apply [1 2 1]T matrix to all columns, then difference each column with the 2nd column to the right
+	vbx_set_vl(rows*pitch);
+	vbx(SVHU, VSHL, v_b, 1,   v_top+pitch); // multiply by 2
+	vbx(VVHU, VADD, v_b, v_b, v_top);
+	vbx(VVHU, VADD, v_b, v_b, v_top+2*pitch);
+	vbx_set_vl(m);
+	vbx(VVH, VABSDIFF, (vbx_half_t*)v_b, (vbx_half_t*)v_b, (vbx_half_t*)v_b+2);
+
+	// Calculate gradient_y
+	// Apply [1 2 1] matrix to all rows, then difference each row with the 2nd row below
+	vbx_set_vl(n-1);
+	vbx(VVHU, VADD, v_a, v_top, v_top+1);
+	vbx_set_vl(n-2);
+	vbx(VVHU, VADD, v_a, v_a, v_a+1);
+	vbx_set_vl(m);
+	vbx(VVH, VABSDIFF, (vbx_half_t*)v_a, (vbx_half_t*)v_a, (vbx_half_t*)v_a+2*pitch);
+
+	// sum of absoute gradients
+	vbx(VVHU, VADD, v_a, v_a, v_b);
+	vbx(SVHU, VSHR, v_a, renorm, v_a);
+
+	// Threshold
+	vbx(SVHU, VSUB,     v_b, 255, v_a);
+	vbx(SVHU, VCMV_LTZ, v_a, 255, v_b);
+
+	// Copy the result to the low byte of each output row, dropping the columns past width
+	// Trick to copy the low byte (b) to the middle two bytes as well
+	vbx_set_vl(width);
+	vbx_set_2D(rows, width*sizeof(vbx_uword_t), 0, pitch*sizeof(vbx_uhalf_t));
+	vbx_2D(SVHWU, VMULLO, v_out, 0x00010101, v_a);
+}
+
+static void sobel_luma16_chunk(const vbw_stream_chunk_t *chunk, void *arg)
+{
+	const int    pitch = chunk->in_pitch[0];
+	vbx_uhalf_t *v_a   = (vbx_uhalf_t *)chunk->v_temp;
+	vbx_uhalf_t *v_b   = v_a + (chunk->rows+2)*pitch;
+
+	vbw_sobel_3x3_tile((vbx_uword_t *)chunk->v_out[0], (vbx_uhalf_t *)chunk->v_in[0], v_a, v_b,
+	                   chunk->rows, chunk->row_len, pitch, *(const short *)arg);
 }
 
 /** Luma Edge Detection.
  *
  * @brief 3x3 Sobel edge detection with 16-bit luma image
  *
+ * The image is processed in tiles, so it may be any width.
+ * The first and last rows and columns of the output are 0.
+ *
  * @param[in] input        16-bit luma input
  * @param[out] output       32-bit aRGB edge-intensity output
  * @param[in] image_width  input/output image width
@@ -67,109 +116,15 @@ static inline void vbw_sobel_3x3_row(vbx_uhalf_t *lpf, vbx_uhalf_t *raw, const s
  */
 int vbw_sobel_luma16_3x3(unsigned *output, unsigned short *input, const short image_width, const short image_height, const short image_pitch, const short renorm)
 {
-	int y;
-
-	vbx_uhalf_t *v_luma_top, *v_luma_mid, *v_luma_bot, *v_luma_nxt;
-	vbx_uword_t *v_row_out;
-
-	vbx_uhalf_t *v_sobel_row_top, *v_sobel_row_mid, *v_sobel_row_bot;
-	vbx_uhalf_t *v_gradient_x, *v_gradient_y;
-	vbx_uhalf_t *v_tmp;
+	// Edges of the pixels inside the border, each reading its 3x3 neighbourhood;
+	// the border is cleared after, so the output may overwrite the input
+	vbw_stream_t in  = { input  + image_pitch + 1, sizeof(vbx_uhalf_t), image_pitch, 1, 1, 1, 1 };
+	vbw_stream_t out = { output + image_pitch + 1, sizeof(vbx_uword_t), image_pitch, 0, 0 };
 
-	void *tmp_ptr;
-
-	// Allocate space in scratchpad for vectors
-	if ((v_luma_top      = (vbx_uhalf_t *)vbx_sp_malloc(image_width*sizeof(vbx_uhalf_t))) == NULL
-			||  (v_luma_mid      = (vbx_uhalf_t *)vbx_sp_malloc(image_width*sizeof(vbx_uhalf_t))) == NULL
-			||  (v_luma_bot      = (vbx_uhalf_t *)vbx_sp_malloc(image_width*sizeof(vbx_uhalf_t))) == NULL
-			||  (v_luma_nxt      = (vbx_uhalf_t *)vbx_sp_malloc(image_width*sizeof(vbx_uhalf_t))) == NULL
-			||  (v_sobel_row_top = (vbx_uhalf_t *)vbx_sp_malloc(image_width*sizeof(vbx_uhalf_t))) == NULL
-			||  (v_sobel_row_mid = (vbx_uhalf_t *)vbx_sp_malloc(image_width*sizeof(vbx_uhalf_t))) == NULL
-			||  (v_sobel_row_bot = (vbx_uhalf_t *)vbx_sp_malloc(image_width*sizeof(vbx_uhalf_t))) == NULL
-			||  (v_gradient_x    = (vbx_uhalf_t *)vbx_sp_malloc(image_width*sizeof(vbx_uhalf_t))) == NULL
-			||  (v_gradient_y    = (vbx_uhalf_t *)vbx_sp_malloc(image_width*sizeof(vbx_uhalf_t))) == NULL
-			||  (v_row_out       = (vbx_uword_t *)vbx_sp_malloc(image_width*sizeof(vbx_uword_t))) == NULL) {
+	if (vbw_stream_tiled(&in, 1, &out, 1, image_height-2, image_width-2, 2*sizeof(vbx_uhalf_t), sobel_luma16_chunk, (void *)&renorm)
+	    || vbw_stream_zero_border(output, sizeof(vbx_uword_t), image_pitch, image_width, image_height, 1, 1, 1, 1)) {
 		printf("Out of scratchpad memory\n");
 		return -1;
 	}
-
-	// Transfer the first 3 input rows and interleave first 2 sobel row calculations
-	vbx_dma_to_vector(v_luma_top, input,                 image_width*sizeof(vbx_uhalf_t));
-	vbx_dma_to_vector(v_luma_mid, input +   image_pitch, image_width*sizeof(vbx_uhalf_t));
-	vbw_sobel_3x3_row(v_sobel_row_top, v_luma_top, image_width);
-	vbx_dma_to_vector(v_luma_bot, input + 2*image_pitch, image_width*sizeof(vbx_uhalf_t));
-	vbw_sobel_3x3_row(v_sobel_row_mid, v_luma_mid, image_width);
-
-	// Set top output row to 0
-	vbx_set_vl(image_width);
-	vbx(SVWU, VMOV, v_row_out, 0, 0);
-	vbx_dma_to_host(output, v_row_out, image_width*sizeof(vbx_uword_t));
-
-	// Calculate edges
-	for (y = 0; y < image_height-(FILTER_HEIGHT-1); y++) {
-		// Transfer the next input row while processing
-		vbx_dma_to_vector(v_luma_nxt, input + (y+FILTER_HEIGHT)*image_pitch, image_width*sizeof(vbx_uhalf_t));
-
-		// Start calculating gradient_x
-		vbx_set_vl(image_width);
-		vbx(SVHU, VSHL, v_gradient_x, 1, v_luma_mid); // multiply by 2
-
-		// Calculate gradient_y
-		// Apply [1 2 1] matrix to last row in window and calculate absolute difference with pre-computed first row
-		vbw_sobel_3x3_row(v_sobel_row_bot, v_luma_bot, image_width);
-		vbx(VVH, VABSDIFF, (vbx_half_t*)v_gradient_y, (vbx_half_t*)v_sobel_row_top, (vbx_half_t*)v_sobel_row_bot);
-
-		// Re-use v_sobel_row_top
-		v_tmp = v_sobel_row_top;
-
-		// Finish calculating gradient_x
-		// Apply [1 2 1]T matrix to all columns
-		vbx_set_vl(image_width);
-		vbx(VVHU,  VADD, v_tmp, v_luma_top, v_luma_bot);
-		vbx(VVHU,  VADD, v_tmp, v_tmp,      v_gradient_x);
-		// For each column, calculate absolute difference with 2nd column to the right
-		vbx_set_vl(image_width-2);
-		vbx(VVH, VABSDIFF, (vbx_half_t*)v_gradient_x, (vbx_half_t*)v_tmp, (vbx_half_t*)v_tmp+2);
-
-		// sum of absoute gradients
-		vbx_set_vl(image_width-2);
-		vbx(VVHU, VADD, v_tmp, v_gradient_x,  v_gradient_y);
-		vbx(SVHU, VSHR, v_tmp, renorm, v_tmp);
-
-		// Threshold
-		vbx(SVHU, VSUB,     v_gradient_y, 255, v_tmp);
-		vbx(SVHU, VCMV_LTZ, v_tmp,        255, v_gradient_y);
-
-		// Copy the result to the low byte of the output row
-		// Trick to copy the low byte (b) to the middle two bytes as well
-		// Note that first and last columns are 0
-		vbx_set_vl(image_width-2);
-		vbx(SVHWU, VMULLO, v_row_out+1, 0x00010101, v_tmp);
-
-		// DMA the result to the output
-		vbx_dma_to_host(output+(y+1)*image_pitch, v_row_out, image_width*sizeof(vbx_uword_t));
-
-		// Rotate input row buffers
-		tmp_ptr      = (void *)v_luma_top;
-		v_luma_top   = v_luma_mid;
-		v_luma_mid   = v_luma_bot;
-		v_luma_bot   = v_luma_nxt;
-		v_luma_nxt   = (vbx_uhalf_t *)tmp_ptr;
-
-		// Rotate v_sobel_row buffers (for gradient_y)
-		tmp_ptr         = (void *)v_sobel_row_top;
-		v_sobel_row_top = v_sobel_row_mid;
-		v_sobel_row_mid = v_sobel_row_bot;
-		v_sobel_row_bot = (vbx_uhalf_t *)tmp_ptr;
-	}
-
-	// Set bottom row to 0
-	vbx_set_vl(image_width);
-	vbx(SVWU, VMOV, v_row_out, 0, 0);
-	vbx_dma_to_host(output+(image_height-1)*image_pitch, v_row_out, image_width*sizeof(vbx_uword_t));
-
-	vbx_sync();
-	vbx_sp_free();
-
 	return 0;
 }
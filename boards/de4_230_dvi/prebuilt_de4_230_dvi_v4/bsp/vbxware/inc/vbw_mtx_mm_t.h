@@ -42,5 +42,6 @@
 
 #include "vbw_template_t.h"
 
+int VBX_T(vbw_mtx_mm)( vbx_mm_t *out, vbx_mm_t *in1, vbx_mm_t *in2, const int M, const int N, const int K, const int in2_transposed );
 int VBX_T(vbw_mtx_mmt)( vbx_mm_t *out, vbx_mm_t *in1, vbx_mm_t *in2, int N );
 
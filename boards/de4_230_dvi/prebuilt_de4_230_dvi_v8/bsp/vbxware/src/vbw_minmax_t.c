@@ -0,0 +1,252 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**@file*/
+
+// This is a templated file.
+// Do not include a copyright header function.
+
+// This file is meant to be #included in another .c file
+// Do not define VBX_TEMPLATE_T locally in this file.
+// Only define it externally in the file that includes
+// this file.
+
+// Protect this file from inclusion if VBX_TEMPLATE_T is not properly defined.
+#ifdef VBX_TEMPLATE_T
+#if (VBX_TEMPLATE_T==VBX_BYTESIZE_DEF  || \
+		VBX_TEMPLATE_T==VBX_HALFSIZE_DEF  || \
+		VBX_TEMPLATE_T==VBX_WORDSIZE_DEF  || \
+		VBX_TEMPLATE_T==VBX_UBYTESIZE_DEF || \
+		VBX_TEMPLATE_T==VBX_UHALFSIZE_DEF || \
+		VBX_TEMPLATE_T==VBX_UWORDSIZE_DEF )
+
+#include "vbw_minmax_t.h"
+
+
+#ifndef VBW_MINMAX_ONLY_ONCE
+#define VBW_MINMAX_ONLY_ONCE
+
+// The flag a VSUB leaves on b-a says whether b < a, exactly, even when the
+// difference itself wraps. Moving 0 into the difference where it is not
+// negative leaves m = min(b-a,0); where it is not positive, max(b-a,0). Then
+//   min(a,b) = a + min(b-a,0)   max(a,b) = a + max(b-a,0) = b - min(b-a,0)
+// which also hold in wrapping arithmetic. That takes one vector, which can be
+// the destination, where the usual VMOV/VSUB/VCMV sequences need two.
+//
+// VBX is vbx, vbx_2D or vbx_3D. The sources are not changed before their
+// last read as long as the destination is not v_a (MIN, MAX), or v_min is
+// not v_b and v_max is not v_a (CMPX); the functions below arrange that by
+// swapping v_a and v_b, which does not change the result.
+
+#define VBW_MINMAX_MIN(VBX, v_dst, v_a, v_b) \
+	do { \
+		VBX( VV(T), VSUB,     (v_dst), (v_b), (v_a) );   \
+		VBX( SV(T), VCMV_GEZ, (v_dst), 0,     (v_dst) ); \
+		VBX( VV(T), VADD,     (v_dst), (v_a), (v_dst) ); \
+	} while(0)
+
+#define VBW_MINMAX_MAX(VBX, v_dst, v_a, v_b) \
+	do { \
+		VBX( VV(T), VSUB,     (v_dst), (v_b), (v_a) );   \
+		VBX( SV(T), VCMV_LTZ, (v_dst), 0,     (v_dst) ); \
+		VBX( VV(T), VADD,     (v_dst), (v_a), (v_dst) ); \
+	} while(0)
+
+// v_m is v_min, v_max or v_temp, whichever is not a source
+#define VBW_MINMAX_CMPX(VBX, v_min, v_max, v_a, v_b, v_m) \
+	do { \
+		VBX( VV(T), VSUB,     (v_m), (v_b), (v_a) ); \
+		VBX( SV(T), VCMV_GEZ, (v_m), 0,     (v_m) ); \
+		if( (v_m) == (v_min) ) { \
+			VBX( VV(T), VSUB, (v_max), (v_b), (v_m) ); \
+			VBX( VV(T), VADD, (v_min), (v_a), (v_m) ); \
+		} else { \
+			VBX( VV(T), VADD, (v_min), (v_a), (v_m) ); \
+			VBX( VV(T), VSUB, (v_max), (v_b), (v_m) ); \
+		} \
+	} while(0)
+
+// With a temporary, min or max in place is a VSUB and one conditional move
+#define VBW_MINMAX_MIN_IN_PLACE(VBX, v_dst, v_src, v_temp) \
+	do { \
+		VBX( VV(T), VSUB,     (v_temp), (v_src), (v_dst) );  \
+		VBX( VV(T), VCMV_LTZ, (v_dst),  (v_src), (v_temp) ); \
+	} while(0)
+
+#define VBW_MINMAX_MAX_IN_PLACE(VBX, v_dst, v_src, v_temp) \
+	do { \
+		VBX( VV(T), VSUB,     (v_temp), (v_dst), (v_src) );  \
+		VBX( VV(T), VCMV_LTZ, (v_dst),  (v_src), (v_temp) ); \
+	} while(0)
+
+#endif // VBW_MINMAX_ONLY_ONCE
+
+#define VBW_MINMAX_SWAP(v_a, v_b) \
+	do { vbx_sp_t *v_swap = (v_a); (v_a) = (v_b); (v_b) = v_swap; } while(0)
+
+// Bodies of the 1D, 2D and 3D functions, which differ only in VBX
+#define VBW_MINMAX_MIN_BODY(VBX) \
+	if( v_a == v_b ) { \
+		if( v_dst != v_a ) VBX( VV(T), VMOV, v_dst, v_a, 0 ); \
+		return; \
+	} \
+	if( v_dst == v_b ) VBW_MINMAX_SWAP( v_a, v_b ); \
+	if( v_temp && v_dst == v_a ) { \
+		VBW_MINMAX_MIN_IN_PLACE( VBX, v_dst, v_b, v_temp ); \
+		return; \
+	} \
+	if( v_dst == v_a ) VBW_MINMAX_SWAP( v_a, v_b ); \
+	VBW_MINMAX_MIN( VBX, v_dst, v_a, v_b )
+
+#define VBW_MINMAX_MAX_BODY(VBX) \
+	if( v_a == v_b ) { \
+		if( v_dst != v_a ) VBX( VV(T), VMOV, v_dst, v_a, 0 ); \
+		return; \
+	} \
+	if( v_dst == v_b ) VBW_MINMAX_SWAP( v_a, v_b ); \
+	if( v_temp && v_dst == v_a ) { \
+		VBW_MINMAX_MAX_IN_PLACE( VBX, v_dst, v_b, v_temp ); \
+		return; \
+	} \
+	if( v_dst == v_a ) VBW_MINMAX_SWAP( v_a, v_b ); \
+	VBW_MINMAX_MAX( VBX, v_dst, v_a, v_b )
+
+#define VBW_MINMAX_CMPX_BODY(VBX) \
+	if( v_a == v_b ) { \
+		if( v_min != v_a ) VBX( VV(T), VMOV, v_min, v_a, 0 ); \
+		if( v_max != v_a ) VBX( VV(T), VMOV, v_max, v_a, 0 ); \
+		return; \
+	} \
+	if( v_min == v_b || v_max == v_a ) VBW_MINMAX_SWAP( v_a, v_b ); \
+	if( v_min != v_a ) { \
+		VBW_MINMAX_CMPX( VBX, v_min, v_max, v_a, v_b, v_min ); \
+	} else if( v_max != v_b ) { \
+		VBW_MINMAX_CMPX( VBX, v_min, v_max, v_a, v_b, v_max ); \
+	} else { \
+		VBW_MINMAX_CMPX( VBX, v_min, v_max, v_a, v_b, v_temp ); \
+	}
+
+
+/** Vector minimum, v_dst = min(v_a, v_b).
+ * Three instructions and no temporary. If v_dst is v_a or v_b and v_temp is
+ * given, two instructions, with v_temp as a temporary. v_temp may be NULL.
+ *
+ * @param[out] v_dst.
+ * @param[in] v_a.
+ * @param[in] v_b.
+ * @param[in] v_temp.
+ */
+void VBX_T(vbw_min)(vbx_sp_t *v_dst, vbx_sp_t *v_a, vbx_sp_t *v_b, vbx_sp_t *v_temp)
+{
+	VBW_MINMAX_MIN_BODY( vbx );
+}
+
+/** Vector maximum, v_dst = max(v_a, v_b).
+ * As vbw_min.
+ *
+ * @param[out] v_dst.
+ * @param[in] v_a.
+ * @param[in] v_b.
+ * @param[in] v_temp.
+ */
+void VBX_T(vbw_max)(vbx_sp_t *v_dst, vbx_sp_t *v_a, vbx_sp_t *v_b, vbx_sp_t *v_temp)
+{
+	VBW_MINMAX_MAX_BODY( vbx );
+}
+
+/** Vector compare-exchange, v_min = min(v_a, v_b), v_max = max(v_a, v_b).
+ * Four instructions. v_min and v_max may be v_a and v_b, either way round,
+ * or other vectors, but not the same vector. v_temp is used only when v_min
+ * and v_max are both sources, and may otherwise be NULL.
+ *
+ * @param[out] v_min.
+ * @param[out] v_max.
+ * @param[in] v_a.
+ * @param[in] v_b.
+ * @param[in] v_temp.
+ */
+void VBX_T(vbw_cmpx)(vbx_sp_t *v_min, vbx_sp_t *v_max, vbx_sp_t *v_a, vbx_sp_t *v_b, vbx_sp_t *v_temp)
+{
+	VBW_MINMAX_CMPX_BODY( vbx );
+}
+
+/** 2D vector minimum, as vbw_min, using the current 2D setup.
+ * The destination of one instruction is a source of the next, so the
+ * destination and source strides set with vbx_set_2D must be the same.
+ */
+void VBX_T(vbw_min_2D)(vbx_sp_t *v_dst, vbx_sp_t *v_a, vbx_sp_t *v_b, vbx_sp_t *v_temp)
+{
+	VBW_MINMAX_MIN_BODY( vbx_2D );
+}
+
+/** 2D vector maximum, as vbw_min_2D. */
+void VBX_T(vbw_max_2D)(vbx_sp_t *v_dst, vbx_sp_t *v_a, vbx_sp_t *v_b, vbx_sp_t *v_temp)
+{
+	VBW_MINMAX_MAX_BODY( vbx_2D );
+}
+
+/** 2D vector compare-exchange, as vbw_cmpx and vbw_min_2D. */
+void VBX_T(vbw_cmpx_2D)(vbx_sp_t *v_min, vbx_sp_t *v_max, vbx_sp_t *v_a, vbx_sp_t *v_b, vbx_sp_t *v_temp)
+{
+	VBW_MINMAX_CMPX_BODY( vbx_2D );
+}
+
+/** 3D vector minimum, as vbw_min_2D, using the current 3D setup. */
+void VBX_T(vbw_min_3D)(vbx_sp_t *v_dst, vbx_sp_t *v_a, vbx_sp_t *v_b, vbx_sp_t *v_temp)
+{
+	VBW_MINMAX_MIN_BODY( vbx_3D );
+}
+
+/** 3D vector maximum, as vbw_min_3D. */
+void VBX_T(vbw_max_3D)(vbx_sp_t *v_dst, vbx_sp_t *v_a, vbx_sp_t *v_b, vbx_sp_t *v_temp)
+{
+	VBW_MINMAX_MAX_BODY( vbx_3D );
+}
+
+/** 3D vector compare-exchange, as vbw_cmpx and vbw_min_3D. */
+void VBX_T(vbw_cmpx_3D)(vbx_sp_t *v_min, vbx_sp_t *v_max, vbx_sp_t *v_a, vbx_sp_t *v_b, vbx_sp_t *v_temp)
+{
+	VBW_MINMAX_CMPX_BODY( vbx_3D );
+}
+
+#undef VBW_MINMAX_SWAP
+#undef VBW_MINMAX_MIN_BODY
+#undef VBW_MINMAX_MAX_BODY
+#undef VBW_MINMAX_CMPX_BODY
+
+#endif // properly defined VBX_TEMPLATE_T
+#endif // defined(VBX_TEMPLATE_T)
@@ -1,69 +1,68 @@
-#define VV_OPERATOR(inst,op)\
-	template<typename T> \
-	VV_OP<T> operator op (const Vector_Op<T>& lhs, const Vector_Op<T>& rhs) \
+#define VV_OPERATOR(instr,op)\
+	template<typename T,typename L,typename R> \
+	VV_OP<instr,T,L,R> operator op (const Expr<T,L>& lhs, const Expr<T,R>& rhs) \
 	{ \
-		return VV_OP<T>(&lhs,&rhs,inst); \
+		return VV_OP<instr,T,L,R>(lhs.self(),rhs.self()); \
 	}
 
 #define SV_OPERATOR(instr,op)\
-	template<typename T> \
-	SV_OP<T> operator op (typename type_manipulation::word_sized<T>::type scalar, const Vector_Op<T>& rhs) \
+	template<typename T,typename R> \
+	SV_OP<instr,T,R> operator op (typename type_manipulation::word_sized<T>::type scalar, const Expr<T,R>& rhs) \
 	{ \
-		return SV_OP<T>(scalar,&rhs,instr); \
+		return SV_OP<instr,T,R>(scalar,rhs.self()); \
 	}
 #define VS_OPERATOR(instr,op)	  \
-	template<typename T> \
-	SV_OP<T> operator op (const Vector_Op<T>& lhs,typename type_manipulation::word_sized<T>::type scalar) \
+	template<typename T,typename L> \
+	SV_OP<instr,T,L> operator op (const Expr<T,L>& lhs,typename type_manipulation::word_sized<T>::type scalar) \
 	{ \
-		return SV_OP<T>(scalar,&lhs,instr); \
+		return SV_OP<instr,T,L>(scalar,lhs.self()); \
 	}
 #define VE_OPERATOR(instr,op)	  \
-	template<typename T> \
-	VE_OP<T> operator op (const Vector_Op<T>& lhs, ENUM<T> rhs) \
+	template<typename T,typename L> \
+	VE_OP<instr,T,L> operator op (const Expr<T,L>& lhs, ENUM<T> rhs) \
 	{ \
-		return VE_OP<T>(&lhs, instr ); \
+		return VE_OP<instr,T,L>(lhs.self()); \
 	}
 #define EV_OPERATOR(instr,op)	  \
-	template<typename T> \
-	VE_OP<T> operator op ( ENUM<T> lhs, const Vector_Op<T>& rhs) \
+	template<typename T,typename R> \
+	VE_OP<instr,T,R> operator op ( ENUM<T> lhs, const Expr<T,R>& rhs) \
 	{ \
-		return VE_OP<T>(&rhs, instr ); \
+		return VE_OP<instr,T,R>(rhs.self()); \
 	}
 #define SE_OPERATOR(instr,op)	  \
 	template<typename T> \
-	SE_OP<T> operator op (typename type_manipulation::word_sized<T>::type lhs, ENUM<T> rhs) \
+	SE_OP<instr,T> operator op (typename type_manipulation::word_sized<T>::type lhs, ENUM<T> rhs) \
 	{ \
-		return SE_OP<T>(lhs, instr ); \
+		return SE_OP<instr,T>(lhs); \
 	}
 #define ES_OPERATOR(instr,op)	  \
 	template<typename T> \
-	SE_OP<T> operator op ( ENUM<T> lhs,typename type_manipulation::word_sized<T>::type rhs) \
+	SE_OP<instr,T> operator op ( ENUM<T> lhs,typename type_manipulation::word_sized<T>::type rhs) \
 	{ \
-		return SE_OP<T>(rhs, instr ); \
+		return SE_OP<instr,T>(rhs); \
 	}
 #define COMP_OP_VV(instr,op)	  \
-	template<typename T> \
-	COMP_VV_OP<T> operator op (const Vector_Op<T>& lhs, const Vector_Op<T> &rhs)\
+	template<typename T,typename L,typename R> \
+	COMP_VV_OP<instr,T,L,R> operator op (const Expr<T,L>& lhs, const Expr<T,R> &rhs)\
 	{\
-		return COMP_VV_OP<T>(&lhs, &rhs, instr); \
+		return COMP_VV_OP<instr,T,L,R>(lhs.self(), rhs.self()); \
 	}
 #define COMP_OP_SV( instr,op )	  \
-	template<typename T> \
-	COMP_SV_OP<T> operator op (typename type_manipulation::word_sized<T>::type scalar, const Vector_Op<T> &rhs) \
+	template<typename T,typename R> \
+	COMP_SV_OP<instr,T,R> operator op (typename type_manipulation::word_sized<T>::type scalar, const Expr<T,R> &rhs) \
 	{ \
-		return COMP_SV_OP<T>(scalar, &rhs, instr); \
+		return COMP_SV_OP<instr,T,R>(scalar, rhs.self()); \
 	}
 #define COMP_OP_VS( instr,op )	  \
-	template<typename T> \
-	COMP_SV_OP<T> operator op (const Vector_Op<T> &lhs, typename type_manipulation::word_sized<T>::type scalar) \
+	template<typename T,typename L> \
+	COMP_SV_OP<instr,T,L> operator op (const Expr<T,L> &lhs, typename type_manipulation::word_sized<T>::type scalar) \
 	{ \
-		return COMP_SV_OP<T>(scalar, &lhs, instr); \
+		return COMP_SV_OP<instr,T,L>(scalar, lhs.self()); \
 	}
 
 
 VV_OPERATOR(VADD,+)
 VV_OPERATOR(VSUB,-)
-VV_OPERATOR(VMUL,*)
 VV_OPERATOR(VAND,&)
 VV_OPERATOR( VOR,|)
 VV_OPERATOR(VXOR,^)
@@ -71,7 +70,6 @@ VV_OPERATOR(VXOR,^)
 //VV_OPERATOR(VSHR,>>)//these operands have their order switched around
 SV_OPERATOR(VADD,+)
 SV_OPERATOR(VSUB,-)
-SV_OPERATOR(VMUL,*)
 SV_OPERATOR(VAND,&)
 SV_OPERATOR( VOR,|)
 SV_OPERATOR(VXOR,^)
@@ -79,7 +77,6 @@ SV_OPERATOR(VXOR,^)
 //SV_OPERATOR(VSHL,>>)
 VS_OPERATOR(VADD,+)
 //VS_OPERATOR(VSUB,-)
-VS_OPERATOR(VMUL,*)
 VS_OPERATOR(VAND,&)
 VS_OPERATOR(VOR,|)
 VS_OPERATOR(VXOR,^)
@@ -107,7 +104,6 @@ COMP_OP_VS(VCMV_NZ ,!=)
 
 VE_OPERATOR(VADD,+)
 VE_OPERATOR(VSUB,-)
-VE_OPERATOR(VMUL,*)
 VE_OPERATOR(VAND,&)
 VE_OPERATOR( VOR,|)
 VE_OPERATOR(VXOR,^)
@@ -115,7 +111,6 @@ VE_OPERATOR(VXOR,^)
 //VE_OPERATOR(VSHL,>>)
 EV_OPERATOR(VADD,+)
 //EV_OPERATOR(VSUB_I,-)
-EV_OPERATOR(VMUL,*)
 EV_OPERATOR(VAND,&)
 EV_OPERATOR( VOR,|)
 EV_OPERATOR(VXOR,^)
@@ -138,18 +133,49 @@ ES_OPERATOR(VXOR,^)
 //ES_OPERATOR(VSHR_I,<<)
 //ES_OPERATOR(VSHL_I,>>)
 
+/**
+ * Multiplication is different for fixed point, so the instruction comes from
+ * type_manipulation::mul_instr. Scalar times enumeration is an integer
+ * multiply either way.
+ */
+template<typename T,typename L,typename R>
+VV_OP<type_manipulation::mul_instr<T>::value,T,L,R> operator * (const Expr<T,L>& lhs, const Expr<T,R>& rhs)
+{
+	return VV_OP<type_manipulation::mul_instr<T>::value,T,L,R>(lhs.self(),rhs.self());
+}
+template<typename T,typename R>
+SV_OP<type_manipulation::mul_instr<T>::value,T,R> operator * (typename type_manipulation::word_sized<T>::type scalar, const Expr<T,R>& rhs)
+{
+	return SV_OP<type_manipulation::mul_instr<T>::value,T,R>(scalar,rhs.self());
+}
+template<typename T,typename L>
+SV_OP<type_manipulation::mul_instr<T>::value,T,L> operator * (const Expr<T,L>& lhs, typename type_manipulation::word_sized<T>::type scalar)
+{
+	return SV_OP<type_manipulation::mul_instr<T>::value,T,L>(scalar,lhs.self());
+}
+template<typename T,typename L>
+VE_OP<type_manipulation::mul_instr<T>::value,T,L> operator * (const Expr<T,L>& lhs, ENUM<T> rhs)
+{
+	return VE_OP<type_manipulation::mul_instr<T>::value,T,L>(lhs.self());
+}
+template<typename T,typename R>
+VE_OP<type_manipulation::mul_instr<T>::value,T,R> operator * ( ENUM<T> lhs, const Expr<T,R>& rhs)
+{
+	return VE_OP<type_manipulation::mul_instr<T>::value,T,R>(rhs.self());
+}
+
 /**
  * subraction is not commutative, so we need to define the SV different from VS
  */
-template<typename T>
-SV_OP<T> operator-( const Vector_Op<T>& lhs,typename type_manipulation::word_sized<T>::type scalar)
+template<typename T,typename L>
+SV_OP<VADD,T,L> operator-( const Expr<T,L>& lhs,typename type_manipulation::word_sized<T>::type scalar)
 {
-	return SV_OP<T>(-scalar,&lhs,VADD);
+	return SV_OP<VADD,T,L>(-scalar,lhs.self());
 }
 template<typename T>
-SE_OP<T> operator-( ENUM<T> lhs,typename type_manipulation::word_sized<T>::type rhs)
+SE_OP<VADD,T> operator-( ENUM<T> lhs,typename type_manipulation::word_sized<T>::type rhs)
 {
-	return SE_OP<T>(-rhs,VADD);
+	return SE_OP<VADD,T>(-rhs);
 }
 /**
  * the mxp defines vbxx(VSHL,d,a,b) as shifting b left by a bits,
@@ -157,81 +183,49 @@ SE_OP<T> operator-( ENUM<T> lhs,typename type_manipulation::word_sized<T>::type
  * because of this we have to define all of the shifting operations manually
  */
 //VS Shift
-template<typename T>
-SV_OP<T> operator << (const Vector_Op<T>& lhs,typename type_manipulation::word_sized<T>::type scalar )
+template<typename T,typename L>
+SV_OP<VSHL,T,L> operator << (const Expr<T,L>& lhs,typename type_manipulation::word_sized<T>::type scalar )
 {
-	return SV_OP<T>(scalar,&lhs,VSHL);
+	return SV_OP<VSHL,T,L>(scalar,lhs.self());
 }
-template<typename T>
-SV_OP<T> operator >> (const Vector_Op<T>& lhs,typename type_manipulation::word_sized<T>::type scalar )
+template<typename T,typename L>
+SV_OP<VSHR,T,L> operator >> (const Expr<T,L>& lhs,typename type_manipulation::word_sized<T>::type scalar )
 {
-	return SV_OP<T>(scalar,&lhs,VSHR);
+	return SV_OP<VSHR,T,L>(scalar,lhs.self());
 }
 //VV shift
-template<typename T>
-VV_OP<T> operator << (const Vector_Op<T>& lhs, const Vector_Op<T>& rhs)
+template<typename T,typename L,typename R>
+VV_OP<VSHL,T,R,L> operator << (const Expr<T,L>& lhs, const Expr<T,R>& rhs)
 {
-	return VV_OP<T>(&rhs,&lhs,VSHL);
+	return VV_OP<VSHL,T,R,L>(rhs.self(),lhs.self());
 }
 
-template<typename T>
-VV_OP<T> operator >> (const Vector_Op<T>& lhs, const Vector_Op<T>& rhs)
+template<typename T,typename L,typename R>
+VV_OP<VSHR,T,R,L> operator >> (const Expr<T,L>& lhs, const Expr<T,R>& rhs)
 {
-	return VV_OP<T>(&rhs,&lhs,VSHR);
+	return VV_OP<VSHR,T,R,L>(rhs.self(),lhs.self());
 }
 //EV shift
-template<typename T>
-VE_OP<T> operator << ( ENUM<T> lhs,const Vector_Op<T>& rhs)
+template<typename T,typename R>
+VE_OP<VSHL,T,R> operator << ( ENUM<T> lhs,const Expr<T,R>& rhs)
 {
-	return VE_OP<T>(&rhs,VSHL);
+	return VE_OP<VSHL,T,R>(rhs.self());
 }
-template<typename T>
-VE_OP<T> operator >> ( ENUM<T> lhs,const Vector_Op<T>& rhs)
+template<typename T,typename R>
+VE_OP<VSHR,T,R> operator >> ( ENUM<T> lhs,const Expr<T,R>& rhs)
 {
-	return VE_OP<T>(&rhs,VSHR);
+	return VE_OP<VSHR,T,R>(rhs.self());
 }
 //ES shift
 template<typename T>
-SE_OP<T> operator << ( ENUM<T> lhs,typename type_manipulation::word_sized<T>::type scalar)
+SE_OP<VSHL,T> operator << ( ENUM<T> lhs,typename type_manipulation::word_sized<T>::type scalar)
 {
-	return SE_OP<T>(scalar,VSHL);
+	return SE_OP<VSHL,T>(scalar);
 }
 template<typename T>
-SE_OP<T> operator >> ( ENUM<T> lhs,typename type_manipulation::word_sized<T>::type scalar)
-{
-	return SE_OP<T>(scalar,VSHR);
-}
-
-/**
- * Multiplication is different for fixed point, so we make dedicated functions for that
- */
-VV_OP<fixed> inline operator * (const Vector_Op<fixed>& lhs, const Vector_Op<fixed>& rhs)
-{
-	return VV_OP<fixed>(&lhs,&rhs,VMULFXP);
-}
-SV_OP<fixed> inline operator * ( type_manipulation::word_sized<fixed>::type scalar, const Vector_Op<fixed>& rhs)
-{
-	return SV_OP<fixed>(scalar,&rhs,VMULFXP);
-}
-SV_OP<fixed> inline operator * (const Vector_Op<fixed>& lhs, type_manipulation::word_sized<fixed>::type scalar)
-{
-	return SV_OP<fixed>(scalar,&lhs,VMULFXP);
-}
-VE_OP<fixed> inline operator * (const Vector_Op<fixed>& lhs, ENUM<fixed> rhs)
-{
-	return VE_OP<fixed>(&lhs, VMULFXP );
-}
-VE_OP<fixed> inline operator * ( ENUM<fixed> lhs, const Vector_Op<fixed>& rhs)
-{
-	return VE_OP<fixed>(&rhs, VMULFXP );
-}
-SE_OP<fixed> inline operator * ( type_manipulation::word_sized<fixed>::type lhs, ENUM<fixed> rhs) \
-{
-	return SE_OP<fixed>(lhs, VMUL );
-}
-SE_OP<fixed> inline operator * ( ENUM<fixed> lhs, type_manipulation::word_sized<fixed>::type rhs) \
+SE_OP<VSHR,T> operator >> ( ENUM<T> lhs,typename type_manipulation::word_sized<T>::type scalar)
 {
-	return SE_OP<fixed>(rhs, VMUL );
+	return SE_OP<VSHR,T>(scalar);
 }
 
 #undef VV_OPERATOR
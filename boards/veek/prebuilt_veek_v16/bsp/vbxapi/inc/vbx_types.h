@@ -124,6 +124,38 @@ typedef struct {
 
 
 
+/** A named pool of scratchpad heap blocks, see @ref vbx_sp_pool */
+typedef struct {
+	const char *name;
+	int         alignment;  ///< Alignment of its blocks, in bytes
+	int         used;       ///< Bytes in its blocks
+	int         high_water; ///< Most bytes it has held at once
+	int         blocks;     ///< Number of its blocks
+} vbx_sp_pool_t;
+
+/** Scratchpad heap usage, see @ref vbx_sp_heap_stats */
+typedef struct {
+	int size;         ///< Bytes taken from the top of the scratchpad
+	int high_water;   ///< Largest size so far
+	int used;         ///< Bytes in allocated blocks
+	int free;         ///< Bytes in holes between them
+	int largest_free; ///< Largest hole
+	int blocks;       ///< Number of allocated blocks
+	int holes;        ///< Number of holes
+} vbx_sp_heap_stats_t;
+
+/** Scratchpad residency cache counters, see @ref vbx_sp_cache_stats */
+typedef struct {
+	int entries;   ///< Host buffers resident in the scratchpad
+	int bytes;     ///< Scratchpad bytes they take
+	int locked;    ///< Entries in use, between @ref vbx_sp_cache_get and @ref vbx_sp_cache_put
+	int hits;      ///< Lookups that found their buffer resident
+	int misses;    ///< Lookups that had to DMA their buffer in
+	int evictions; ///< Entries dropped to make room
+} vbx_sp_cache_stats_t;
+
+struct vbx_sp_heap;
+
 /** MXP processor state*/
 typedef struct {
 
@@ -151,6 +183,8 @@ typedef struct {
 	vbx_void_t  **spstack;
 	int         spstack_top;
 	int         spstack_max;
+	vbx_void_t  *sp_limit; ///< End of the space for @ref vbx_sp_malloc, the heap is above it
+	struct vbx_sp_heap *sp_heap;
 
 } vbx_mxp_t;
 
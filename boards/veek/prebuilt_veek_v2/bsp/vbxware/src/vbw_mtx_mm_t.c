@@ -55,106 +55,191 @@
 		VBX_TEMPLATE_T==VBX_UWORDSIZE_DEF )
 
 #include "vbw_mtx_mm_t.h"
+#include "vbw_mtx_xp_t.h"
 
-/** VBX matrix multiply.
- * @todo See if double buffering helps
- * N must be power of 2
- * Needs matrix B transposed already
+#ifndef VBW_MTX_MM_ONLY_ONCE
+#define VBW_MTX_MM_ONLY_ONCE
+// largest out tile side tried first
+#define VBW_MTX_MM_MAX_TILE 64
+
+static int mm_tile_bytes( const int mt, const int nt, const int kt, const int elem_bytes, const int in2_bufs )
+{
+	const int align = VBX_GET_THIS_MXP()->scratchpad_alignment_bytes;
+	return ( 2*mt*kt + in2_bufs*nt*kt + 2*mt*nt ) * elem_bytes + (4+in2_bufs)*align;
+}
+
+// Picks an mt x kt tile of in1, a kt x nt tile of in2 and an mt x nt tile of out
+// for vbw_mtx_mm. Starts from 64 x K x 64 and, until the buffers fit in the free
+// scratchpad, halves kt while it is over twice mt and nt, else the larger of mt
+// and nt, since long vectors keep the lanes busier than wide out tiles. Then
+// evens the tiles out so the last one in each direction is not much smaller.
+static int mm_tile_size( int *pmt, int *pnt, int *pkt, const int M, const int N, const int K,
+                         const int elem_bytes, const int in2_bufs )
+{
+	const int sp = vbx_sp_getfree();
+	int mt = M < VBW_MTX_MM_MAX_TILE ? M : VBW_MTX_MM_MAX_TILE;
+	int nt = N < VBW_MTX_MM_MAX_TILE ? N : VBW_MTX_MM_MAX_TILE;
+	int kt = K;
+
+	while( mm_tile_bytes( mt, nt, kt, elem_bytes, in2_bufs ) > sp ) {
+		if( kt > 1 && kt >= 2*mt && kt >= 2*nt ) {
+			kt = (kt+1)/2;
+		} else if( mt > 1 && mt >= nt ) {
+			mt = (mt+1)/2;
+		} else if( nt > 1 ) {
+			nt = (nt+1)/2;
+		} else if( kt > 1 ) {
+			kt = (kt+1)/2;
+		} else {
+			return -1;
+		}
+	}
+
+	*pmt = (M + (M+mt-1)/mt - 1) / ((M+mt-1)/mt);
+	*pnt = (N + (N+nt-1)/nt - 1) / ((N+nt-1)/nt);
+	*pkt = (K + (K+kt-1)/kt - 1) / ((K+kt-1)/kt);
+	return 0;
+}
+#endif // VBW_MTX_MM_ONLY_ONCE
+
+/** VBX matrix multiply, out = in1 * in2, for any matrix sizes.
+ * in1 is M x K and out is M x N. in2 is K x N, or N x K if @a in2_transposed
+ * is set. The matrices are multiplied in tiles sized from the free scratchpad.
+ * Each in2 tile is transposed in the scratchpad unless in2 is already transposed.
+ * The next tiles are fetched with 2D DMA into a second set of buffers while
+ * the current ones are multiplied, and tiles that are needed again by the next
+ * step are not fetched again.
  *
- * @param[in] in.
  * @param[out] out.
+ * @param[in] in1.
+ * @param[in] in2.
+ * @param[in] M.
  * @param[in] N.
+ * @param[in] K.
+ * @param[in] in2_transposed.
+ * @retval the number of elements in an out tile, or -1 if the scratchpad is too small.
  */
-int VBX_T(vbw_mtx_mmt)( vbx_mm_t *out, vbx_mm_t *in1, vbx_mm_t *in2, int N )
+int VBX_T(vbw_mtx_mm)( vbx_mm_t *out, vbx_mm_t *in1, vbx_mm_t *in2, const int M, const int N, const int K, const int in2_transposed )
 {
-	int bs,tile_height,tile_width;
-	int l,k,j,i;
-
-	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	int mt, nt, kt;
+	int l, c, k, j;
+	int next_l, next_c, next_k;
+	int db1 = 0, db2 = 0, xp_valid = 0;
 
-	bs = 0;
-	for(i = 0; i < 32; i++){
-		if((this_mxp->scratchpad_size/(4*sizeof(vbx_sp_t))) & (1<<i)){
-			bs = i;
-		}
-	}
-	tile_height = bs>>1;
-	tile_width  = bs-(bs>>1);
-	tile_height = 1<<tile_height;
-	tile_width = 1<<tile_width;
-	if(tile_height > N){
-		tile_height = N;
+	if( M <= 0 || N <= 0 || K <= 0 ) {
+		return 0;
 	}
-	if(tile_width > N){
-		tile_width = N;
+	if( mm_tile_size( &mt, &nt, &kt, M, N, K, sizeof(vbx_sp_t), in2_transposed ? 2 : 3 ) ) {
+		VBX_PRINTF( "ERROR: out of memory\n" );
+		return -1;
 	}
-#ifdef SIMPLE_INIT
-	tile_height = 8;
-	tile_width  = 8;
-#endif
-
-	bs = tile_height*tile_width;
-
-	vbx_sp_t *v_in1      = (vbx_sp_t *)vbx_sp_malloc(tile_height*tile_width*sizeof(vbx_sp_t));
-	vbx_sp_t *v_in2      = (vbx_sp_t *)vbx_sp_malloc(tile_height*tile_width*sizeof(vbx_sp_t));
-	vbx_sp_t *v_out      = (vbx_sp_t *)vbx_sp_malloc(tile_height*tile_height*sizeof(vbx_sp_t));
-	vbx_sp_t *v_out_temp = (vbx_sp_t *)vbx_sp_malloc(tile_height*tile_height*sizeof(vbx_sp_t));
-
-	vbx_set_2D(tile_height,tile_height*sizeof(vbx_sp_t),tile_width*sizeof(vbx_sp_t),0);
-
-	for(l = 0; l < N; l += tile_height){
-		for(k = 0; k < N; k += tile_height){
 
-			//FIRST, work in v_out directly
-			i = 0;
-			//Copy in1 block
-			//Copy in2 block
-			for(j = 0; j < tile_height; j++){
-				vbx_dma_to_vector(v_in1+(j*tile_width),in1+((l+j)*N)+i,tile_width*sizeof(vbx_mm_t));
-			}
-
-			vbx_set_vl(tile_width);
-			vbx_dma_to_vector(v_in2,in2+(k*N)+i,tile_width*sizeof(vbx_mm_t));
-			for(j = 0; j < tile_height-1; j++){
-				vbx_dma_to_vector(v_in2+((j+1)*tile_width),in2+((k+(j+1))*N)+i,tile_width*sizeof(vbx_mm_t));
-				//Multiply-accum in1 by in2[j] into v_out
-				vbx_acc_2D(VV(T), VMULLO,v_out+j,v_in1,v_in2+(j*tile_width));
-			}
-			vbx_acc_2D(VV(T), VMULLO,v_out+(tile_height-1),v_in1,v_in2+((tile_height-1)*tile_width));
-
-			//REST, work in v_out_temp, add to v_out
-			for(i = tile_width; i < N; i += tile_width){
-				//Copy in1 block
-				//Copy in2 block
-				for(j = 0; j < tile_height; j++){
-					vbx_dma_to_vector(v_in1+(j*tile_width),in1+((l+j)*N)+i,tile_width*sizeof(vbx_mm_t));
+	vbx_sp_push();
+	vbx_sp_t *v_in1[2], *v_in2[2];
+	v_in1[0] = (vbx_sp_t *)vbx_sp_malloc( mt*kt*sizeof(vbx_sp_t) );
+	v_in1[1] = (vbx_sp_t *)vbx_sp_malloc( mt*kt*sizeof(vbx_sp_t) );
+	v_in2[0] = (vbx_sp_t *)vbx_sp_malloc( nt*kt*sizeof(vbx_sp_t) );
+	v_in2[1] = (vbx_sp_t *)vbx_sp_malloc( nt*kt*sizeof(vbx_sp_t) );
+	vbx_sp_t *v_in2_xp   = in2_transposed ? NULL : (vbx_sp_t *)vbx_sp_malloc( nt*kt*sizeof(vbx_sp_t) );
+	vbx_sp_t *v_out      = (vbx_sp_t *)vbx_sp_malloc( mt*nt*sizeof(vbx_sp_t) );
+	vbx_sp_t *v_out_temp = (vbx_sp_t *)vbx_sp_malloc( mt*nt*sizeof(vbx_sp_t) );
+
+	// in1 tiles are mc x kc, in2 tiles are nc x kc if transposed, else kc x nc
+#define FETCH_IN1( v, l, k ) \
+	vbx_dma_to_vector_2D( v, in1+(l)*K+(k), \
+	                      (K-(k) < kt ? K-(k) : kt)*sizeof(vbx_mm_t), (M-(l) < mt ? M-(l) : mt), \
+	                      (K-(k) < kt ? K-(k) : kt)*sizeof(vbx_sp_t), K*sizeof(vbx_mm_t) )
+#define FETCH_IN2( v, c, k ) \
+	do { \
+		const int nc = N-(c) < nt ? N-(c) : nt; \
+		const int kc = K-(k) < kt ? K-(k) : kt; \
+		if( in2_transposed ) { \
+			vbx_dma_to_vector_2D( v, in2+(c)*K+(k), kc*sizeof(vbx_mm_t), nc, kc*sizeof(vbx_sp_t), K*sizeof(vbx_mm_t) ); \
+		} else { \
+			vbx_dma_to_vector_2D( v, in2+(k)*N+(c), nc*sizeof(vbx_mm_t), kc, nc*sizeof(vbx_sp_t), N*sizeof(vbx_mm_t) ); \
+		} \
+	} while(0)
+
+	FETCH_IN1( v_in1[db1], 0, 0 );
+	FETCH_IN2( v_in2[db2], 0, 0 );
+
+	for( c = 0; c < N; c += nt ) {
+		const int nc = N-c < nt ? N-c : nt;
+		for( l = 0; l < M; l += mt ) {
+			const int mc = M-l < mt ? M-l : mt;
+			for( k = 0; k < K; k += kt ) {
+				const int kc = K-k < kt ? K-k : kt;
+				vbx_sp_t *v_a   = v_in1[db1];
+				vbx_sp_t *v_b   = v_in2[db2];
+				vbx_sp_t *v_acc = k ? v_out_temp : v_out;
+
+				// fetch the tiles of the next step while these ones are multiplied
+				next_l = l;
+				next_c = c;
+				next_k = k + kt;
+				if( next_k >= K ) {
+					next_k = 0;
+					next_l += mt;
+					if( next_l >= M ) {
+						next_l = 0;
+						next_c += nt;
+					}
+				}
+				int new_in1 = next_c < N && ( next_l != l || next_k != k );
+				int new_in2 = next_c < N && ( next_c != c || next_k != k );
+				if( new_in1 ) {
+					FETCH_IN1( v_in1[!db1], next_l, next_k );
+				}
+				if( new_in2 ) {
+					FETCH_IN2( v_in2[!db2], next_c, next_k );
 				}
 
-				vbx_set_vl(tile_width);
-				vbx_dma_to_vector(v_in2,in2+(k*N)+i,tile_width*sizeof(vbx_mm_t));
-				for(j = 0; j < tile_height-1; j++){
-					vbx_dma_to_vector(v_in2+((j+1)*tile_width),in2+((k+(j+1))*N)+i,tile_width*sizeof(vbx_mm_t));
-					//Multiply-accum in1 by in2[j] into v_out_temp
-					vbx_acc_2D(VV(T), VMULLO,v_out_temp+j,v_in1,v_in2+(j*tile_width));
+				if( !in2_transposed ) {
+					if( !xp_valid ) {
+						VBX_T(vbw_mtx_xp)( v_in2_xp, v_b, kc, nc );
+					}
+					v_b = v_in2_xp;
+					xp_valid = !new_in2;
 				}
-				vbx_acc_2D(VV(T), VMULLO,v_out_temp+(tile_height-1),v_in1,v_in2+((tile_height-1)*tile_width));
 
-				//Add v_out_temp to v_out
-				vbx_set_vl(tile_height*tile_height);
-				vbx(VV(T), VADD,v_out,v_out,v_out_temp);
-			}
+				// each instruction computes one column of the out tile:
+				// the dot products of the in1 rows with one in2 column
+				vbx_set_vl( kc );
+				vbx_set_2D( mc, nt*sizeof(vbx_sp_t), kc*sizeof(vbx_sp_t), 0 );
+				for( j = 0; j < nc; j++ ) {
+					vbx_acc_2D( VV(T), VMULLO, v_acc+j, v_a, v_b+j*kc );
+				}
+				if( k ) {
+					vbx_set_vl( mc*nt );
+					vbx( VV(T), VADD, v_out, v_out, v_out_temp );
+				}
 
-			//Copy v_out to host
-			for(j = 0; j < tile_height; j++){
-				vbx_dma_to_host(out+((l+j)*N)+k,v_out+(j*tile_height),tile_height*sizeof(vbx_mm_t));
+				db1 ^= new_in1;
+				db2 ^= new_in2;
 			}
+			vbx_dma_to_host_2D( out+l*N+c, v_out, nc*sizeof(vbx_mm_t), mc, N*sizeof(vbx_mm_t), nt*sizeof(vbx_sp_t) );
 		}
 	}
+#undef FETCH_IN1
+#undef FETCH_IN2
 
-	vbx_sp_free();
 	vbx_sync();
+	vbx_sp_pop();
+
+	return mt*nt;
+}
 
-	return bs;
+/** VBX matrix multiply of square matrices.
+ * Needs matrix B transposed already
+ *
+ * @param[in] in.
+ * @param[out] out.
+ * @param[in] N.
+ * @retval the number of elements in an out tile, or -1 if the scratchpad is too small.
+ */
+int VBX_T(vbw_mtx_mmt)( vbx_mm_t *out, vbx_mm_t *in1, vbx_mm_t *in2, int N )
+{
+	return VBX_T(vbw_mtx_mm)( out, in1, in2, N, N, N, 1 );
 }
 
 #endif // properly defined VBX_TEMPLATE_T
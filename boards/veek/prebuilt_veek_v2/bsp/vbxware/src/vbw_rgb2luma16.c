@@ -40,6 +40,37 @@
 VBXCOPYRIGHT(vbw_rgb2luma16)
 
 #include "vbx.h"
+#include "vbw_stream.h"
+
+// Converts a chunk of rows; the rows are contiguous in the scratchpad
+static void rgb2luma16_chunk(const vbw_stream_chunk_t *chunk, void *arg)
+{
+	const int    n      = chunk->rows*chunk->row_len;
+	vbx_uword_t *v_rgb  = (vbx_uword_t *)chunk->v_in[0];
+	vbx_uhalf_t *v_out  = (vbx_uhalf_t *)chunk->v_out[0];
+	vbx_uhalf_t *v_luma = (vbx_uhalf_t *)chunk->v_temp;
+	vbx_uhalf_t *v_temp = v_luma + n;
+
+	vbx_set_vl(n);
+
+	// Move weighted B into v_luma
+	vbx(SVWHU, VAND, v_temp,   0xFF, v_rgb);
+	vbx(SVHU,  VMUL, v_luma,     25, v_temp);
+
+	// Move weighted G into v_temp and add it to v_luma
+	vbx(SVWHU, VAND, v_temp,   0xFF, (vbx_uword_t*)(((vbx_ubyte_t *)v_rgb)+1));
+	vbx(SVHU,  VMUL, v_temp,    129, v_temp);
+	vbx(VVHU,  VADD, v_luma, v_luma, v_temp);
+
+	// Move weighted R into v_temp and add it to v_luma
+	vbx(SVWHU, VAND, v_temp,   0xFF, (vbx_uword_t*)(((vbx_ubyte_t *)v_rgb)+2));
+	vbx(SVHU,  VMUL, v_temp,     66, v_temp);
+	vbx(VVHU,  VADD, v_luma, v_luma, v_temp);
+
+	// Round and normalize
+	vbx(SVHU,  VADD, v_luma,  128, v_luma);
+	vbx(SVHU,  VSHR, v_out,    8, v_luma);
+}
 
 /**Convert RGB frame to 16-bit luma
  * @brief Convert RGB frame to 16-bit luma using Bt.601 coefficients.
@@ -54,60 +85,13 @@ VBXCOPYRIGHT(vbw_rgb2luma16)
  */
 int vbw_rgb2luma16(unsigned short *luma, unsigned *rgb, const short image_width, const short image_height, const short image_pitch)
 {
-	vbx_uword_t *v_row_in, *v_row_in_next, *tmp_ptr;
-	vbx_uhalf_t *v_row_out;
-	vbx_uhalf_t *v_luma, *v_temp;
-	int          i;
+	vbw_stream_t in  = { rgb,  sizeof(vbx_uword_t), image_pitch, 0, 0 };
+	vbw_stream_t out = { luma, sizeof(vbx_uhalf_t), image_pitch, 0, 0 };
 
-	vbx_set_vl(image_width);
-
-	// Allocate scratchpad memory for vectors
-	if ((v_row_in      = (vbx_uword_t *)vbx_sp_malloc(image_width*sizeof(vbx_uword_t))) == NULL
-			||  (v_row_in_next = (vbx_uword_t *)vbx_sp_malloc(image_width*sizeof(vbx_uword_t))) == NULL
-			||  (v_luma        = (vbx_uhalf_t *)vbx_sp_malloc(image_width*sizeof(vbx_uhalf_t))) == NULL
-			||  (v_temp        = (vbx_uhalf_t *)vbx_sp_malloc(image_width*sizeof(vbx_uhalf_t))) == NULL
-			||  (v_row_out     = (vbx_uhalf_t *)vbx_sp_malloc(image_width*sizeof(vbx_uhalf_t))) == NULL) {
+	// Tiles stream through the scratchpad, in strips if rows are too wide; two halfword temporaries per pixel
+	if (vbw_stream_tiled(&in, 1, &out, 1, image_height, image_width, 2*sizeof(vbx_uhalf_t), rgb2luma16_chunk, NULL)) {
 		printf("Out of scratchpad memory\n");
 		return -1;
 	}
-
-	// Transfer the first input row to scratchpad
-	vbx_dma_to_vector(v_row_in, rgb, image_width*sizeof(vbx_uword_t));
-
-	// Convert rows of RGB to luma
-	for (i = 0; i < image_height; i++) {
-		// Transfer the next input row to scratchpad while processing
-		if ((i+1) < image_height)
-			vbx_dma_to_vector(v_row_in_next, rgb + (i+1)*image_pitch, image_width*sizeof(vbx_uword_t));
-
-		// Move weighted B into v_luma
-		vbx(SVWHU, VAND, v_temp,   0xFF, v_row_in);
-		vbx(SVHU,  VMUL, v_luma,     25, v_temp);
-
-		// Move weighted G into v_temp and add it to v_luma
-        vbx(SVWHU, VAND, v_temp,   0xFF, (vbx_uword_t*)(((vbx_ubyte_t *)v_row_in)+1));
-		vbx(SVHU,  VMUL, v_temp,    129, v_temp);
-		vbx(VVHU,  VADD, v_luma, v_luma, v_temp);
-
-		// Move weighted R into v_temp and add it to v_luma
-        vbx(SVWHU, VAND, v_temp,   0xFF, (vbx_uword_t*)(((vbx_ubyte_t *)v_row_in)+2));
-		vbx(SVHU,  VMUL, v_temp,     66, v_temp);
-		vbx(VVHU,  VADD, v_luma, v_luma, v_temp);
-
-		// Round and normalize
-		vbx(SVHU,  VADD, v_luma,  128, v_luma);
-		vbx(SVHU,  VSHR, v_row_out, 8, v_luma);
-
-		// Transfer from scratchpad memory to output
-		vbx_dma_to_host(luma + i*image_pitch, v_row_out, image_width*sizeof(vbx_uhalf_t));
-
-		// Swap scratchpad input buffer pointers
-		tmp_ptr       = v_row_in;
-		v_row_in      = v_row_in_next;
-		v_row_in_next = tmp_ptr;
-	}
-
-	vbx_sync();
-	vbx_sp_free();
 	return 0;
 }
@@ -96,11 +96,55 @@ void        vbx_sp_push_debug( int LINE, const char *FNAME );
 
 void        vbx_sp_pop_debug( int LINE, const char *FNAME );
 
+#if VBX_RELEASE
+// Release builds: no checks, and the descriptor comes from vbx_mxp_ptr.
+// An allocation that does not fit takes the out-of-line path, which can
+// evict residency cache entries.
+
+static inline vbx_void_t *vbx_sp_malloc_release( size_t num_bytes )
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	char *old_sp = (char *)this_mxp->sp;
+	size_t padded = VBX_PAD_UP( num_bytes, this_mxp->scratchpad_alignment_bytes );
+
+	if( num_bytes == 0 || (size_t)((char *)this_mxp->sp_limit - old_sp) < padded ) {
+		return vbx_sp_malloc_nodebug( num_bytes );
+	}
+	this_mxp->sp = old_sp + padded;
+	return old_sp;
+}
+
+static inline void vbx_sp_free_release()
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	this_mxp->sp = this_mxp->scratchpad_addr;
+	this_mxp->spstack_top = 0;
+}
+
+static inline void vbx_sp_set_release( vbx_void_t *new_sp )
+{
+	VBX_GET_THIS_MXP()->sp = new_sp;
+}
+
+static inline void vbx_sp_push_release()
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	this_mxp->spstack[ this_mxp->spstack_top++ ] = this_mxp->sp;
+}
+
+static inline void vbx_sp_pop_release()
+{
+	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
+	this_mxp->sp = this_mxp->spstack[ --this_mxp->spstack_top ];
+}
+#endif
+
 
 // Memory APIs
 
 void       *vbx_shared_alloca_nodebug( size_t num_bytes, void *p );
 void       *vbx_shared_alloca_debug( int LINE,const  char *FNAME, size_t num_bytes, void *p );
+#define     vbx_shared_alloca_release vbx_shared_alloca_nodebug
 void       *vbx_shared_malloc( size_t num_bytes );
 void        vbx_shared_free( void *shared_ptr );
 
@@ -24,6 +24,28 @@ namespace type_manipulation{
 	template<typename T> struct representation{typedef T type;};
 	template<> struct representation<fixed>{typedef vbx_word_t type;};
 #define repr( typ ) typename type_manipulation::representation<typ>::type
+
+	//multiplication is different for fixed point
+	template<typename T> struct mul_instr{static const vinstr_t value=VMUL;};
+	template<> struct mul_instr<fixed>{static const vinstr_t value=VMULFXP;};
+
+	template<int A,int B> struct max_int{enum{value=A>B?A:B};};
+	template<bool C,typename A,typename B> struct if_{typedef A type;};
+	template<typename A,typename B> struct if_<false,A,B>{typedef B type;};
+	template<typename A,typename B> struct same{enum{value=0};};
+	template<typename A> struct same<A,A>{enum{value=1};};
+
+	//the element types widen() and narrow() convert to
+	template<typename T> struct wider;
+	template<>struct wider<vbx_byte_t>{typedef vbx_half_t type;};
+	template<>struct wider<vbx_half_t>{typedef vbx_word_t type;};
+	template<>struct wider<vbx_ubyte_t>{typedef vbx_uhalf_t type;};
+	template<>struct wider<vbx_uhalf_t>{typedef vbx_uword_t type;};
+	template<typename T> struct narrower;
+	template<>struct narrower<vbx_half_t>{typedef vbx_byte_t type;};
+	template<>struct narrower<vbx_word_t>{typedef vbx_half_t type;};
+	template<>struct narrower<vbx_uhalf_t>{typedef vbx_ubyte_t type;};
+	template<>struct narrower<vbx_uword_t>{typedef vbx_uhalf_t type;};
 }
 inline int vector_length()
 {
@@ -36,65 +58,260 @@ inline void set_vl(int vl)
 {
 	vbx_set_vl(vl);
 }
+
+/**
+ * Expressions are built at compile time. Each operator returns a node whose
+ * type records the instruction and the types of its operands, so assigning
+ * an expression to a Vector emits one instruction per node with no virtual
+ * calls, and the instructions are chosen by the compiler.
+ *
+ * Every expression type E provides:
+ *  - E::is_leaf:  the value is already in the scratchpad (a Vector, an Offset
+ *                 or a Matrix) or in a strip buffer (a HostVector)
+ *  - E::temps:    scratchpad buffers needed to evaluate E into a destination
+ *  - E::uses_dst: E writes intermediate results to its destination
+ *  - E::hosts:   number of HostVector operands
+ *  - E::value:    the element type of the view get() returns, which differs
+ *                 from T only for a widened leaf, see widen()
+ *  - E::narrow:   E::value is narrower than T
+ *  - E::mixed:    eval() may write a destination of another width
+ *  - E::bytes:    the widest element anywhere in E, the size of temporaries
+ *  - get<K>(dst,f): evaluates E into dst, using the temporary buffers
+ *    f.reg(K), f.reg(K+1), ..., and returns where the value is. A leaf
+ *    returns its own data and emits nothing.
+ *  - leaves(list): appends the HostVector operands to list
+ *
+ * Temporaries are assigned at compile time, like registers, in
+ * Sethi-Ullman order: when both operands of a node are expressions, the
+ * one needing more temporaries is evaluated first, into the node's own
+ * destination, and the other into temporary K; both are dead once the node's
+ * instruction has read them. A chain such as (a+b)*c-d therefore needs no
+ * temporary at all, (a+b)*(c+d) needs one, and in general a tree of n
+ * nodes needs at most log2(n). Operations work on the current vector
+ * length, as set by set_vl(), or on the shape of the destination Matrix.
+ */
 template<typename T>
 class ENUM{};
 template<typename T>
+class Vector;
+template<typename T>
 class Offset;
 template<typename T>
-class Vector_Op{
-	typedef typename type_manipulation::word_sized<T>::type word_T;
+class HostVector;
+template<typename T>
+class Matrix;
+template<typename T>
+class MatrixView;
+
+/** The part of a HostVector that strip evaluation binds to the scratchpad */
+struct HostLeaf{
+	char* host;                   ///< the data, in host memory
+	int elem;                     ///< size of an element in bytes
+	mutable vbx_void_t* buf[2];   ///< double buffer for its strips
+	mutable vbx_void_t* strip;    ///< the buffer holding the current strip
+};
+
+/** Base of all expressions over elements of type T; E is the expression itself */
+template<typename T,typename E>
+class Expr{
 public:
-	//these memebers must be public for annoying reasons
-	//see http://stackoverflow.com/q/16785069/1166209
-	const Vector_Op *child_L,*child_R;
-	bool needs_temp;
-	vinstr_t cmv;
-	virtual repr(T)* resolve(repr(T)* temp)const{return NULL;}
-	explicit Vector_Op():needs_temp(true),cmv(VCMV_NZ){}
-	Vector_Op(const Vector_Op *child_L,const Vector_Op *child_R):
-		child_L(child_L),child_R(child_R),needs_temp(true),cmv(VCMV_NZ){}
-	Offset<T> operator[](int offset);
-	virtual ~Vector_Op(){}
+	static const vinstr_t cmv=VCMV_NZ; ///< conditional move for cond_move() when used as a predicate
+	const E& self()const{return *static_cast<const E*>(this);}
+};
+
+/** Operands of a node: nodes are held by value, vectors by reference */
+template<typename E> struct stored{typedef const E type;};
+template<typename T> struct stored< Vector<T> >{typedef const Vector<T>& type;};
+
+/** Where a value is: its first element and, in a matrix expression, the
+ * distance in bytes from one row to the next and from one matrix to the
+ * next. A Vector has no strides, so it is used for every row. */
+template<typename R>
+struct view{
+	R* ptr;
+	int row;
+	int mat;
+	view(R* ptr,int row=0,int mat=0):ptr(ptr),row(row),mat(mat){}
+};
+
+/** The shape of one assignment: the temporaries, and how many rows and
+ * matrices each instruction covers. Temporaries are dense, vl elements
+ * per row. The 2D and 3D strides last set are kept so that a chain of
+ * instructions with the same strides sets them only once. */
+class frame{
+	vbx_void_t* const* regs;
+	int vl;
+	mutable int set2D[4];
+	mutable int set3D[4];
+public:
+	const int rows;
+	const int mats;
+	const void* const acc; ///< instructions writing here accumulate, see sum()
+	frame(vbx_void_t* const* regs,int vl,int rows=1,int mats=1,const void* acc=NULL)
+		:regs(regs),vl(vl),rows(rows),mats(mats),acc(acc)
+	{
+		for(int i=0;i<4;i++){
+			set2D[i]=set3D[i]=-1;//not set yet
+		}
+	}
+	template<typename R> view<R> reg(int k)const
+	{
+		return view<R>((R*)regs[k],vl*sizeof(R),rows*vl*sizeof(R));
+	}
+	void strides(int d,int a,int b)const
+	{
+		if(set2D[0]!=rows || set2D[1]!=d || set2D[2]!=a || set2D[3]!=b){
+			set2D[0]=rows;set2D[1]=d;set2D[2]=a;set2D[3]=b;
+			vbx_set_2D(rows,d,a,b);
+		}
+	}
+	void strides(int d,int a,int b,int d3,int a3,int b3)const
+	{
+		strides(d,a,b);
+		if(set3D[0]!=mats || set3D[1]!=d3 || set3D[2]!=a3 || set3D[3]!=b3){
+			set3D[0]=mats;set3D[1]=d3;set3D[2]=a3;set3D[3]=b3;
+			vbx_set_3D(mats,d3,a3,b3);
+		}
+	}
+};
+
+/** Issues one instruction over the shape of @a f: vbxx() for a vector,
+ * vbxx_2D() or vbxx_3D() with the operands' strides for a matrix, and the
+ * accumulating forms if @a out is the frame's accumulator. */
+#define VBX_ISSUE(a_row,a_mat,b_row,b_mat,...) \
+	if(f.mats>1){ \
+		f.strides(out.row,a_row,b_row,out.mat,a_mat,b_mat); \
+		if(out.ptr==f.acc) vbxx_acc_3D(I,__VA_ARGS__); else vbxx_3D(I,__VA_ARGS__); \
+	}else if(f.rows>1){ \
+		f.strides(out.row,a_row,b_row); \
+		if(out.ptr==f.acc) vbxx_acc_2D(I,__VA_ARGS__); else vbxx_2D(I,__VA_ARGS__); \
+	}else{ \
+		if(out.ptr==f.acc) vbxx_acc(I,__VA_ARGS__); else vbxx(I,__VA_ARGS__); \
+	}
+template<vinstr_t I,typename D,typename A,typename B>
+inline void issue(const frame& f,const view<D>& out,const view<A>& a,const view<B>& b)
+{
+	VBX_ISSUE(a.row,a.mat,b.row,b.mat,out.ptr,a.ptr,b.ptr)
+}
+template<vinstr_t I,typename D,typename S,typename B>
+inline void issue(const frame& f,const view<D>& out,S a,const view<B>& b)
+{
+	VBX_ISSUE(0,0,b.row,b.mat,out.ptr,a,b.ptr)
+}
+template<vinstr_t I,typename D,typename A>
+inline void issue(const frame& f,const view<D>& out,const view<A>& a,vbx_enum_t* e)
+{
+	VBX_ISSUE(a.row,a.mat,0,0,out.ptr,a.ptr,e)
+}
+template<vinstr_t I,typename D,typename S>
+inline void issue(const frame& f,const view<D>& out,S a,vbx_enum_t* e)
+{
+	VBX_ISSUE(0,0,0,0,out.ptr,a,e)
+}
+template<vinstr_t I,typename D,typename A>
+inline void issue(const frame& f,const view<D>& out,const view<A>& a)
+{
+	VBX_ISSUE(a.row,a.mat,0,0,out.ptr,a.ptr)
+}
+template<vinstr_t I,typename D,typename S>
+inline void issue(const frame& f,const view<D>& out,S a)
+{
+	VBX_ISSUE(0,0,0,0,out.ptr,a)
+}
+#undef VBX_ISSUE
+
+/** Evaluates a node into @a out with its eval(), or copies a leaf */
+template<bool leaf> struct evaluate{
+	template<int K,typename D,typename R,typename E>
+	static void into(const view<D>& out,const view<R>& dst,const E& e,const frame& f)
+	{
+		e.template eval<K>(out,dst,f);
+	}
+};
+template<> struct evaluate<true>{
+	template<int K,typename D,typename R,typename E>
+	static void into(const view<D>& out,const view<R>& dst,const E& e,const frame& f)
+	{
+		issue<VMOV>(f,out,e.template get<K>(dst,f));
+	}
+};
+
+/** How a node reads an operand: as it is, or first widened into the
+ * operand's destination if it is a narrower leaf the instruction cannot mix
+ * with its other operand */
+template<bool wide> struct operand{
+	template<typename T,typename E> struct of{typedef typename type_manipulation::representation<T>::type type;};
+	template<int K,typename R,typename E>
+	static view<R> get(const E& e,const view<R>& dst,const frame& f){return e.template wide<K>(dst,f);}
+};
+template<> struct operand<false>{
+	template<typename T,typename E> struct of{typedef typename E::value type;};
+	template<int K,typename R,typename E>
+	static view<typename E::value> get(const E& e,const view<R>& dst,const frame& f){return e.template get<K>(dst,f);}
 };
 
+/** Where the right operand of a node is evaluated: its own register if the left
+ * operand is using the destination */
+template<bool own> struct right_dst{
+	template<int K,typename R> static view<R> get(const view<R>& dst,const frame& f){return f.reg<R>(K);}
+};
+template<> struct right_dst<false>{
+	template<int K,typename R> static view<R> get(const view<R>& dst,const frame& f){return dst;}
+};
+
+/** Does [p,p+n) overlap [lo,hi)? */
+inline bool overlaps(const void* p,size_t n,const char* lo,const char* hi)
+{
+	return (const char*)p<hi && (const char*)p+n>lo;
+}
+
 template<typename T>
-class Vector: public Vector_Op<T>{
+class Vector: public Expr<T,Vector<T> >{
 private:
 	typedef typename type_manipulation::word_sized<T>::type scalar_type;
-	//scalar_type scalar;
 protected:
 	repr(T)* data;
 	int size;
 	Vector(){}
 public:
-	virtual repr(T)* resolve(repr(T)* temp)const;
+	enum{is_leaf=1,temps=0,uses_dst=0,hosts=0,narrow=0,mixed=0,bytes=sizeof(repr(T))};
+	typedef repr(T) value;
+	template<int K> view<repr(T)> get(const view<repr(T)>& dst,const frame& f)const{return view<repr(T)>(data);}
+	bool reads(const char* lo,const char* hi,int vl)const
+	{return overlaps(data,vl*sizeof(repr(T)),lo,hi);}
+	const HostLeaf** leaves(const HostLeaf** list)const{return list;}
+
 	explicit Vector(int size);
 	Vector(const Vector& copy);
-	virtual ~Vector();
-	Vector & operator=(const Vector_Op<T>& rhs);
+	~Vector();
+	template<typename E>
+	Vector & operator=(const Expr<T,E>& rhs);
 	Vector & operator=(const Vector& rhs);
 	Vector & operator=(scalar_type rhs);
 	//
-	Vector & cond_move(const Vector_Op<T>& predicate,const Vector_Op<T>& rhs);
-	Vector & cond_move(const Vector_Op<T>& predicate,scalar_type rhs);
+	template<typename P,typename E>
+	Vector & cond_move(const Expr<T,P>& predicate,const Expr<T,E>& rhs);
+	template<typename P>
+	Vector & cond_move(const Expr<T,P>& predicate,scalar_type rhs);
 	//compound assignments
-	Vector & operator+=(const Vector_Op<T>& rhs){return *this = *this + rhs;};
-	Vector & operator-=(const Vector_Op<T>& rhs){return *this = *this - rhs;};
-	Vector & operator*=(const Vector_Op<T>& rhs){return *this = *this * rhs;};
-	Vector & operator^=(const Vector_Op<T>& rhs){return *this = *this ^ rhs;};
-	Vector & operator|=(const Vector_Op<T>& rhs){return *this = *this | rhs;};
-	Vector & operator&=(const Vector_Op<T>& rhs){return *this = *this & rhs;};
-	Vector & operator<<=(const Vector_Op<T>& rhs){return *this = *this << rhs;};
-	Vector & operator>>=(const Vector_Op<T>& rhs){return *this = *this >> rhs;};
-	Vector & operator+=( vbx_word_t rhs){return *this = *this + rhs;};
-	Vector & operator-=( vbx_word_t rhs){return *this = *this - rhs;};
-	Vector & operator*=( vbx_word_t rhs){return *this = *this * rhs;};
-	Vector & operator^=( vbx_word_t rhs){return *this = *this ^ rhs;};
-	Vector & operator|=( vbx_word_t rhs){return *this = *this | rhs;};
-	Vector & operator&=( vbx_word_t rhs){return *this = *this & rhs;};
-	Vector & operator<<=(vbx_word_t rhs){return *this = *this << rhs;};
-	Vector & operator>>=(vbx_word_t rhs){return *this = *this >> rhs;};
+	template<typename E> Vector & operator+=(const Expr<T,E>& rhs){return *this = *this + rhs;};
+	template<typename E> Vector & operator-=(const Expr<T,E>& rhs){return *this = *this - rhs;};
+	template<typename E> Vector & operator*=(const Expr<T,E>& rhs){return *this = *this * rhs;};
+	template<typename E> Vector & operator^=(const Expr<T,E>& rhs){return *this = *this ^ rhs;};
+	template<typename E> Vector & operator|=(const Expr<T,E>& rhs){return *this = *this | rhs;};
+	template<typename E> Vector & operator&=(const Expr<T,E>& rhs){return *this = *this & rhs;};
+	template<typename E> Vector & operator<<=(const Expr<T,E>& rhs){return *this = *this << rhs;};
+	template<typename E> Vector & operator>>=(const Expr<T,E>& rhs){return *this = *this >> rhs;};
+	Vector & operator+=( scalar_type rhs){return *this = *this + rhs;};
+	Vector & operator-=( scalar_type rhs){return *this = *this - rhs;};
+	Vector & operator*=( scalar_type rhs){return *this = *this * rhs;};
+	Vector & operator^=( scalar_type rhs){return *this = *this ^ rhs;};
+	Vector & operator|=( scalar_type rhs){return *this = *this | rhs;};
+	Vector & operator&=( scalar_type rhs){return *this = *this & rhs;};
+	Vector & operator<<=(scalar_type rhs){return *this = *this << rhs;};
+	Vector & operator>>=(scalar_type rhs){return *this = *this >> rhs;};
 
+	Offset<T> operator[](int offset)const;
 	repr(T)* get_sp_ptr()const{return data;}
 	int  get_size()const{return size;}
 	void get_data(T* to)const{vbx_dma_to_host(to,data,this->size*sizeof(T));}
@@ -102,57 +319,539 @@ public:
 	void printVec(int n=-1) const;
 };
 
+/** A vector starting @a offset elements into another one. It does not own its data. */
 template<typename T>
 class Offset: public Vector<T>{
 private:
 	typedef typename type_manipulation::word_sized<T>::type scalar_type;
-	int offset;
 public:
-	explicit Offset(Vector_Op<T>* child,int offset)
-		:offset(offset)
+	Offset(const Vector<T>& base,int offset)
+	{
+		this->data=base.get_sp_ptr()+offset;
+		this->size=base.get_size()-offset;
+		vbx_sp_push();//~Vector() will undo this push
+	}
+	Offset(const Offset& copy)
 	{
-		this->child_L=child;
-		this->needs_temp=false;
+		this->data=copy.data;
+		this->size=copy.size;
+		vbx_sp_push();
 	}
-	~Offset()
-	{vbx_sp_push();}//~Vector() will undo this push
+	template<typename E>
+	Offset & operator=(const Expr<T,E>& rhs){Vector<T>::operator=(rhs);return *this;}
+	Offset & operator=(const Vector<T>& rhs){Vector<T>::operator=(rhs);return *this;}
+	Offset & operator=(const Offset& rhs)   {Vector<T>::operator=(rhs);return *this;}
+	Offset & operator=(scalar_type rhs)     {Vector<T>::operator=(rhs);return *this;}
+};
+template<typename T> struct stored< Offset<T> >{typedef const Vector<T>& type;};
+
+/**
+ * A matrix in the scratchpad: @a rows rows of @a cols elements, repeated
+ * for @a mats matrices. Assigning an expression to a Matrix issues one 2D
+ * instruction per node, or one 3D instruction if there are several
+ * matrices, instead of one instruction per row. The operands may be other
+ * matrices of the same shape, MatrixViews with their own strides, and
+ * Vectors, which are used for every row.
+ */
+template<typename T>
+class Matrix: public Expr<T,Matrix<T> >{
+private:
+	typedef typename type_manipulation::word_sized<T>::type scalar_type;
+protected:
+	repr(T)* data;
+	int rows,cols,mats;
+	int row_stride,mat_stride; ///< in elements
+	Matrix(){}
+public:
+	enum{is_leaf=1,temps=0,uses_dst=0,hosts=0,narrow=0,mixed=0,bytes=sizeof(repr(T))};
+	typedef repr(T) value;
+	template<int K> view<repr(T)> get(const view<repr(T)>& dst,const frame& f)const
+	{return view<repr(T)>(data,row_stride*sizeof(repr(T)),mat_stride*sizeof(repr(T)));}
+	bool reads(const char* lo,const char* hi,int vl)const
+	{return overlaps(data,((mats-1)*mat_stride+(rows-1)*row_stride+cols)*sizeof(repr(T)),lo,hi);}
+	const HostLeaf** leaves(const HostLeaf** list)const{return list;}
+
+	Matrix(int rows,int cols,int mats=1);
+	Matrix(const Matrix& copy);
+	~Matrix();
+	template<typename E>
+	Matrix & operator=(const Expr<T,E>& rhs){set(rhs.self());return *this;}
+	Matrix & operator=(const Matrix& rhs){set(rhs);return *this;}
+	Matrix & operator=(scalar_type rhs);
+
+	/** The @a rows by @a cols block whose top left element is at (@a row, @a col) */
+	MatrixView<T> block(int row,int col,int rows,int cols)const;
+	repr(T)* get_sp_ptr()const{return data;}
+	int  get_rows()const{return rows;}
+	int  get_cols()const{return cols;}
+	int  get_mats()const{return mats;}
+	int  get_row_stride()const{return row_stride;}
+	int  get_mat_stride()const{return mat_stride;}
+	/** Copy to or from dense host memory, matrix after matrix */
+	void get_data(T* to)const;
+	void set_data(T* from);
+private:
+	template<typename E> void set(const E& rhs);
+};
 
-	virtual repr(T)* resolve(repr(T)* temp)const
+/** A strided view of matrices already in the scratchpad. It does not own its data. */
+template<typename T>
+class MatrixView: public Matrix<T>{
+private:
+	typedef typename type_manipulation::word_sized<T>::type scalar_type;
+public:
+	/** @a rows rows of @a cols elements of @a base, @a row_stride elements
+	 * apart, repeated for @a mats matrices @a mat_stride elements apart */
+	MatrixView(const Vector<T>& base,int rows,int cols,int row_stride,int mats=1,int mat_stride=0)
 	{
-		if(temp==NULL){//return pointer
-			if(this->child_L->needs_temp){
-				temp=(repr(T)*)vbx_sp_malloc(vector_length()*sizeof(repr(T)));
-			}
-			temp=this->child_L->resolve(temp)+offset;
-		}else{//move into temp
-			if(this->child_L->needs_temp){
-				temp=this->child_L->resolve(temp);
-			}else{
-				vbxx(VMOV,temp,this->child_L->resolve(NULL));
-			}
+		init(base.get_sp_ptr(),rows,cols,row_stride,mats,mat_stride);
+	}
+	MatrixView(const Matrix<T>& base,int row,int col,int rows,int cols)
+	{
+		init(base.get_sp_ptr()+row*base.get_row_stride()+col,rows,cols,
+		     base.get_row_stride(),base.get_mats(),base.get_mat_stride());
+	}
+	MatrixView(const MatrixView& copy)
+	{
+		init(copy.data,copy.rows,copy.cols,copy.row_stride,copy.mats,copy.mat_stride);
+	}
+	template<typename E>
+	MatrixView & operator=(const Expr<T,E>& rhs){Matrix<T>::operator=(rhs);return *this;}
+	MatrixView & operator=(const Matrix<T>& rhs){Matrix<T>::operator=(rhs);return *this;}
+	MatrixView & operator=(const MatrixView& rhs){Matrix<T>::operator=(rhs);return *this;}
+	MatrixView & operator=(scalar_type rhs)     {Matrix<T>::operator=(rhs);return *this;}
+private:
+	void init(repr(T)* data,int rows,int cols,int row_stride,int mats,int mat_stride)
+	{
+		this->data=data;
+		this->rows=rows;
+		this->cols=cols;
+		this->mats=mats;
+		this->row_stride=row_stride;
+		this->mat_stride=mat_stride;
+		vbx_sp_push();//~Matrix() will undo this push
+	}
+};
+template<typename T> struct stored< Matrix<T> >{typedef const Matrix<T>& type;};
+template<typename T> struct stored< MatrixView<T> >{typedef const Matrix<T>& type;};
+
+/** vector op vector */
+template<vinstr_t I,typename T,typename L,typename R>
+class VV_OP: public Expr<T,VV_OP<I,T,L,R> >{
+	typename stored<L>::type lhs;
+	typename stored<R>::type rhs;
+public:
+	enum{
+		//two widened leaves of the same type are read as they are, in mixed width
+		mix=L::narrow && R::narrow && type_manipulation::same<typename L::value,typename R::value>::value,
+		wide_l=L::narrow && !mix,
+		wide_r=R::narrow && !mix,
+		leaf_l=L::is_leaf && !wide_l,
+		leaf_r=R::is_leaf && !wide_r,
+		own=!leaf_l && !leaf_r, ///< the operand evaluated second needs temporary K
+		left_first=(int)L::temps>=(int)R::temps,
+		is_leaf=0,
+		narrow=0,
+		mixed=1,
+		uses_dst=!(leaf_l && leaf_r),
+		hosts=(int)L::hosts+(int)R::hosts,
+		temps=!own ? (int)L::temps+(int)R::temps :
+		      left_first ? (int)type_manipulation::max_int<L::temps,1+R::temps>::value :
+		                   (int)type_manipulation::max_int<R::temps,1+L::temps>::value,
+		bytes=type_manipulation::max_int<sizeof(repr(T)),type_manipulation::max_int<L::bytes,R::bytes>::value>::value
+	};
+	typedef repr(T) value;
+	VV_OP(const L& lhs,const R& rhs):lhs(lhs),rhs(rhs){}
+	bool reads(const char* lo,const char* hi,int vl)const
+	{return lhs.reads(lo,hi,vl) || rhs.reads(lo,hi,vl);}
+	const HostLeaf** leaves(const HostLeaf** list)const{return rhs.leaves(lhs.leaves(list));}
+	template<int K,typename D> void eval(const view<D>& out,const view<repr(T)>& dst,const frame& f)const
+	{
+		typedef typename operand<wide_l>::template of<T,L>::type A;
+		typedef typename operand<wide_r>::template of<T,R>::type B;
+		if(left_first || !own){
+			view<A> a=operand<wide_l>::template get<K>(lhs,dst,f);
+			issue<I>(f,out,a,operand<wide_r>::template get<K+own>(rhs,right_dst<own>::template get<K>(dst,f),f));
+		}else{
+			view<B> b=operand<wide_r>::template get<K>(rhs,dst,f);
+			issue<I>(f,out,operand<wide_l>::template get<K+1>(lhs,f.template reg<repr(T)>(K),f),b);
 		}
-		return temp;
 	}
-	Offset & operator=(const Vector_Op<T>& rhs){Vector<T>::operator=(rhs);return *this;}
-	Offset & operator=(const Vector<T>& rhs)   {Vector<T>::operator=(rhs);return *this;}
-	Offset & operator=(const Offset& rhs)      {Vector<T>::operator=(rhs);return *this;}
-	Offset & operator=(scalar_type rhs)        {Vector<T>::operator=(rhs);return *this;}
+	template<int K> view<repr(T)> get(const view<repr(T)>& dst,const frame& f)const
+	{
+		eval<K>(dst,dst,f);
+		return dst;
+	}
+};
+/** scalar op vector */
+template<vinstr_t I,typename T,typename R>
+class SV_OP: public Expr<T,SV_OP<I,T,R> >{
+	typename type_manipulation::word_sized<T>::type scalar;
+	typename stored<R>::type rhs;
+public:
+	enum{is_leaf=0,narrow=0,mixed=1,uses_dst=!R::is_leaf,temps=R::temps,hosts=R::hosts,
+	     bytes=type_manipulation::max_int<sizeof(repr(T)),R::bytes>::value};
+	typedef repr(T) value;
+	SV_OP(typename type_manipulation::word_sized<T>::type scalar,const R& rhs):scalar(scalar),rhs(rhs){}
+	bool reads(const char* lo,const char* hi,int vl)const
+	{return rhs.reads(lo,hi,vl);}
+	const HostLeaf** leaves(const HostLeaf** list)const{return rhs.leaves(list);}
+	template<int K,typename D> void eval(const view<D>& out,const view<repr(T)>& dst,const frame& f)const
+	{
+		issue<I>(f,out,scalar,rhs.template get<K>(dst,f));
+	}
+	template<int K> view<repr(T)> get(const view<repr(T)>& dst,const frame& f)const
+	{
+		eval<K>(dst,dst,f);
+		return dst;
+	}
+};
+/** vector op enumeration */
+template<vinstr_t I,typename T,typename L>
+class VE_OP: public Expr<T,VE_OP<I,T,L> >{
+	typename stored<L>::type lhs;
+public:
+	//there are no mixed width enumeration instructions
+	enum{is_leaf=0,narrow=0,mixed=0,uses_dst=!L::is_leaf || L::narrow,temps=L::temps,hosts=L::hosts,
+	     bytes=type_manipulation::max_int<sizeof(repr(T)),L::bytes>::value};
+	typedef repr(T) value;
+	VE_OP(const L& lhs):lhs(lhs){}
+	bool reads(const char* lo,const char* hi,int vl)const
+	{return lhs.reads(lo,hi,vl);}
+	const HostLeaf** leaves(const HostLeaf** list)const{return lhs.leaves(list);}
+	template<int K,typename D> void eval(const view<D>& out,const view<repr(T)>& dst,const frame& f)const
+	{
+		issue<I>(f,out,operand<L::narrow>::template get<K>(lhs,dst,f),(vbx_enum_t*)NULL);
+	}
+	template<int K> view<repr(T)> get(const view<repr(T)>& dst,const frame& f)const
+	{
+		eval<K>(dst,dst,f);
+		return dst;
+	}
+};
+/** scalar op enumeration */
+template<vinstr_t I,typename T>
+class SE_OP: public Expr<T,SE_OP<I,T> >{
+	typename type_manipulation::word_sized<T>::type scalar;
+public:
+	enum{is_leaf=0,narrow=0,mixed=0,uses_dst=0,temps=0,hosts=0,bytes=sizeof(repr(T))};
+	typedef repr(T) value;
+	SE_OP(typename type_manipulation::word_sized<T>::type scalar):scalar(scalar){}
+	bool reads(const char* lo,const char* hi,int vl)const{return false;}
+	const HostLeaf** leaves(const HostLeaf** list)const{return list;}
+	template<int K,typename D> void eval(const view<D>& out,const view<repr(T)>& dst,const frame& f)const
+	{
+		issue<I>(f,out,scalar,(vbx_enum_t*)NULL);
+	}
+	template<int K> view<repr(T)> get(const view<repr(T)>& dst,const frame& f)const
+	{
+		eval<K>(dst,dst,f);
+		return dst;
+	}
+};
+/** Comparison of two vectors. Its value is their difference; cond_move() tests it with CMV. */
+template<vinstr_t CMV,typename T,typename L,typename R>
+class COMP_VV_OP: public Expr<T,COMP_VV_OP<CMV,T,L,R> >{
+	VV_OP<VSUB,T,L,R> sub;
+public:
+	static const vinstr_t cmv=CMV;
+	enum{is_leaf=0,narrow=0,mixed=1,uses_dst=VV_OP<VSUB,T,L,R>::uses_dst,temps=VV_OP<VSUB,T,L,R>::temps,
+	     hosts=VV_OP<VSUB,T,L,R>::hosts,bytes=VV_OP<VSUB,T,L,R>::bytes};
+	typedef repr(T) value;
+	COMP_VV_OP(const L& lhs,const R& rhs):sub(lhs,rhs){}
+	bool reads(const char* lo,const char* hi,int vl)const
+	{return sub.reads(lo,hi,vl);}
+	const HostLeaf** leaves(const HostLeaf** list)const{return sub.leaves(list);}
+	template<int K,typename D> void eval(const view<D>& out,const view<repr(T)>& dst,const frame& f)const
+	{
+		sub.template eval<K>(out,dst,f);
+	}
+	template<int K> view<repr(T)> get(const view<repr(T)>& dst,const frame& f)const
+	{
+		return sub.template get<K>(dst,f);
+	}
+};
+/** Comparison of a scalar and a vector */
+template<vinstr_t CMV,typename T,typename R>
+class COMP_SV_OP: public Expr<T,COMP_SV_OP<CMV,T,R> >{
+	typename type_manipulation::word_sized<T>::type scalar;
+	typename stored<R>::type rhs;
+public:
+	static const vinstr_t cmv=CMV;
+	enum{is_leaf=0,narrow=0,mixed=1,uses_dst=!R::is_leaf || R::narrow,temps=R::temps,hosts=R::hosts,
+	     bytes=type_manipulation::max_int<sizeof(repr(T)),R::bytes>::value};
+	typedef repr(T) value;
+	COMP_SV_OP(typename type_manipulation::word_sized<T>::type scalar,const R& rhs):scalar(scalar),rhs(rhs){}
+	bool reads(const char* lo,const char* hi,int vl)const
+	{return rhs.reads(lo,hi,vl);}
+	const HostLeaf** leaves(const HostLeaf** list)const{return rhs.leaves(list);}
+	template<int K,typename D> void eval(const view<D>& out,const view<repr(T)>& dst,const frame& f)const
+	{
+		issue<VSUB>(f,out,scalar,operand<R::narrow>::template get<K>(rhs,dst,f));
+	}
+	template<int K> view<repr(T)> get(const view<repr(T)>& dst,const frame& f)const
+	{
+		view<repr(T)> src=operand<R::narrow>::template get<K>(rhs,dst,f);
+		if(scalar==0 && (CMV==VCMV_Z || CMV==VCMV_NZ)){
+			//skip the subtraction if checking equality with zero, it isn't necessary
+			return src;
+		}
+		issue<VSUB>(f,dst,scalar,src);
+		return dst;
+	}
 };
 
-template<typename T>
-Offset<T> Vector_Op<T>::operator[](int offset)
+/** A leaf of type S read as the wider type T. It emits nothing: the
+ * instruction that reads it is issued in mixed width, or, if it cannot be,
+ * the leaf is widened with a VMOV first. */
+template<typename T,typename S,typename E>
+class CAST_LEAF: public Expr<T,CAST_LEAF<T,S,E> >{
+	typename stored<E>::type e;
+public:
+	enum{is_leaf=1,narrow=sizeof(typename E::value)!=sizeof(repr(T)),mixed=0,uses_dst=0,temps=0,hosts=E::hosts,
+	     bytes=type_manipulation::max_int<sizeof(repr(T)),E::bytes>::value};
+	typedef typename E::value value;
+	CAST_LEAF(const E& e):e(e){}
+	bool reads(const char* lo,const char* hi,int vl)const
+	{return e.reads(lo,hi,vl);}
+	const HostLeaf** leaves(const HostLeaf** list)const{return e.leaves(list);}
+	template<int K> view<value> get(const view<repr(T)>& dst,const frame& f)const
+	{
+		return e.template get<K>(view<repr(S)>(NULL),f);
+	}
+	template<int K> view<repr(T)> wide(const view<repr(T)>& dst,const frame& f)const
+	{
+		issue<VMOV>(f,dst,get<K>(dst,f));
+		return dst;
+	}
+};
+/** An expression of type S converted to type T. Its last instruction
+ * writes type T directly, in mixed width, unless it is an enumeration. */
+template<typename T,typename S,typename E>
+class CONVERT: public Expr<T,CONVERT<T,S,E> >{
+	typename stored<E>::type e;
+public:
+	enum{
+		own=!E::is_leaf && (!E::mixed || E::uses_dst), ///< E's intermediate results go to temporary K
+		is_leaf=0,
+		narrow=0,
+		mixed=1,
+		uses_dst=0,
+		temps=(int)own+(int)E::temps,
+		hosts=E::hosts,
+		bytes=type_manipulation::max_int<sizeof(repr(T)),E::bytes>::value
+	};
+	typedef repr(T) value;
+	CONVERT(const E& e):e(e){}
+	bool reads(const char* lo,const char* hi,int vl)const
+	{return e.reads(lo,hi,vl);}
+	const HostLeaf** leaves(const HostLeaf** list)const{return e.leaves(list);}
+	template<int K,typename D> void eval(const view<D>& out,const view<repr(T)>& dst,const frame& f)const
+	{
+		evaluate<!E::mixed>::template into<K+own>(out,own ? f.template reg<repr(S)>(K) : view<repr(S)>(NULL),e,f);
+	}
+	template<int K> view<repr(T)> get(const view<repr(T)>& dst,const frame& f)const
+	{
+		eval<K>(dst,dst,f);
+		return dst;
+	}
+};
+/** The node converting an expression of type S to type T: a leaf no wider
+ * than T is only cast */
+template<typename T,typename S,typename E>
+struct converted{
+	typedef typename type_manipulation::if_<E::is_leaf && sizeof(typename E::value)<=sizeof(repr(T)),
+		CAST_LEAF<T,S,E>,CONVERT<T,S,E> >::type type;
+};
+
+/**
+ * Mixed width conversions. widen() gives the next wider type and narrow()
+ * the next narrower one, keeping the signedness. They add no instruction of
+ * their own: the instruction next to the conversion is issued in mixed
+ * width, so with bytes a Vector<vbx_ubyte_t>,
+ *
+ *     Vector<vbx_uhalf_t> h = widen(bytes) << 1;
+ *
+ * is a single SVBHU shift, and narrow(h >> 2) a single SVHBU shift writing
+ * bytes. MXP computes in the wider of the two widths, so narrow(e) equals e
+ * truncated, and widen(e) computes the last operation of e at the wider
+ * width, as widen(a)+widen(b) would for widen(a+b). A widened leaf that
+ * meets an operand of another width, or an enumeration, is widened with a
+ * VMOV first.
+ */
+template<typename T,typename E>
+typename converted<typename type_manipulation::wider<T>::type,T,E>::type widen(const Expr<T,E>& e)
 {
-	return Offset<T>(this,offset);
+	return typename converted<typename type_manipulation::wider<T>::type,T,E>::type(e.self());
 }
+template<typename T,typename E>
+typename converted<typename type_manipulation::narrower<T>::type,T,E>::type narrow(const Expr<T,E>& e)
+{
+	return typename converted<typename type_manipulation::narrower<T>::type,T,E>::type(e.self());
+}
+
+/** Evaluates @a rhs into @a out, over @a rows rows and @a mats matrices of
+ * the current vector length. Intermediate results go to @a out as well,
+ * unless @a rhs reads it or @a keep_out is set, in which case they go to an
+ * extra temporary. Returns 0, or -1 if the scratchpad is full.
+ */
+template<typename T,typename E>
+int assign(const view<repr(T)>& out,const E& rhs,bool keep_out,int rows=1,int mats=1)
+{
+	const int vl=vector_length();
+	const size_t bytes=vl*rows*mats*E::bytes;
+	const char* lo=(char*)out.ptr;
+	const char* hi=lo+(mats-1)*out.mat+(rows-1)*out.row+vl*sizeof(repr(T));
+	vbx_void_t* regs[E::temps+1];
+	frame f(regs,vl,rows,mats);
+	view<repr(T)> dst=out;
+	int n=E::temps;
+	if(E::uses_dst && (keep_out || rhs.reads(lo,hi,vl))){
+		n++;
+	}
+	vbx_sp_push();
+	for(int i=0;i<n;i++){
+		regs[i]=vbx_sp_malloc(bytes);
+		if(!regs[i]){
+			VBX_PRINTF("ERROR: out of scratchpad for %d temporary vectors.\n",n);
+			vbx_sp_pop();
+			return -1;
+		}
+	}
+	if(n>E::temps){
+		dst=f.template reg<repr(T)>(E::temps);
+	}
+	evaluate<E::is_leaf>::template into<0>(out,dst,rhs,f);
+	vbx_sp_pop();
+	return 0;
+}
+
+template<typename T,typename E>
+int stream(HostVector<T>& out,const E& rhs);
+
+/**
+ * A vector in host memory, for data larger than the scratchpad. Assigning
+ * an expression to a HostVector evaluates it in strips as long as the free
+ * scratchpad allows: while one strip is computed, the next strip of every
+ * HostVector operand is DMAed in and the previous result is DMAed out.
+ *
+ * The host memory should be allocated with vbx_shared_malloc(). A Vector
+ * operand is used unchanged for every strip, so it must be at least a strip
+ * long, and ENUM counts from 0 at the start of each strip.
+ */
 template<typename T>
-repr(T)* Vector<T>::resolve(repr(T)* tmp) const
+class HostVector: public Expr<T,HostVector<T> >, public HostLeaf{
+private:
+	int size;
+	bool owner;
+	HostVector(const HostVector& copy);
+public:
+	enum{is_leaf=1,temps=0,uses_dst=0,hosts=1,narrow=0,mixed=0,bytes=sizeof(repr(T))};
+	typedef repr(T) value;
+	template<int K> view<repr(T)> get(const view<repr(T)>& dst,const frame& f)const{return view<repr(T)>((repr(T)*)strip);}
+	bool reads(const char* lo,const char* hi,int vl)const{return false;}
+	const HostLeaf** leaves(const HostLeaf** list)const{*list=this;return list+1;}
+
+	/** Uses @a size elements at @a data, which stay owned by the caller */
+	HostVector(repr(T)* data,int size):size(size),owner(false){host=(char*)data;elem=sizeof(repr(T));}
+	/** Allocates @a size elements with vbx_shared_malloc() */
+	explicit HostVector(int size):size(size),owner(true)
+	{
+		host=(char*)vbx_shared_malloc(size*sizeof(repr(T)));
+		elem=sizeof(repr(T));
+	}
+	~HostVector(){if(owner) vbx_shared_free(host);}
+	template<typename E>
+	HostVector & operator=(const Expr<T,E>& rhs){stream<T>(*this,rhs.self());return *this;}
+	HostVector & operator=(const HostVector& rhs){stream<T>(*this,rhs);return *this;}
+	repr(T)* get_host_ptr()const{return (repr(T)*)host;}
+	int  get_size()const{return size;}
+};
+template<typename T> struct stored< HostVector<T> >{typedef const HostVector<T>& type;};
+
+/** Evaluates @a rhs into @a out one strip at a time, double buffering the
+ * HostVector operands. Returns 0, or -1 if the scratchpad is full.
+ */
+template<typename T,typename E>
+int stream(HostVector<T>& out,const E& rhs)
 {
-	if (tmp==NULL){
-		return this->data;
-	}else{//move into tmp
-		vbxx(VMOV,tmp,this->data);
-		return tmp;
+	vbx_mxp_t* this_mxp=VBX_GET_THIS_MXP();
+	const HostLeaf* in[E::hosts+1];
+	vbx_void_t* regs[E::temps+1];
+	repr(T)* v_out[2];
+	const int elem=sizeof(repr(T));
+	const int size=out.get_size();
+	int i,j,m=0;
+	int n=rhs.leaves(in)-in;
+
+	//an operand used more than once is only transferred once
+	for(i=0;i<n;i++){
+		for(j=0;j<m && in[j]!=in[i];j++);
+		if(j==m){
+			in[m++]=in[i];
+		}
+	}
+
+	//split the free scratchpad by element size, in whole scratchpad rows so nothing is lost to padding
+	const int nbuf=2*m+2+E::temps;
+	const int align=this_mxp->scratchpad_alignment_bytes;
+	int per=2*elem+E::temps*E::bytes;
+	for(i=0;i<m;i++){
+		per+=2*in[i]->elem;
+	}
+	int strip=vbx_sp_getfree()/per/align*align;
+	if(strip<=0){
+		VBX_PRINTF("ERROR: out of scratchpad for %d strip buffers.\n",nbuf);
+		return -1;
+	}
+	if(strip>size){
+		strip=size;
+	}
+
+	int vl=vector_length();
+	vbx_sp_push();
+	for(i=0;i<m;i++){
+		in[i]->buf[0]=vbx_sp_malloc(strip*in[i]->elem);
+		in[i]->buf[1]=vbx_sp_malloc(strip*in[i]->elem);
+	}
+	v_out[0]=(repr(T)*)vbx_sp_malloc(strip*elem);
+	v_out[1]=(repr(T)*)vbx_sp_malloc(strip*elem);
+	for(i=0;i<E::temps;i++){
+		regs[i]=vbx_sp_malloc(strip*E::bytes);
 	}
+
+	for(i=0;i<m;i++){
+		vbx_dma_to_vector(in[i]->buf[0],in[i]->host,strip*in[i]->elem);
+	}
+	for(int start=0,s=0;start<size;start+=strip,s^=1){
+		int len=min(strip,size-start);
+		int next=start+strip;
+		if(next<size){
+			for(i=0;i<m;i++){
+				vbx_dma_to_vector(in[i]->buf[!s],in[i]->host+next*in[i]->elem,min(strip,size-next)*in[i]->elem);
+			}
+		}
+		for(i=0;i<m;i++){
+			in[i]->strip=in[i]->buf[s];
+		}
+		set_vl(len);
+		frame f(regs,len);
+		view<typename E::value> result=rhs.template get<0>(view<repr(T)>(v_out[s]),f);
+		if((void*)result.ptr!=(void*)v_out[s]){
+			issue<VMOV>(f,view<repr(T)>(v_out[s]),result);
+		}
+		vbx_dma_to_host(out.get_host_ptr()+start,v_out[s],len*elem);
+	}
+	vbx_sp_pop();
+	set_vl(vl);
+	vbx_sync();
+	return 0;
+}
+
+template<typename T>
+Offset<T> Vector<T>::operator[](int offset)const
+{
+	return Offset<T>(*this,offset);
 }
 template<typename T>
 void Vector<T>::printVec(int n) const
@@ -164,7 +863,7 @@ void Vector<T>::printVec(int n) const
 		sz=get_size();
 	}
 	T* v=(T*)malloc(sizeof(T)*sz);
-	vbx_dma_to_host(v,this->resolve(NULL),sizeof(T)*sz);
+	vbx_dma_to_host(v,this->data,sizeof(T)*sz);
 	vbx_sync();
 	for(int i=0;i<sz;i++){
 		printf("[%d]=%d\n", i,v[i]);
@@ -173,23 +872,19 @@ void Vector<T>::printVec(int n) const
 }
 
 template<typename T>
-Vector<T>::Vector(int size):
-	Vector_Op<T>()
+Vector<T>::Vector(int size)
 {
-	this->needs_temp=false;
 	this->size=size;
 	vbx_sp_push();
 	data=(repr(T)*)vbx_sp_malloc(this->size*sizeof(repr(T)));
 }
 template<typename T>
-Vector<T>::Vector(const Vector& copy):
-	Vector_Op<T>()
+Vector<T>::Vector(const Vector& copy)
 {
 	vbx_sp_push();
 	this->size=copy.size;
 	data=(repr(T)*)vbx_sp_malloc(this->size*sizeof(repr(T)));
-	copy.resolve(data);
-	this->needs_temp=false;
+	vbxx(VMOV,data,copy.data);
 }
 template <typename T>
 Vector<T>::~Vector<T>()
@@ -197,182 +892,280 @@ Vector<T>::~Vector<T>()
 	vbx_sp_pop();
 }
 template <typename T>
-Vector<T> & Vector<T>::operator=(const Vector_Op<T>& rhs)
+template <typename E>
+Vector<T> & Vector<T>::operator=(const Expr<T,E>& rhs)
 {
-	vbx_sp_push();
-	rhs.resolve(this->resolve(NULL));
-	vbx_sp_pop();
+	if(E::is_leaf){
+		frame f(NULL,0);
+		view<typename E::value> src=rhs.self().template get<0>(view<repr(T)>(data),f);
+		if((void*)src.ptr!=(void*)data){
+			issue<VMOV>(f,view<repr(T)>(data),src);
+		}
+	}else{
+		assign<T>(view<repr(T)>(data),rhs.self(),false);
+	}
 	return *this;
 }
 template <typename T>
 Vector<T> & Vector<T>::operator=(const Vector<T>& rhs)
 {
-	vbx_sp_push();
-	rhs.resolve(this->resolve(NULL));
-	vbx_sp_pop();
+	if(rhs.data!=data){
+		vbxx(VMOV,data,rhs.data);
+	}
 	return *this;
 }
 template <typename T>
 Vector<T> & Vector<T>::operator=(scalar_type rhs)
 {
-	vbx_sp_push();
-	vbxx(VMOV,this->resolve(NULL),rhs);
-	vbx_sp_pop();
+	vbxx(VMOV,data,rhs);
+	return *this;
+}
+template<typename T>
+template<typename P,typename E>
+Vector<T>& Vector<T>::cond_move(const Expr<T,P>& predicate,const Expr<T,E>& rhs)
+{
+	//the destination keeps its value where the predicate fails, so it cannot hold intermediates
+	assign<T>(view<repr(T)>(data),VV_OP<P::cmv,T,E,P>(rhs.self(),predicate.self()),true);
 	return *this;
 }
 template<typename T>
-Vector<T>& Vector<T>::cond_move(const Vector_Op<T>& predicate,const Vector_Op<T>& data)
+template<typename P>
+Vector<T>& Vector<T>::cond_move(const Expr<T,P>& predicate,scalar_type rhs)
+{
+	assign<T>(view<repr(T)>(data),SV_OP<P::cmv,T,P>(rhs,predicate.self()),true);
+	return *this;
+}
+
+template<typename T>
+Matrix<T>::Matrix(int rows,int cols,int mats)
+	:rows(rows),cols(cols),mats(mats),row_stride(cols),mat_stride(rows*cols)
 {
 	vbx_sp_push();
-	T *d=NULL,*p=NULL;
-	if(predicate.needs_temp){
-		p=(repr(T)*)vbx_sp_malloc(vector_length()*sizeof(repr(T)));
-	}
-	if (data.needs_temp){
-		d=(repr(T)*)vbx_sp_malloc(vector_length()*sizeof(repr(T)));
-	}
-	vbxx(predicate.cmv,this->resolve(NULL),data.resolve(d),predicate.resolve(p));
-	vbx_sp_pop();
-   return *this;
+	data=(repr(T)*)vbx_sp_malloc(mats*rows*cols*sizeof(repr(T)));
 }
 template<typename T>
-Vector<T>& Vector<T>::cond_move(const Vector_Op<T>& predicate,Vector<T>::scalar_type data)
+Matrix<T>::Matrix(const Matrix& copy)
+	:rows(copy.rows),cols(copy.cols),mats(copy.mats),row_stride(cols),mat_stride(rows*cols)
 {
 	vbx_sp_push();
-	repr(T)* p=NULL;
-	if (predicate.needs_temp){
-		p=(repr(T)*)vbx_sp_malloc(vector_length()*sizeof(repr(T)));
-	}
-	vbxx(predicate.cmv,this->resolve(NULL),data,predicate.resolve(p));
+	data=(repr(T)*)vbx_sp_malloc(mats*rows*cols*sizeof(repr(T)));
+	*this=copy;
+}
+template<typename T>
+Matrix<T>::~Matrix()
+{
 	vbx_sp_pop();
-	return *this;
 }
-
 template<typename T>
-class VV_OP:public Vector_Op<T>
+template<typename E>
+void Matrix<T>::set(const E& rhs)
 {
-	vinstr_t instr;
-public:
-	virtual repr(T)* resolve(repr(T)* dest) const
-	{
-		repr(T)* srcL=NULL;
-      if (this->child_L->needs_temp)
-	      srcL=(repr(T)*)vbx_sp_malloc(vector_length()*sizeof(repr(T)));
-      srcL=this->child_L->resolve(srcL);
-      repr(T)* srcR=NULL;
-      if (this->child_R->needs_temp)
-	      srcR=(repr(T)*)vbx_sp_malloc(vector_length()*sizeof(repr(T)));
-      srcR=this->child_R->resolve(srcR);
-      vbxx(this->instr,dest,srcL,srcR);
-      return dest;
-	}
-	VV_OP(const Vector_Op<T>* lhs, const Vector_Op<T>* rhs,vinstr_t instr)
-		:Vector_Op<T>(lhs,rhs),instr(instr)
-	{}
-};
+	const int elem=sizeof(repr(T));
+	int vl=vector_length();
+	set_vl(cols);
+	assign<T>(view<repr(T)>(data,row_stride*elem,mat_stride*elem),rhs,false,rows,mats);
+	set_vl(vl);
+}
 template<typename T>
-class SV_OP:public Vector_Op<T>
+Matrix<T> & Matrix<T>::operator=(scalar_type rhs)
 {
-	typename type_manipulation::word_sized<T>::type scalar;
-	vinstr_t instr;
-public:
-	virtual repr(T)* resolve(repr(T)* dest) const
-	{
-		repr(T)* srcR=NULL;
-      if (this->child_R->needs_temp)
-	      srcR=(repr(T)*)vbx_sp_malloc(vector_length()*sizeof(repr(T)));
-      srcR=this->child_R->resolve(srcR);
-      vbxx(this->instr,dest,scalar,srcR);
-      return dest;
-	}
-	SV_OP(typename type_manipulation::word_sized<T>::type s, const Vector_Op<T>* rhs,vinstr_t instr)
-		:Vector_Op<T>(NULL,rhs),scalar(s),instr(instr)
-	{}
-};
+	const int elem=sizeof(repr(T));
+	int vl=vector_length();
+	set_vl(cols);
+	issue<VMOV>(frame(NULL,cols,rows,mats),view<repr(T)>(data,row_stride*elem,mat_stride*elem),rhs);
+	set_vl(vl);
+	return *this;
+}
 template<typename T>
-class VE_OP:public Vector_Op<T>
+MatrixView<T> Matrix<T>::block(int row,int col,int rows,int cols)const
 {
-	vinstr_t instr;
-public:
-	virtual repr(T)* resolve(repr(T)* dest) const
-	{
-		vbx_enum_t* srcR=NULL;
-		repr(T)* srcL=NULL;
-      if (this->child_L->needs_temp)
-	      srcL=(repr(T)*)vbx_sp_malloc(vector_length()*sizeof(repr(T)));
-      srcL=this->child_L->resolve(srcL);
-      vbxx(this->instr,dest,srcL,srcR);
-      return dest;
-	}
-	VE_OP(const Vector_Op<T>* lhs,vinstr_t instr)
-		:Vector_Op<T>(lhs,NULL),instr(instr)
-	{}
-};
+	MatrixView<T> v(*this,row,col,rows,cols);
+	return v;
+}
 template<typename T>
-class SE_OP:public Vector_Op<T>
+void Matrix<T>::get_data(T* to)const
 {
-	typename type_manipulation::word_sized<T>::type scalar;
-	vinstr_t instr;
-public:
-	virtual repr(T)* resolve(repr(T)* dest) const
-	{
-		vbx_enum_t* srcR=NULL;
-      vbxx(this->instr,dest,scalar,srcR);
-      return dest;
+	const int elem=sizeof(repr(T));
+	for(int m=0;m<mats;m++){
+		vbx_dma_to_host_2D(to+m*rows*cols,data+m*mat_stride,cols*elem,rows,cols*elem,row_stride*elem);
 	}
-	SE_OP(typename type_manipulation::word_sized<T>::type s,vinstr_t instr)
-		:Vector_Op<T>(NULL,NULL),scalar(s),instr(instr)
-	{}
-};
+}
 template<typename T>
-class COMP_VV_OP:public Vector_Op<T>{
-public:
-	virtual repr(T)* resolve(repr(T)* dest) const
-	{
-		repr(T)* srcL=NULL;
-      if (this->child_L->needs_temp)
-	      srcL=(repr(T)*)vbx_sp_malloc(vector_length()*sizeof(repr(T)));
-      srcL=this->child_L->resolve(srcL);
-      repr(T)* srcR=NULL;
-      if (this->child_R->needs_temp)
-	      srcR=(repr(T)*)vbx_sp_malloc(vector_length()*sizeof(repr(T)));
-      srcR=this->child_R->resolve(srcR);
-      vbxx(VSUB,dest,srcL,srcR);
-      return dest;
-	}
-	COMP_VV_OP(const Vector_Op<T>*lhs,const Vector_Op<T>*rhs,vinstr_t cmv_instr)
-		:Vector_Op<T>(lhs,rhs)
-	{
-		this->cmv=cmv_instr;
+void Matrix<T>::set_data(T* from)
+{
+	const int elem=sizeof(repr(T));
+	for(int m=0;m<mats;m++){
+		vbx_dma_to_vector_2D(data+m*mat_stride,from+m*rows*cols,cols*elem,rows,row_stride*elem,cols*elem);
 	}
-};
-template<typename T>
-class COMP_SV_OP:public Vector_Op<T>{
-	typename type_manipulation::word_sized<T>::type scalar;
-public:
-	virtual repr(T)* resolve(repr(T)* dest) const
-	{
-		repr(T)* srcR=NULL;
-      if (this->child_R->needs_temp)
-	      srcR=(repr(T)*)vbx_sp_malloc(vector_length()*sizeof(repr(T)));
-      srcR=this->child_R->resolve(srcR);
-      if(scalar== 0 and (this->cmv == VCMV_Z || this->cmv == VCMV_NZ)){
-	      //skip the subtraction if checking equality with zero, it isn't necessary
-	      dest=srcR;
-      }else{
-	      vbxx(VSUB,dest,scalar,srcR);
-      }
-      return dest;
-	}
-	COMP_SV_OP(typename type_manipulation::word_sized<T>::type scalar,const Vector_Op<T>*rhs,vinstr_t cmv_instr)
-		:Vector_Op<T>(NULL,rhs),scalar(scalar)
-	{
-		this->cmv=cmv_instr;
+}
+
+#include "vbx_operators.hpp"
+
+/**
+ * Reductions. sum() and row_sums() evaluate an expression as an assignment
+ * would, except that its last instruction is issued in accumulate mode, so
+ * sum(a*b) is a single vbxx_acc() and row_sums() of a matrix expression a
+ * single vbxx_acc_2D() or vbxx_acc_3D(). The sums wrap like T.
+ *
+ * minimum(), maximum(), argmin() and argmax() fold the vector in halves in
+ * the scratchpad, log2(vl) steps of two or three instructions each, with
+ * the comparison flag of VSUB so that differences may wrap.
+ *
+ * The functions returning a scalar wait for it with vbx_sync().
+ */
+template<typename T,typename E>
+int accumulate(const view<repr(T)>& out,const E& rhs,int rows,int mats)
+{
+	const int vl=vector_length();
+	const size_t bytes=vl*rows*mats*E::bytes;
+	const int n=E::temps+E::uses_dst;//intermediate results cannot go to out, it is too short
+	vbx_void_t* regs[E::temps+1];
+	frame f(regs,vl,rows,mats,out.ptr);
+	vbx_sp_push();
+	for(int i=0;i<n;i++){
+		regs[i]=vbx_sp_malloc(bytes);
+		if(!regs[i]){
+			VBX_PRINTF("ERROR: out of scratchpad for %d temporary vectors.\n",n);
+			vbx_sp_pop();
+			return -1;
+		}
 	}
-};
+	view<repr(T)> dst=E::uses_dst ? f.template reg<repr(T)>(E::temps) : out;
+	evaluate<E::is_leaf>::template into<0>(out,dst,rhs,f);
+	vbx_sp_pop();
+	return 0;
+}
 
+/** Sum of the elements of @a rhs over the current vector length */
+template<typename T,typename E>
+typename type_manipulation::word_sized<T>::type sum(const Expr<T,E>& rhs)
+{
+	typename type_manipulation::word_sized<T>::type result=0;
+	vbx_sp_push();
+	repr(T)* v_sum=(repr(T)*)vbx_sp_malloc(sizeof(repr(T)));
+	if(v_sum && !accumulate<T>(view<repr(T)>(v_sum),rhs.self(),1,1)){
+		vbx_sync();
+		result=v_sum[0];
+	}
+	vbx_sp_pop();
+	return result;
+}
+
+/** Dot product of @a a and @a b over the current vector length */
+template<typename T,typename L,typename R>
+typename type_manipulation::word_sized<T>::type dot(const Expr<T,L>& a,const Expr<T,R>& b)
+{
+	return sum(a*b);
+}
+
+/** Sums each row of @a rhs over @a rows rows of @a cols elements, and
+ * @a mats matrices, into consecutive elements of @a out. The operands'
+ * strides are their own, as in a Matrix assignment. */
+template<typename T,typename E>
+int row_sums(Vector<T>& out,const Expr<T,E>& rhs,int rows,int cols,int mats=1)
+{
+	const int elem=sizeof(repr(T));
+	int vl=vector_length();
+	set_vl(cols);
+	int err=accumulate<T>(view<repr(T)>(out.get_sp_ptr(),elem,rows*elem),rhs.self(),rows,mats);
+	set_vl(vl);
+	return err;
+}
+
+/** Folds the @a n elements of @a v, and of @a idx if it is not NULL, onto
+ * element 0, keeping the smaller one (or the greater one if @a greater)
+ * of each pair. @a t has room for n/2 elements. */
+template<typename R>
+void fold(R* v,R* idx,R* t,int n,bool greater)
+{
+	while(n>1){
+		int h=(n+1)/2;
+		set_vl(n-h);
+		if(greater){
+			vbxx(VSUB,t,v,v+h);
+		}else{
+			vbxx(VSUB,t,v+h,v);
+		}
+		vbxx(VCMV_LTZ,v,v+h,t);
+		if(idx){
+			vbxx(VCMV_LTZ,idx,idx+h,t);
+		}
+		n=h;
+	}
+}
+
+/** Evaluates @a rhs and folds it, see fold(). Returns the index if @a arg is set, else the value */
+template<typename T,typename E>
+typename type_manipulation::word_sized<T>::type extreme(const E& rhs,bool greater,bool arg)
+{
+	typedef typename type_manipulation::word_sized<T>::type W;
+	const int vl=vector_length();
+	W result=0;
+	vbx_sp_push();
+	repr(T)* v=(repr(T)*)vbx_sp_malloc(vl*sizeof(repr(T)));
+	if(!v){
+		VBX_PRINTF("ERROR: out of scratchpad for %d elements.\n",vl);
+		vbx_sp_pop();
+		return 0;
+	}
+	assign<T>(view<repr(T)>(v),rhs,false);
+	if(arg){
+		//indices need a word each, so compare words
+		W* w=(W*)v;
+		if(sizeof(repr(T))!=sizeof(W)){
+			w=(W*)vbx_sp_malloc(vl*sizeof(W));
+			vbxx(VMOV,w,v);
+		}
+		W* idx=(W*)vbx_sp_malloc(vl*sizeof(W));
+		W* t=(W*)vbx_sp_malloc((vl/2+1)*sizeof(W));
+		if(!w || !idx || !t){
+			VBX_PRINTF("ERROR: out of scratchpad for %d indices.\n",vl);
+		}else{
+			vbxx(VADD,idx,(W)0,(vbx_enum_t*)NULL);
+			fold(w,idx,t,vl,greater);
+			vbx_sync();
+			result=idx[0];
+		}
+	}else{
+		repr(T)* t=(repr(T)*)vbx_sp_malloc((vl/2+1)*sizeof(repr(T)));
+		if(!t){
+			VBX_PRINTF("ERROR: out of scratchpad for %d elements.\n",vl/2+1);
+		}else{
+			fold(v,(repr(T)*)NULL,t,vl,greater);
+			vbx_sync();
+			result=v[0];
+		}
+	}
+	set_vl(vl);
+	vbx_sp_pop();
+	return result;
+}
+
+/** Smallest element of @a rhs over the current vector length */
+template<typename T,typename E>
+typename type_manipulation::word_sized<T>::type minimum(const Expr<T,E>& rhs)
+{
+	return extreme<T>(rhs.self(),false,false);
+}
+/** Greatest element of @a rhs over the current vector length */
+template<typename T,typename E>
+typename type_manipulation::word_sized<T>::type maximum(const Expr<T,E>& rhs)
+{
+	return extreme<T>(rhs.self(),true,false);
+}
+/** Index of a smallest element of @a rhs; with ties, any of their indices */
+template<typename T,typename E>
+int argmin(const Expr<T,E>& rhs)
+{
+	return extreme<T>(rhs.self(),false,true);
+}
+/** Index of a greatest element of @a rhs; with ties, any of their indices */
+template<typename T,typename E>
+int argmax(const Expr<T,E>& rhs)
+{
+	return extreme<T>(rhs.self(),true,true);
+}
 
-#include "vbx_operators.hpp"
 struct Parameter{
 	void* ptr;
 	Parameter* next;
@@ -41,6 +41,7 @@ VBXCOPYRIGHT(vbw_mtx_median_argb32)
 
 #include "vbx.h"
 #include "vbw_mtx_median_argb32.h"
+#include "vbw_minmax_all.h"
 
 /** VBX median filter using bubble sort.
  * Does essentially the same thing as the scalar median,
@@ -63,7 +64,7 @@ void vbw_mtx_median_argb32(unsigned *input, const short filter_height, const sho
 	const int VBX_WIDTH_BYTES = this_mxp->vector_lanes * sizeof(int);
 	const int VBX_DMA_ALIGN   = this_mxp->dma_alignment_bytes;
 
-	vl = this_mxp->scratchpad_size/((filter_size+2)*sizeof(vbx_uword_t));
+	vl = this_mxp->scratchpad_size/((filter_size+1)*sizeof(vbx_uword_t));
 	vl = VBX_PAD_UP(vl,VBX_DMA_ALIGN) - (VBX_WIDTH_BYTES/sizeof(vbx_uword_t));
 
 	if(vl < image_width){
@@ -75,7 +76,6 @@ void vbw_mtx_median_argb32(unsigned *input, const short filter_height, const sho
 	}
 
 	vbx_uword_t *v_input = (vbx_uword_t *)vbx_sp_malloc(filter_size*vl*sizeof(vbx_uword_t));
-	vbx_ubyte_t *v_sub   = (vbx_ubyte_t *)vbx_sp_malloc(vl*sizeof(vbx_uword_t));
 	vbx_ubyte_t *v_temp  = (vbx_ubyte_t *)vbx_sp_malloc(vl*sizeof(vbx_uword_t));
 	vbx_ubyte_t *v_min, *v_max;
 	vbx_ubyte_t *v_input_byte = (vbx_ubyte_t *)v_input; 
@@ -139,10 +139,7 @@ void vbw_mtx_median_argb32(unsigned *input, const short filter_height, const sho
 				for(i = j+1; i < filter_size; i++){
 					v_max = v_input_byte+i*temp_vl_byte;
 
-					vbx(VVBU, VMOV,     v_temp, v_min,  0);
-					vbx(VVBU, VSUB,     v_sub,  v_max,  v_min);
-					vbx(VVBU, VCMV_LTZ, v_min,  v_max,  v_sub);
-					vbx(VVBU, VCMV_LTZ, v_max,  v_temp, v_sub);
+					vbw_cmpx_ubyte(v_min, v_max, v_min, v_max, v_temp);
 				}
 			}
 
@@ -151,8 +148,7 @@ void vbw_mtx_median_argb32(unsigned *input, const short filter_height, const sho
 			for(i = filter_mid+1; i < filter_size; i++){
 				v_max = v_input_byte+i*temp_vl_byte;
 
-				vbx(VVBU, VSUB,     v_sub, v_max, v_min);
-				vbx(VVBU, VCMV_LTZ, v_min, v_max, v_sub);
+				vbw_min_ubyte(v_min, v_min, v_max, v_temp);
 			}
 
 			// dma out median value
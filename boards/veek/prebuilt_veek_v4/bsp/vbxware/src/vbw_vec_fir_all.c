@@ -41,6 +41,7 @@
 VBXCOPYRIGHT( vbw_vec_fir )
 
 #include "vbx.h"
+#include "vbx_port.h"
 
 // Now, include the C file six times
 // First three for byte, half, word
@@ -3208,7 +3208,7 @@ __attribute__((always_inline)) static inline void vbx_VVWWU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -3296,7 +3296,7 @@ __attribute__((always_inline)) static inline void vbx_SVB( vinstr_t v_op, vbx_by
 
 __attribute__((always_inline)) static inline void vbx_SVBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -3384,7 +3384,7 @@ __attribute__((always_inline)) static inline void vbx_SVBB( vinstr_t v_op, vbx_b
 
 __attribute__((always_inline)) static inline void vbx_SVBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -3472,7 +3472,7 @@ __attribute__((always_inline)) static inline void vbx_SVBS( vinstr_t v_op, vbx_b
 
 __attribute__((always_inline)) static inline void vbx_SVBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -3560,7 +3560,7 @@ __attribute__((always_inline)) static inline void vbx_SVBBS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -3648,7 +3648,7 @@ __attribute__((always_inline)) static inline void vbx_SVBU( vinstr_t v_op, vbx_u
 
 __attribute__((always_inline)) static inline void vbx_SVBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -3736,7 +3736,7 @@ __attribute__((always_inline)) static inline void vbx_SVBBU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVBH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -3824,7 +3824,7 @@ __attribute__((always_inline)) static inline void vbx_SVBH( vinstr_t v_op, vbx_h
 
 __attribute__((always_inline)) static inline void vbx_SVBHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -3912,7 +3912,7 @@ __attribute__((always_inline)) static inline void vbx_SVBHS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVBHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -4000,7 +4000,7 @@ __attribute__((always_inline)) static inline void vbx_SVBHU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVBW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -4088,7 +4088,7 @@ __attribute__((always_inline)) static inline void vbx_SVBW( vinstr_t v_op, vbx_w
 
 __attribute__((always_inline)) static inline void vbx_SVBWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -4176,7 +4176,7 @@ __attribute__((always_inline)) static inline void vbx_SVBWS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVBWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -4264,7 +4264,7 @@ __attribute__((always_inline)) static inline void vbx_SVBWU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVHB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -4352,7 +4352,7 @@ __attribute__((always_inline)) static inline void vbx_SVHB( vinstr_t v_op, vbx_b
 
 __attribute__((always_inline)) static inline void vbx_SVHBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -4440,7 +4440,7 @@ __attribute__((always_inline)) static inline void vbx_SVHBS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVHBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -4528,7 +4528,7 @@ __attribute__((always_inline)) static inline void vbx_SVHBU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -4616,7 +4616,7 @@ __attribute__((always_inline)) static inline void vbx_SVH( vinstr_t v_op, vbx_ha
 
 __attribute__((always_inline)) static inline void vbx_SVHH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -4704,7 +4704,7 @@ __attribute__((always_inline)) static inline void vbx_SVHH( vinstr_t v_op, vbx_h
 
 __attribute__((always_inline)) static inline void vbx_SVHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -4792,7 +4792,7 @@ __attribute__((always_inline)) static inline void vbx_SVHS( vinstr_t v_op, vbx_h
 
 __attribute__((always_inline)) static inline void vbx_SVHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -4880,7 +4880,7 @@ __attribute__((always_inline)) static inline void vbx_SVHHS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -4968,7 +4968,7 @@ __attribute__((always_inline)) static inline void vbx_SVHU( vinstr_t v_op, vbx_u
 
 __attribute__((always_inline)) static inline void vbx_SVHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -5056,7 +5056,7 @@ __attribute__((always_inline)) static inline void vbx_SVHHU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVHW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -5144,7 +5144,7 @@ __attribute__((always_inline)) static inline void vbx_SVHW( vinstr_t v_op, vbx_w
 
 __attribute__((always_inline)) static inline void vbx_SVHWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -5232,7 +5232,7 @@ __attribute__((always_inline)) static inline void vbx_SVHWS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVHWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -5320,7 +5320,7 @@ __attribute__((always_inline)) static inline void vbx_SVHWU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVWB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -5408,7 +5408,7 @@ __attribute__((always_inline)) static inline void vbx_SVWB( vinstr_t v_op, vbx_b
 
 __attribute__((always_inline)) static inline void vbx_SVWBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -5496,7 +5496,7 @@ __attribute__((always_inline)) static inline void vbx_SVWBS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVWBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -5584,7 +5584,7 @@ __attribute__((always_inline)) static inline void vbx_SVWBU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVWH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -5672,7 +5672,7 @@ __attribute__((always_inline)) static inline void vbx_SVWH( vinstr_t v_op, vbx_h
 
 __attribute__((always_inline)) static inline void vbx_SVWHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -5760,7 +5760,7 @@ __attribute__((always_inline)) static inline void vbx_SVWHS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVWHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -5848,7 +5848,7 @@ __attribute__((always_inline)) static inline void vbx_SVWHU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -5936,7 +5936,7 @@ __attribute__((always_inline)) static inline void vbx_SVW( vinstr_t v_op, vbx_wo
 
 __attribute__((always_inline)) static inline void vbx_SVWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -6024,7 +6024,7 @@ __attribute__((always_inline)) static inline void vbx_SVWW( vinstr_t v_op, vbx_w
 
 __attribute__((always_inline)) static inline void vbx_SVWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -6112,7 +6112,7 @@ __attribute__((always_inline)) static inline void vbx_SVWS( vinstr_t v_op, vbx_w
 
 __attribute__((always_inline)) static inline void vbx_SVWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -6200,7 +6200,7 @@ __attribute__((always_inline)) static inline void vbx_SVWWS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SVWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -6288,7 +6288,7 @@ __attribute__((always_inline)) static inline void vbx_SVWU( vinstr_t v_op, vbx_u
 
 __attribute__((always_inline)) static inline void vbx_SVWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -6376,7 +6376,7 @@ __attribute__((always_inline)) static inline void vbx_SVWWU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_VEB( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -6464,7 +6464,7 @@ __attribute__((always_inline)) static inline void vbx_VEB( vinstr_t v_op, vbx_by
 
 __attribute__((always_inline)) static inline void vbx_VEBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -6552,7 +6552,7 @@ __attribute__((always_inline)) static inline void vbx_VEBB( vinstr_t v_op, vbx_b
 
 __attribute__((always_inline)) static inline void vbx_VEBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -6640,7 +6640,7 @@ __attribute__((always_inline)) static inline void vbx_VEBS( vinstr_t v_op, vbx_b
 
 __attribute__((always_inline)) static inline void vbx_VEBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -6728,7 +6728,7 @@ __attribute__((always_inline)) static inline void vbx_VEBBS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_VEBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_ubyte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -6816,7 +6816,7 @@ __attribute__((always_inline)) static inline void vbx_VEBU( vinstr_t v_op, vbx_u
 
 __attribute__((always_inline)) static inline void vbx_VEBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_ubyte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -6904,7 +6904,7 @@ __attribute__((always_inline)) static inline void vbx_VEBBU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_VEH( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -6992,7 +6992,7 @@ __attribute__((always_inline)) static inline void vbx_VEH( vinstr_t v_op, vbx_ha
 
 __attribute__((always_inline)) static inline void vbx_VEHH( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -7080,7 +7080,7 @@ __attribute__((always_inline)) static inline void vbx_VEHH( vinstr_t v_op, vbx_h
 
 __attribute__((always_inline)) static inline void vbx_VEHS( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -7168,7 +7168,7 @@ __attribute__((always_inline)) static inline void vbx_VEHS( vinstr_t v_op, vbx_h
 
 __attribute__((always_inline)) static inline void vbx_VEHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -7256,7 +7256,7 @@ __attribute__((always_inline)) static inline void vbx_VEHHS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_VEHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uhalf_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -7344,7 +7344,7 @@ __attribute__((always_inline)) static inline void vbx_VEHU( vinstr_t v_op, vbx_u
 
 __attribute__((always_inline)) static inline void vbx_VEHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uhalf_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -7432,7 +7432,7 @@ __attribute__((always_inline)) static inline void vbx_VEHHU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_VEW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -7520,7 +7520,7 @@ __attribute__((always_inline)) static inline void vbx_VEW( vinstr_t v_op, vbx_wo
 
 __attribute__((always_inline)) static inline void vbx_VEWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -7608,7 +7608,7 @@ __attribute__((always_inline)) static inline void vbx_VEWW( vinstr_t v_op, vbx_w
 
 __attribute__((always_inline)) static inline void vbx_VEWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -7696,7 +7696,7 @@ __attribute__((always_inline)) static inline void vbx_VEWS( vinstr_t v_op, vbx_w
 
 __attribute__((always_inline)) static inline void vbx_VEWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -7784,7 +7784,7 @@ __attribute__((always_inline)) static inline void vbx_VEWWS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_VEWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -7872,7 +7872,7 @@ __attribute__((always_inline)) static inline void vbx_VEWU( vinstr_t v_op, vbx_u
 
 __attribute__((always_inline)) static inline void vbx_VEWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -7960,7 +7960,7 @@ __attribute__((always_inline)) static inline void vbx_VEWWU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SEB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -8048,7 +8048,7 @@ __attribute__((always_inline)) static inline void vbx_SEB( vinstr_t v_op, vbx_by
 
 __attribute__((always_inline)) static inline void vbx_SEBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -8136,7 +8136,7 @@ __attribute__((always_inline)) static inline void vbx_SEBB( vinstr_t v_op, vbx_b
 
 __attribute__((always_inline)) static inline void vbx_SEBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -8224,7 +8224,7 @@ __attribute__((always_inline)) static inline void vbx_SEBS( vinstr_t v_op, vbx_b
 
 __attribute__((always_inline)) static inline void vbx_SEBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -8312,7 +8312,7 @@ __attribute__((always_inline)) static inline void vbx_SEBBS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SEBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -8400,7 +8400,7 @@ __attribute__((always_inline)) static inline void vbx_SEBU( vinstr_t v_op, vbx_u
 
 __attribute__((always_inline)) static inline void vbx_SEBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -8488,7 +8488,7 @@ __attribute__((always_inline)) static inline void vbx_SEBBU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SEH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -8576,7 +8576,7 @@ __attribute__((always_inline)) static inline void vbx_SEH( vinstr_t v_op, vbx_ha
 
 __attribute__((always_inline)) static inline void vbx_SEHH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -8664,7 +8664,7 @@ __attribute__((always_inline)) static inline void vbx_SEHH( vinstr_t v_op, vbx_h
 
 __attribute__((always_inline)) static inline void vbx_SEHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -8752,7 +8752,7 @@ __attribute__((always_inline)) static inline void vbx_SEHS( vinstr_t v_op, vbx_h
 
 __attribute__((always_inline)) static inline void vbx_SEHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -8840,7 +8840,7 @@ __attribute__((always_inline)) static inline void vbx_SEHHS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SEHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -8928,7 +8928,7 @@ __attribute__((always_inline)) static inline void vbx_SEHU( vinstr_t v_op, vbx_u
 
 __attribute__((always_inline)) static inline void vbx_SEHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -9016,7 +9016,7 @@ __attribute__((always_inline)) static inline void vbx_SEHHU( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SEW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -9104,7 +9104,7 @@ __attribute__((always_inline)) static inline void vbx_SEW( vinstr_t v_op, vbx_wo
 
 __attribute__((always_inline)) static inline void vbx_SEWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -9192,7 +9192,7 @@ __attribute__((always_inline)) static inline void vbx_SEWW( vinstr_t v_op, vbx_w
 
 __attribute__((always_inline)) static inline void vbx_SEWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -9280,7 +9280,7 @@ __attribute__((always_inline)) static inline void vbx_SEWS( vinstr_t v_op, vbx_w
 
 __attribute__((always_inline)) static inline void vbx_SEWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -9368,7 +9368,7 @@ __attribute__((always_inline)) static inline void vbx_SEWWS( vinstr_t v_op, vbx_
 
 __attribute__((always_inline)) static inline void vbx_SEWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -9456,7 +9456,7 @@ __attribute__((always_inline)) static inline void vbx_SEWU( vinstr_t v_op, vbx_u
 
 __attribute__((always_inline)) static inline void vbx_SEWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -12712,7 +12712,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VVWWU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -12800,7 +12800,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVB( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_acc_SVBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -12888,7 +12888,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVBB( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -12976,7 +12976,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVBS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -13064,7 +13064,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVBBS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -13152,7 +13152,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVBU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -13240,7 +13240,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVBBU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVBH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -13328,7 +13328,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVBH( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVBHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -13416,7 +13416,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVBHS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVBHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -13504,7 +13504,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVBHU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVBW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -13592,7 +13592,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVBW( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVBWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -13680,7 +13680,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVBWS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVBWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -13768,7 +13768,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVBWU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVHB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -13856,7 +13856,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVHB( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVHBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -13944,7 +13944,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVHBS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVHBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -14032,7 +14032,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVHBU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -14120,7 +14120,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVH( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_acc_SVHH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -14208,7 +14208,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVHH( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -14296,7 +14296,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVHS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -14384,7 +14384,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVHHS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -14472,7 +14472,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVHU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -14560,7 +14560,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVHHU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVHW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -14648,7 +14648,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVHW( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVHWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -14736,7 +14736,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVHWS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVHWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -14824,7 +14824,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVHWU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVWB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -14912,7 +14912,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVWB( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVWBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -15000,7 +15000,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVWBS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVWBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -15088,7 +15088,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVWBU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVWH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -15176,7 +15176,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVWH( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVWHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -15264,7 +15264,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVWHS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVWHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -15352,7 +15352,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVWHU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -15440,7 +15440,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVW( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_acc_SVWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -15528,7 +15528,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVWW( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -15616,7 +15616,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVWS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -15704,7 +15704,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVWWS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SVWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -15792,7 +15792,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVWU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SVWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -15880,7 +15880,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SVWWU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_VEB( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -15968,7 +15968,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEB( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_acc_VEBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -16056,7 +16056,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEBB( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_VEBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -16144,7 +16144,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEBS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_VEBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -16232,7 +16232,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEBBS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_VEBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_ubyte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -16320,7 +16320,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEBU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_VEBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_ubyte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -16408,7 +16408,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEBBU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_VEH( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -16496,7 +16496,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEH( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_acc_VEHH( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -16584,7 +16584,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEHH( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_VEHS( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -16672,7 +16672,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEHS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_VEHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -16760,7 +16760,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEHHS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_VEHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uhalf_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -16848,7 +16848,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEHU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_VEHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uhalf_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -16936,7 +16936,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEHHU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_VEW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -17024,7 +17024,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEW( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_acc_VEWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -17112,7 +17112,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEWW( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_VEWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -17200,7 +17200,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEWS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_VEWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -17288,7 +17288,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEWWS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_VEWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -17376,7 +17376,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEWU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_VEWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -17464,7 +17464,7 @@ __attribute__((always_inline)) static inline void vbx_acc_VEWWU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SEB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -17552,7 +17552,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEB( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_acc_SEBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -17640,7 +17640,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEBB( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SEBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -17728,7 +17728,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEBS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SEBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -17816,7 +17816,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEBBS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SEBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -17904,7 +17904,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEBU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SEBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -17992,7 +17992,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEBBU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SEH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -18080,7 +18080,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEH( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_acc_SEHH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -18168,7 +18168,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEHH( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SEHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -18256,7 +18256,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEHS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SEHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -18344,7 +18344,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEHHS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SEHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -18432,7 +18432,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEHU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SEHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -18520,7 +18520,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEHHU( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SEW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -18608,7 +18608,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEW( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_acc_SEWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -18696,7 +18696,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEWW( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SEWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -18784,7 +18784,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEWS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SEWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -18872,7 +18872,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEWWS( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_SEWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -18960,7 +18960,7 @@ __attribute__((always_inline)) static inline void vbx_acc_SEWU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_acc_SEWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -22216,7 +22216,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VVWWU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -22304,7 +22304,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVB( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_2D_SVBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -22392,7 +22392,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVBB( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -22480,7 +22480,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVBS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -22568,7 +22568,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVBBS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -22656,7 +22656,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVBU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -22744,7 +22744,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVBBU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVBH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -22832,7 +22832,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVBH( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVBHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -22920,7 +22920,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVBHS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVBHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -23008,7 +23008,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVBHU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVBW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -23096,7 +23096,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVBW( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVBWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -23184,7 +23184,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVBWS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVBWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -23272,7 +23272,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVBWU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVHB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -23360,7 +23360,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVHB( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVHBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -23448,7 +23448,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVHBS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVHBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -23536,7 +23536,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVHBU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -23624,7 +23624,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVH( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_2D_SVHH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -23712,7 +23712,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVHH( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -23800,7 +23800,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVHS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -23888,7 +23888,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVHHS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -23976,7 +23976,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVHU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -24064,7 +24064,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVHHU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVHW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -24152,7 +24152,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVHW( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVHWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -24240,7 +24240,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVHWS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVHWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -24328,7 +24328,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVHWU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVWB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -24416,7 +24416,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVWB( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVWBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -24504,7 +24504,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVWBS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVWBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -24592,7 +24592,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVWBU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVWH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -24680,7 +24680,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVWH( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVWHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -24768,7 +24768,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVWHS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVWHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -24856,7 +24856,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVWHU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -24944,7 +24944,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVW( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_2D_SVWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -25032,7 +25032,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVWW( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -25120,7 +25120,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVWS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -25208,7 +25208,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVWWS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SVWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -25296,7 +25296,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVWU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SVWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -25384,7 +25384,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SVWWU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_VEB( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -25472,7 +25472,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEB( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_2D_VEBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -25560,7 +25560,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEBB( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_VEBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -25648,7 +25648,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEBS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_VEBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -25736,7 +25736,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEBBS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_VEBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_ubyte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -25824,7 +25824,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEBU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_VEBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_ubyte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -25912,7 +25912,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEBBU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_VEH( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -26000,7 +26000,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEH( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_2D_VEHH( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -26088,7 +26088,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEHH( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_VEHS( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -26176,7 +26176,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEHS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_VEHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -26264,7 +26264,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEHHS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_VEHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uhalf_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -26352,7 +26352,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEHU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_VEHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uhalf_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -26440,7 +26440,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEHHU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_VEW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -26528,7 +26528,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEW( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_2D_VEWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -26616,7 +26616,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEWW( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_VEWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -26704,7 +26704,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEWS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_VEWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -26792,7 +26792,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEWWS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_VEWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -26880,7 +26880,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEWU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_VEWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -26968,7 +26968,7 @@ __attribute__((always_inline)) static inline void vbx_2D_VEWWU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SEB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -27056,7 +27056,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEB( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_2D_SEBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -27144,7 +27144,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEBB( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SEBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -27232,7 +27232,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEBS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SEBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -27320,7 +27320,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEBBS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SEBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -27408,7 +27408,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEBU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SEBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -27496,7 +27496,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEBBU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SEH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -27584,7 +27584,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEH( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_2D_SEHH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -27672,7 +27672,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEHH( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SEHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -27760,7 +27760,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEHS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SEHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -27848,7 +27848,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEHHS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SEHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -27936,7 +27936,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEHU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SEHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -28024,7 +28024,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEHHU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SEW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -28112,7 +28112,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEW( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_2D_SEWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -28200,7 +28200,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEWW( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SEWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -28288,7 +28288,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEWS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SEWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -28376,7 +28376,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEWWS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_2D_SEWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -28464,7 +28464,7 @@ __attribute__((always_inline)) static inline void vbx_2D_SEWU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_2D_SEWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -31720,7 +31720,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VVWWU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -31808,7 +31808,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVB( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -31896,7 +31896,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVBB( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -31984,7 +31984,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVBS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -32072,7 +32072,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVBBS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -32160,7 +32160,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVBU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -32248,7 +32248,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVBBU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVBH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -32336,7 +32336,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVBH( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVBHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -32424,7 +32424,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVBHS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVBHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -32512,7 +32512,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVBHU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVBW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -32600,7 +32600,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVBW( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVBWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -32688,7 +32688,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVBWS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVBWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -32776,7 +32776,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVBWU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVHB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -32864,7 +32864,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVHB( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVHBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -32952,7 +32952,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVHBS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVHBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -33040,7 +33040,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVHBU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -33128,7 +33128,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVH( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVHH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -33216,7 +33216,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVHH( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -33304,7 +33304,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVHS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -33392,7 +33392,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVHHS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -33480,7 +33480,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVHU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -33568,7 +33568,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVHHU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVHW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -33656,7 +33656,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVHW( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVHWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -33744,7 +33744,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVHWS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVHWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -33832,7 +33832,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVHWU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVWB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -33920,7 +33920,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVWB( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVWBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -34008,7 +34008,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVWBS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVWBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -34096,7 +34096,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVWBU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVWH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -34184,7 +34184,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVWH( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVWHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -34272,7 +34272,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVWHS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVWHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -34360,7 +34360,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVWHU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -34448,7 +34448,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVW( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -34536,7 +34536,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVWW( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -34624,7 +34624,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVWS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -34712,7 +34712,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVWWS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -34800,7 +34800,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVWU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SVWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -34888,7 +34888,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SVWWU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEB( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -34976,7 +34976,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEB( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -35064,7 +35064,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEBB( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -35152,7 +35152,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEBS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -35240,7 +35240,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEBBS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_ubyte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -35328,7 +35328,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEBU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_ubyte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -35416,7 +35416,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEBBU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEH( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -35504,7 +35504,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEH( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEHH( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -35592,7 +35592,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEHH( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEHS( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -35680,7 +35680,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEHS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -35768,7 +35768,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEHHS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uhalf_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -35856,7 +35856,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEHU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uhalf_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -35944,7 +35944,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEHHU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -36032,7 +36032,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEW( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -36120,7 +36120,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEWW( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -36208,7 +36208,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEWS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -36296,7 +36296,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEWWS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -36384,7 +36384,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEWU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_VEWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -36472,7 +36472,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_VEWWU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -36560,7 +36560,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEB( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -36648,7 +36648,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEBB( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -36736,7 +36736,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEBS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -36824,7 +36824,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEBBS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -36912,7 +36912,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEBU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -37000,7 +37000,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEBBU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -37088,7 +37088,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEH( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEHH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -37176,7 +37176,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEHH( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -37264,7 +37264,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEHS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -37352,7 +37352,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEHHS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -37440,7 +37440,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEHU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -37528,7 +37528,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEHHU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -37616,7 +37616,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEW( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -37704,7 +37704,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEWW( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -37792,7 +37792,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEWS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -37880,7 +37880,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEWWS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -37968,7 +37968,7 @@ __attribute__((always_inline)) static inline void vbx_acc_2D_SEWU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_2D_SEWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_2D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_2D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -41224,7 +41224,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VVWWU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -41312,7 +41312,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVB( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_3D_SVBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -41400,7 +41400,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVBB( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -41488,7 +41488,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVBS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -41576,7 +41576,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVBBS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -41664,7 +41664,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVBU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -41752,7 +41752,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVBBU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVBH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -41840,7 +41840,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVBH( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVBHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -41928,7 +41928,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVBHS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVBHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -42016,7 +42016,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVBHU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVBW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -42104,7 +42104,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVBW( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVBWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -42192,7 +42192,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVBWS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVBWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -42280,7 +42280,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVBWU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVHB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -42368,7 +42368,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVHB( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVHBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -42456,7 +42456,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVHBS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVHBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -42544,7 +42544,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVHBU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -42632,7 +42632,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVH( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_3D_SVHH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -42720,7 +42720,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVHH( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -42808,7 +42808,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVHS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -42896,7 +42896,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVHHS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -42984,7 +42984,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVHU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -43072,7 +43072,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVHHU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVHW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -43160,7 +43160,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVHW( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVHWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -43248,7 +43248,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVHWS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVHWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -43336,7 +43336,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVHWU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVWB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -43424,7 +43424,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVWB( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVWBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -43512,7 +43512,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVWBS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVWBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -43600,7 +43600,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVWBU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVWH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -43688,7 +43688,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVWH( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVWHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -43776,7 +43776,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVWHS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVWHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -43864,7 +43864,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVWHU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -43952,7 +43952,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVW( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_3D_SVWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -44040,7 +44040,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVWW( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -44128,7 +44128,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVWS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -44216,7 +44216,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVWWS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SVWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -44304,7 +44304,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVWU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SVWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -44392,7 +44392,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SVWWU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_VEB( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -44480,7 +44480,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEB( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_3D_VEBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -44568,7 +44568,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEBB( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_VEBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -44656,7 +44656,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEBS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_VEBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -44744,7 +44744,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEBBS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_VEBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_ubyte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -44832,7 +44832,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEBU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_VEBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_ubyte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -44920,7 +44920,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEBBU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_VEH( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -45008,7 +45008,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEH( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_3D_VEHH( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -45096,7 +45096,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEHH( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_VEHS( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -45184,7 +45184,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEHS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_VEHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -45272,7 +45272,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEHHS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_VEHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uhalf_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -45360,7 +45360,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEHU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_VEHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uhalf_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -45448,7 +45448,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEHHU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_VEW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -45536,7 +45536,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEW( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_3D_VEWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -45624,7 +45624,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEWW( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_VEWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -45712,7 +45712,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEWS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_VEWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -45800,7 +45800,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEWWS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_VEWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -45888,7 +45888,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEWU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_VEWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -45976,7 +45976,7 @@ __attribute__((always_inline)) static inline void vbx_3D_VEWWU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SEB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -46064,7 +46064,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEB( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_3D_SEBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -46152,7 +46152,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEBB( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SEBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -46240,7 +46240,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEBS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SEBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -46328,7 +46328,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEBBS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SEBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -46416,7 +46416,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEBU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SEBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -46504,7 +46504,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEBBU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SEH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -46592,7 +46592,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEH( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_3D_SEHH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -46680,7 +46680,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEHH( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SEHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -46768,7 +46768,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEHS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SEHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -46856,7 +46856,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEHHS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SEHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -46944,7 +46944,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEHU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SEHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -47032,7 +47032,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEHHU( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SEW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -47120,7 +47120,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEW( vinstr_t v_op, vbx
 
 __attribute__((always_inline)) static inline void vbx_3D_SEWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -47208,7 +47208,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEWW( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SEWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -47296,7 +47296,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEWS( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SEWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -47384,7 +47384,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEWWS( vinstr_t v_op, v
 
 __attribute__((always_inline)) static inline void vbx_3D_SEWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -47472,7 +47472,7 @@ __attribute__((always_inline)) static inline void vbx_3D_SEWU( vinstr_t v_op, vb
 
 __attribute__((always_inline)) static inline void vbx_3D_SEWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -50728,7 +50728,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VVWWU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -50816,7 +50816,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVB( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -50904,7 +50904,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVBB( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -50992,7 +50992,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVBS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -51080,7 +51080,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVBBS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -51168,7 +51168,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVBU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -51256,7 +51256,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVBBU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVBH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -51344,7 +51344,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVBH( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVBHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -51432,7 +51432,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVBHS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVBHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -51520,7 +51520,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVBHU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVBW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -51608,7 +51608,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVBW( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVBWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_byte_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -51696,7 +51696,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVBWS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVBWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_ubyte_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -51784,7 +51784,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVBWU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVHB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -51872,7 +51872,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVHB( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVHBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -51960,7 +51960,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVHBS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVHBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -52048,7 +52048,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVHBU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -52136,7 +52136,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVH( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVHH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -52224,7 +52224,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVHH( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -52312,7 +52312,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVHS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -52400,7 +52400,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVHHS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -52488,7 +52488,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVHU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -52576,7 +52576,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVHHU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVHW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -52664,7 +52664,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVHW( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVHWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_half_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -52752,7 +52752,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVHWS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVHWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uhalf_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -52840,7 +52840,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVHWU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVWB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -52928,7 +52928,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVWB( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVWBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -53016,7 +53016,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVWBS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVWBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -53104,7 +53104,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVWBU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVWH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -53192,7 +53192,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVWH( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVWHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -53280,7 +53280,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVWHS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVWHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -53368,7 +53368,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVWHU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -53456,7 +53456,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVW( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -53544,7 +53544,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVWW( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -53632,7 +53632,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVWS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_word_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -53720,7 +53720,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVWWS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -53808,7 +53808,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVWU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SVWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_uword_t *v_in2 )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,sizeof(*v_in2),v_in2,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,sizeof(*v_in2),v_in2,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -53896,7 +53896,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SVWWU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEB( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -53984,7 +53984,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEB( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -54072,7 +54072,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEBB( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -54160,7 +54160,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEBS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_byte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -54248,7 +54248,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEBBS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_ubyte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -54336,7 +54336,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEBU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_ubyte_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -54424,7 +54424,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEBBU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEH( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -54512,7 +54512,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEH( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEHH( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -54600,7 +54600,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEHH( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEHS( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -54688,7 +54688,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEHS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_half_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -54776,7 +54776,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEHHS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uhalf_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -54864,7 +54864,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEHU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uhalf_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -54952,7 +54952,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEHHU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -55040,7 +55040,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEW( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -55128,7 +55128,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEWW( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -55216,7 +55216,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEWS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -55304,7 +55304,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEWWS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -55392,7 +55392,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEWU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_VEWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t *v_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,sizeof(*v_in1),v_in1,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -55480,7 +55480,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_VEWWU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -55568,7 +55568,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEB( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEBB( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -55656,7 +55656,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEBB( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -55744,7 +55744,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEBS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEBBS( vinstr_t v_op, vbx_byte_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -55832,7 +55832,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEBBS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -55920,7 +55920,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEBU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEBBU( vinstr_t v_op, vbx_ubyte_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -56008,7 +56008,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEBBU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -56096,7 +56096,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEH( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEHH( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -56184,7 +56184,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEHH( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -56272,7 +56272,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEHS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEHHS( vinstr_t v_op, vbx_half_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -56360,7 +56360,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEHHS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -56448,7 +56448,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEHU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEHHU( vinstr_t v_op, vbx_uhalf_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -56536,7 +56536,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEHHU( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -56624,7 +56624,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEW( vinstr_t v_op,
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEWW( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -56712,7 +56712,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEWW( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -56800,7 +56800,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEWS( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEWWS( vinstr_t v_op, vbx_word_t *v_out, vbx_word_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -56888,7 +56888,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEWWS( vinstr_t v_o
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
@@ -56976,7 +56976,7 @@ __attribute__((always_inline)) static inline void vbx_acc_3D_SEWU( vinstr_t v_op
 
 __attribute__((always_inline)) static inline void vbx_acc_3D_SEWWU( vinstr_t v_op, vbx_uword_t *v_out, vbx_uword_t s_in1, vbx_enum_t *v_enum )
 {
-	vbx_acc_3D_chk(sizeof(*v_out),v_out,1,v_out,1,v_out,v_op);
+	vbx_acc_3D_chk(sizeof(*v_out),v_out,0,NULL,0,NULL,v_op);
 	switch(v_op)
 	{
 	case VADD:
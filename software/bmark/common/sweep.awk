@@ -0,0 +1,42 @@
+# Turns the output of one benchmark run under the simulator into rows of
+# the lane sweep table (see Makefile.sweep). Each {"bench": ...} line that
+# vbx_bench_end() prints is a row.
+#
+# Variables: bmark, config, lanes, core_freq
+
+# value of "key" in the JSON line s, or "" if it is not there
+function field(s, key,    v) {
+	if (!match(s, "\"" key "\": "))
+		return ""
+	v = substr(s, RSTART + RLENGTH)
+	if (substr(v, 1, 1) == "\"") {
+		v = substr(v, 2)
+		return substr(v, 1, index(v, "\"") - 1)
+	}
+	match(v, /^[^,}]*/)
+	return substr(v, 1, RLENGTH)
+}
+
+function row(s) {
+	printf "%s,%s,%d,%d,%s,%s,%s,%s,%s,%s,%s,%s,%s\n", bmark, config, lanes, core_freq,
+	       field(s, "bench"), field(s, "runs"), field(s, "min_cycles"),
+	       field(s, "median_cycles"), field(s, "p95_cycles"), field(s, "speedup"),
+	       total, dma_eff, status
+}
+
+BEGIN {
+	status = "fail"
+	n = 0
+}
+
+/^\{"bench": /              { line[++n] = $0 }
+/^Simulated total cycles:/  { total = $NF }
+/^Simulated DMA efficiency:/ { dma_eff = $NF }
+/Test passed!/              { status = "pass" }
+
+END {
+	if (n == 0)
+		row("")
+	for (i = 1; i <= n; i++)
+		row(line[i])
+}
@@ -126,6 +126,8 @@ int main_block()
 	dt *cin;
 
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	double vbx_time, scalar_time;
 	int errors;
 
@@ -138,30 +140,36 @@ int main_block()
 	init_fdct();
 
 #ifdef USE_MP
-	int cpuid, cpu_num;
+	int cpuid, cpu_num, mp_runs;
 	NIOS2_READ_CPUID(cpuid);
 
 	if (cpuid >= NUM_PROCS)
 		return 0;
 
 	if (!cpuid) {
+		// the workers take part in as many runs as the master's measurements
+		vbx_bench_begin(&bench, "MP");
 		for (cpu_num = 1; cpu_num < NUM_PROCS; cpu_num++) {
 			MASTER_FIFO_RCV(cpu_num);
-			MASTER_FIFO_SND(cpu_num, cpuid);
+			MASTER_FIFO_SND(cpu_num, vbx_bench_runs(&bench));
 		}
 	} else {
 		FIFO_SND(cpuid);
-		FIFO_RCV();
-		block_m = (dt *) FIFO_RCV();
-		fdct_scalar(block_m, ((NUMBER_OF_BLOCKS / NUM_PROCS) * cpuid), ((NUMBER_OF_BLOCKS / NUM_PROCS) * (cpuid + 1)));
-		my_dcache_flush();
-		FIFO_SND(cpuid);
+		mp_runs = FIFO_RCV();
+		for (run = 0; run < mp_runs; run++) {
+			block_m = (dt *) FIFO_RCV();
+			fdct_scalar(block_m, ((NUMBER_OF_BLOCKS / NUM_PROCS) * cpuid), ((NUMBER_OF_BLOCKS / NUM_PROCS) * (cpuid + 1)));
+			my_dcache_flush();
+			FIFO_SND(cpuid);
+		}
 
-		block_v = (dt *) FIFO_RCV();
-		cin = (dt *) FIFO_RCV();
-		fdct_vbx(block_v, cin, ((NUMBER_OF_BLOCKS / NUM_PROCS) * cpuid),
-				 ((NUMBER_OF_BLOCKS / NUM_PROCS) * (cpuid + 1)));
-		FIFO_SND(cpuid);
+		for (run = 0; run < mp_runs; run++) {
+			block_v = (dt *) FIFO_RCV();
+			cin = (dt *) FIFO_RCV();
+			fdct_vbx(block_v, cin, ((NUMBER_OF_BLOCKS / NUM_PROCS) * cpuid),
+					 ((NUMBER_OF_BLOCKS / NUM_PROCS) * (cpuid + 1)));
+			FIFO_SND(cpuid);
+		}
 
 		return 0;
 	}
@@ -200,26 +208,35 @@ int main_block()
 	}
 #endif
 
+	// the transforms are done in place, so later runs restore their input first
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	fdct_scalar(block_s, 0, NUMBER_OF_BLOCKS);
-	time_stop = vbx_timestamp();
+	vbx_bench_begin(&bench, "Scalar");
+	for (run = 0; run < vbx_bench_runs(&bench); run++) {
+		for (block_num = 0; run && block_num < NUMBER_OF_BLOCKS; block_num++) {
+			GenerateRandomMatrix(BLOCK_SIZE, block_num + 1, block_s + block_num * DCT_SIZE);
+		}
+		time_start = vbx_timestamp();
+		fdct_scalar(block_s, 0, NUMBER_OF_BLOCKS);
+		time_stop = vbx_timestamp();
+		vbx_bench_record(&bench, time_start, time_stop);
+	}
 
-	scalar_time = vbx_print_scalar_time_per(time_start,
-	                                        time_stop,
-	                                        (double) (NUMBER_OF_BLOCKS),
-	                                        "block");
+	scalar_time = vbx_bench_end(&bench, (double) (NUMBER_OF_BLOCKS), "block", 0.0);
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	fdct_vbx(block_v, cin, 0, NUMBER_OF_BLOCKS);
-	time_stop = vbx_timestamp();
+	vbx_bench_begin(&bench, "Vector");
+	for (run = 0; run < vbx_bench_runs(&bench); run++) {
+		for (block_num = 0; run && block_num < NUMBER_OF_BLOCKS; block_num++) {
+			GenerateRandomMatrix(BLOCK_SIZE, block_num + 1, block_v + block_num * DCT_SIZE);
+		}
+		time_start = vbx_timestamp();
+		fdct_vbx(block_v, cin, 0, NUMBER_OF_BLOCKS);
+		time_stop = vbx_timestamp();
+		vbx_bench_record(&bench, time_start, time_stop);
+	}
 
-	vbx_time = vbx_print_vector_time_per(time_start,
-	                                     time_stop,
-	                                     (double) (NUMBER_OF_BLOCKS),
-	                                     "block",
-	                                     scalar_time);
+	vbx_time = vbx_bench_end(&bench, (double) (NUMBER_OF_BLOCKS),
+	                         "block", scalar_time);
 
 	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
 	double vbx_mbps = (double) (NUMBER_OF_BLOCKS) / vbx_time;	// blocks per second
@@ -254,25 +271,30 @@ int main_block()
 
 #ifdef USE_MP
 
+	// later runs restore the input, and write it back for the workers to read
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-
-	for (cpu_num = 1; cpu_num < NUM_PROCS; cpu_num++) {
-		MASTER_FIFO_SND(cpu_num, block_m);
-	}
-	fdct_scalar(block_m, 0, NUMBER_OF_BLOCKS / NUM_PROCS);
-	for (cpu_num = 1; cpu_num < NUM_PROCS; cpu_num++) {
-		MASTER_FIFO_RCV(cpu_num);
+	vbx_bench_begin(&bench, "Scalar MP");
+	for (run = 0; run < vbx_bench_runs(&bench); run++) {
+		for (block_num = 0; run && block_num < NUMBER_OF_BLOCKS; block_num++) {
+			GenerateRandomMatrix(BLOCK_SIZE, block_num + 1, block_m + block_num * DCT_SIZE);
+		}
+		if (run) {
+			my_dcache_flush();
+		}
+		time_start = vbx_timestamp();
+		for (cpu_num = 1; cpu_num < NUM_PROCS; cpu_num++) {
+			MASTER_FIFO_SND(cpu_num, block_m);
+		}
+		fdct_scalar(block_m, 0, NUMBER_OF_BLOCKS / NUM_PROCS);
+		for (cpu_num = 1; cpu_num < NUM_PROCS; cpu_num++) {
+			MASTER_FIFO_RCV(cpu_num);
+		}
+		time_stop = vbx_timestamp();
+		vbx_bench_record(&bench, time_start, time_stop);
 	}
 
-	time_stop = vbx_timestamp();
-
 	print("Finished MP.");
-	double scalar_mp_time = \
-		vbx_print_scalar_time_per(time_start,
-		                          time_stop,
-		                          (double) (NUMBER_OF_BLOCKS),
-		                          "block");
+	double scalar_mp_time = vbx_bench_end(&bench, (double) (NUMBER_OF_BLOCKS), "block", 0.0);
 
 	printf("checking results...\n");
 
@@ -296,33 +318,30 @@ int main_block()
 	printf("%d errors\n\n", errors);
 	total_errors += errors;
 
-	//Reset vbx matrix
-	for (block_num = 0; block_num < NUMBER_OF_BLOCKS; block_num++) {
-		GenerateRandomMatrix(BLOCK_SIZE, block_num + 1, block_v + block_num * DCT_SIZE);
-	}
-
+	// every run resets the vbx matrix, which the single processor runs transformed
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-
-	for (cpu_num = 1; cpu_num < NUM_PROCS; cpu_num++) {
-		MASTER_FIFO_SND(cpu_num, block_v);
-		MASTER_FIFO_SND(cpu_num, cin);
-	}
-	fdct_vbx(block_v, cin, 0, NUMBER_OF_BLOCKS / NUM_PROCS);
-	for (cpu_num = 1; cpu_num < NUM_PROCS; cpu_num++) {
-		MASTER_FIFO_RCV(cpu_num);
+	vbx_bench_begin(&bench, "Vector MP");
+	for (run = 0; run < vbx_bench_runs(&bench); run++) {
+		for (block_num = 0; block_num < NUMBER_OF_BLOCKS; block_num++) {
+			GenerateRandomMatrix(BLOCK_SIZE, block_num + 1, block_v + block_num * DCT_SIZE);
+		}
+		time_start = vbx_timestamp();
+		for (cpu_num = 1; cpu_num < NUM_PROCS; cpu_num++) {
+			MASTER_FIFO_SND(cpu_num, block_v);
+			MASTER_FIFO_SND(cpu_num, cin);
+		}
+		fdct_vbx(block_v, cin, 0, NUMBER_OF_BLOCKS / NUM_PROCS);
+		for (cpu_num = 1; cpu_num < NUM_PROCS; cpu_num++) {
+			MASTER_FIFO_RCV(cpu_num);
+		}
+		time_stop = vbx_timestamp();
+		vbx_bench_record(&bench, time_start, time_stop);
 	}
 
-	time_stop = vbx_timestamp();
-
 	printf("Finished VECTOR MP\n");
 
-	double vector_mp_time = \
-		vbx_print_vector_time_per(time_start,
-		                          time_stop,
-		                          (double) (NUMBER_OF_BLOCKS),
-		                          "block",
-		                          scalar_mp_time);
+	double vector_mp_time = vbx_bench_end(&bench, (double) (NUMBER_OF_BLOCKS),
+	                                      "block", scalar_mp_time);
 
 	printf("checking results...\n");
 
@@ -125,6 +125,7 @@ static void GenerateRandomImage( dt *image, int width, int height, int seed );
 static void init_fdct_tile(void);
 void fdct_scalar_tile( dt *block_s, dt *coeff_s, dt *image, int start_x, int start_y, int num_tile_x, int num_tile_y );
 void vbx_mtx_fdct_tile_setup( dt *coeff_v, dt *image );
+void vbx_mtx_fdct_tile_prefetch( dt *image );
 void vbx_mtx_fdct_tile( dt *block_v, dt *image, int start_x, int start_y, int end_x, int end_y, int num_tile_x, int num_tile_y );
 
 static dt     cs[BLOCK_SIZE][BLOCK_SIZE];
@@ -132,6 +133,7 @@ static double c2[BLOCK_SIZE][BLOCK_SIZE];
 
 int db = 0; // double-buffer flag
 vbx_half_t *vcoeff    = NULL;
+vbx_half_t *vcoeff_cached = NULL;
 vbx_half_t *vimage[2] = {NULL,NULL};
 vbx_half_t *vblock[2] = {NULL,NULL};
 vbx_half_t *vprods    = NULL;
@@ -143,7 +145,9 @@ int test_tile()
 	int i, j, k, l, base;
 	int x, y;
 
-	int time_start, time_stop;
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	unsigned int cycles;
 	double vbx_time, scalar_time;
 	int errors;
@@ -198,18 +202,19 @@ int test_tile()
 #endif
 	printf("\nRunning Scalar DCT...\n");
 
-	time_start = vbx_timestamp();
-	for( y = 0; y < IMG_DOWN; y++ ) {
-		for( x = 0; x < IMG_ACROSS; x++ ) {
-			fdct_scalar_tile( block_s, (dt*)cs, image, x/*start_x*/, y/*start_y*/, NUM_TILE_X, NUM_TILE_Y );
+	vbx_bench_begin( &bench, "Scalar" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		for( y = 0; y < IMG_DOWN; y++ ) {
+			for( x = 0; x < IMG_ACROSS; x++ ) {
+				fdct_scalar_tile( block_s, (dt*)cs, image, x/*start_x*/, y/*start_y*/, NUM_TILE_X, NUM_TILE_Y );
+			}
 		}
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
 	}
-	time_stop = vbx_timestamp();
 
-	scalar_time = vbx_print_scalar_time_per(time_start,
-	                                        time_stop,
-	                                        (double) (NUM_BLOCKS),
-	                                        "block");
+	scalar_time = vbx_bench_end( &bench, (double) (NUM_BLOCKS), "block", 0.0 );
 
 #ifdef DEBUG  
 	printf("output matrix is:\n");
@@ -247,19 +252,23 @@ int test_tile()
         
 	printf("\nRunning Vector DCT...\n");
 
-	time_start = vbx_timestamp();
-	for( y = 0; y < IMG_DOWN; y++ ) {
-		for( x = 0; x < IMG_ACROSS; x++ ) {
-			vbx_mtx_fdct_tile( block_v, image, x/*start_x*/, y/*start_y*/, IMG_ACROSS-1,IMG_DOWN-1,NUM_TILE_X, NUM_TILE_Y );
+	vbx_bench_begin( &bench, "Vector" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		if( run ) {
+			vbx_mtx_fdct_tile_prefetch( image );
+			vbx_sync();
+		}
+		time_start = vbx_timestamp();
+		for( y = 0; y < IMG_DOWN; y++ ) {
+			for( x = 0; x < IMG_ACROSS; x++ ) {
+				vbx_mtx_fdct_tile( block_v, image, x/*start_x*/, y/*start_y*/, IMG_ACROSS-1,IMG_DOWN-1,NUM_TILE_X, NUM_TILE_Y );
+			}
 		}
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
 	}
-	time_stop = vbx_timestamp();
 
-	vbx_time = vbx_print_vector_time_per(time_start,
-	                                     time_stop,
-	                                     (double) (NUM_BLOCKS),
-	                                     "block",
-	                                     scalar_time);
+	vbx_time = vbx_bench_end( &bench, (double) (NUM_BLOCKS), "block", scalar_time );
 
 	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
 	double vbx_mbps = (double) (NUM_BLOCKS) / vbx_time;	// blocks per second
@@ -319,6 +328,11 @@ int test_tile()
 	total_errors += errors;
 #endif
 
+	if( vcoeff_cached ) {
+		vbx_sp_cache_put( vcoeff_cached );
+	}
+	vbx_sp_cache_invalidate( coeff_v );
+
 	free( (void*)block_s );
 	vbx_shared_free( (void*)block_v );
 	vbx_shared_free( (void*)coeff_v );
@@ -405,7 +419,9 @@ void vbx_mtx_fdct_tile_setup( dt *coeff_v, dt *image )
 	const int num_bytes = BIG_TILE_SIZE * sizeof(dt);
 	const int co_bytes = NUM_TILE_X* DCT_SIZE *sizeof(dt);
 
-	vcoeff    = (vbx_half_t *)vbx_sp_malloc( co_bytes );
+	// the coefficients stay resident, a second setup does not reload them
+	vcoeff_cached = (vbx_half_t *)vbx_sp_cache_get( coeff_v, co_bytes );
+	vcoeff    = vcoeff_cached ? vcoeff_cached : (vbx_half_t *)vbx_sp_malloc( co_bytes );
 	vprods    = (vbx_half_t *)vbx_sp_malloc( num_bytes );
 #if USE_ACCUM_FLAGS
 	vaccum    = (vbx_half_t *)vbx_sp_malloc( num_bytes );
@@ -420,12 +436,11 @@ void vbx_mtx_fdct_tile_setup( dt *coeff_v, dt *image )
 		VBX_PRINTF( "ERROR: out of memory.\n" );
 		VBX_EXIT(-1);
 	}
-	vbx_dma_to_vector( vcoeff, (void*)coeff_v, co_bytes );
-
-	int row;
-	for( row=0; row < BLOCK_SIZE; row++ ) {
-		getBigTileImageY(row,image,db);
+	if( !vcoeff_cached ) {
+		vbx_dma_to_vector( vcoeff, (void*)coeff_v, co_bytes );
 	}
+
+	vbx_mtx_fdct_tile_prefetch( image );
 #if USE_ACCUM_FLAGS 
 	// create a flag vector first element 0, next 'BLOCK_SIZE-1' element non-zero, etc
 	vbx_set_vl( NUM_TILE_X * BLOCK_SIZE * NUM_TILE_Y * BLOCK_SIZE - (BLOCK_SIZE-1) );
@@ -433,6 +448,16 @@ void vbx_mtx_fdct_tile_setup( dt *coeff_v, dt *image )
 #endif
 }
 
+// Starts the prefetch of the first tile of the image, so the image can be run again
+void vbx_mtx_fdct_tile_prefetch( dt *image )
+{
+	int row;
+	db = 0;
+	for( row=0; row < BLOCK_SIZE; row++ ) {
+		getBigTileImageY(row,image,db);
+	}
+}
+
 void vbx_mtx_fdct_tile( dt *block_v, dt *image, int start_x, int start_y, int end_x, int end_y,int num_tile_x, int num_tile_y )
 {
 //	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
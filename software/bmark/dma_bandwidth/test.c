@@ -48,23 +48,20 @@ VBXCOPYRIGHT( test_dma_bandwidth )
 #include "vbx_test.h"
 
 ///////////////////////////////////////////////////////////////////////////
-void print_dma_bandwidth(vbx_timestamp_t time_start,
-                         vbx_timestamp_t time_stop,
+// seconds is the median time of one run of iterations transfers
+void print_dma_bandwidth(double seconds,
                          int bytes,
                          int iterations,
                          double max_megabytes_per_second)
 {
-	if (time_stop < time_start) {
-		printf("Error: DMA stop time (%llu) is less than start time (%llu)!\n",
-		       (unsigned long long) time_stop,
-		       (unsigned long long) time_start);
+	if (seconds <= 0.0) {
+		printf("Error: DMA time is not positive.\n");
 		printf("Skipping bandwidth calculation.\n");
 		return;
 	}
 
-	vbx_timestamp_t cycles = time_stop - time_start;
+	vbx_timestamp_t cycles = (vbx_timestamp_t) (seconds * vbx_timestamp_freq() + 0.5);
 	vbx_timestamp_t mxp_cycles = vbx_mxp_cycles(cycles);
-	double seconds = ((double) cycles) / ((double) vbx_timestamp_freq());
 
 	vbx_timestamp_t avg_mxp_cycles = mxp_cycles/iterations;
 	double avg_seconds = seconds/((double) iterations);
@@ -79,7 +76,7 @@ void print_dma_bandwidth(vbx_timestamp_t time_start,
 	printf("Megabytes per second: %s\n", vbx_eng(megabytes_per_second, 4));
 	printf("Efficiency: %.0f%%\n",
 	       round(megabytes_per_second*100/max_megabytes_per_second));
-	printf("Average of %d transfers.\n", iterations);
+	printf("Average of %d transfers, median run.\n", iterations);
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -94,6 +91,10 @@ int dma_bandwidth_test()
 	vbx_ubyte_t *v_buf = vbx_sp_malloc(scratchpad_size);
 
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	double seconds;
+	char name[64];
+	int run;
 
 	int i;
 	int len;
@@ -114,23 +115,26 @@ int dma_bandwidth_test()
 	for (to_host = 0; to_host < 2; to_host++) {
 		for (len = 32; len <= scratchpad_size ; len *= 2) {
 			printf("DMA %s, %d bytes\n", to_host ? "write" : "read", len);
+			sprintf(name, "DMA %s %d bytes", to_host ? "write" : "read", len);
 			vbx_timestamp_start();
-			if (to_host) {
+			vbx_bench_begin(&bench, name);
+			for (run = 0; run < vbx_bench_runs(&bench); run++) {
 				time_start = vbx_timestamp();
-				for (i = 0; i < num_iter; i++) {
-					vbx_dma_to_host(buf, v_buf, len);
-				}
-				vbx_sync();
-				time_stop = vbx_timestamp();
-			} else {
-				time_start = vbx_timestamp();
-				for (i = 0; i < num_iter; i++) {
-					vbx_dma_to_vector(v_buf, buf, len);
+				if (to_host) {
+					for (i = 0; i < num_iter; i++) {
+						vbx_dma_to_host(buf, v_buf, len);
+					}
+				} else {
+					for (i = 0; i < num_iter; i++) {
+						vbx_dma_to_vector(v_buf, buf, len);
+					}
 				}
 				vbx_sync();
 				time_stop = vbx_timestamp();
+				vbx_bench_record(&bench, time_start, time_stop);
 			}
-			print_dma_bandwidth(time_start, time_stop, len, num_iter,
+			seconds = vbx_bench_end(&bench, num_iter, "transfer", 0.0);
+			print_dma_bandwidth(seconds, len, num_iter,
 			                    max_megabytes_per_sec);
 			printf("\n");
 		}
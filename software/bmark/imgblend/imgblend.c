@@ -40,6 +40,7 @@
 VBXCOPYRIGHT( mtx_imgblend )
 
 #include "vbx.h"
+#include "vbw_stream.h"
 
 #include "imgblend.h"
 
@@ -66,70 +67,39 @@ void scalar_blend(
 
 
 
+// Blends a chunk of pixels
+static void vector_blend_chunk( const vbw_stream_chunk_t *chunk, void *arg )
+{
+	const intermediate_type blending_const     = *(intermediate_type *)arg;
+	const intermediate_type blending_const_bar = 256-blending_const;
+	const int n = chunk->rows;
+
+	input_type        *v_img1 = (input_type *)chunk->v_in[0];
+	input_type        *v_img2 = (input_type *)chunk->v_in[1];
+	output_type       *v_out  = (output_type *)chunk->v_out[0];
+	intermediate_type *v_temp1 = (intermediate_type *)chunk->v_temp;
+	intermediate_type *v_temp2 = v_temp1 + n;
+
+	vbx_set_vl( n );
+	vbx( SVBHU, VMULLO, v_temp1, blending_const,     v_img1 );
+	vbx( SVBHU, VMULLO, v_temp2, blending_const_bar, v_img2 );
+	vbx( VVHU,  VADD,   v_temp1, v_temp1,            v_temp2 );
+	vbx( SVHBU, VSHR,   v_out,   8,                  v_temp1 );
+}
+
 //vector version of rgb converter
 void vector_blend(
 	output_pointer img_out, input_pointer img_in1, input_pointer img_in2,
 	unsigned int num_row, unsigned int num_column, intermediate_type blending_const )
 {
-	intermediate_type *v_img1[2];
-	input_type        *v_img2[2];
-	intermediate_type *v_temp;
-
-	intermediate_type blending_const_bar = 256-blending_const;
-	int j;
-
-	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
-	const int VBX_SCRATCHPAD_SIZE = this_mxp->scratchpad_size;
-	const int VBX_WIDTH_BYTES     = this_mxp->vector_lanes * sizeof(int);
-	const int VBX_DMA_ALIGNMENT   = this_mxp->dma_alignment_bytes;
-
-	unsigned int chunk_size = VBX_SCRATCHPAD_SIZE/((3*sizeof(intermediate_type))+(2*sizeof(input_type)));
-	chunk_size = VBX_PAD_UP( chunk_size-(VBX_WIDTH_BYTES-1), VBX_DMA_ALIGNMENT );
-
-	unsigned int chunk_size_old    = chunk_size;
-	unsigned int vector_length     = chunk_size;
-	unsigned int vector_length_old = vector_length;
-
-	v_img1[0] = (intermediate_type *)vbx_sp_malloc( chunk_size*sizeof(intermediate_type) );
-	v_img1[1] = (intermediate_type *)vbx_sp_malloc( chunk_size*sizeof(intermediate_type) );
-	v_img2[0] = (input_type        *)vbx_sp_malloc( chunk_size*sizeof(input_type) );
-	v_img2[1] = (input_type        *)vbx_sp_malloc( chunk_size*sizeof(input_type) );
-	v_temp    = (intermediate_type *)vbx_sp_malloc( chunk_size*sizeof(intermediate_type) );
-
-	if( v_temp == NULL ) {
+	// the image streams through the scratchpad as rows of one pixel
+	vbw_stream_t in[2] = {
+		{ img_in1, sizeof(input_type), 1, 0, 0 },
+		{ img_in2, sizeof(input_type), 1, 0, 0 } };
+	vbw_stream_t out = { img_out, sizeof(output_type), 1, 0, 0 };
+
+	if( vbw_stream( in, 2, &out, 1, num_row*num_column, 1, 2*sizeof(intermediate_type),
+	                vector_blend_chunk, &blending_const ) ) {
 		VBX_EXIT(0xBADDEAD);
 	}
-
-	int bufselect = 0;
-
-	vbx_dma_to_vector( v_img1[bufselect], img_in1, chunk_size*sizeof(input_type) );
-	vbx_dma_to_vector( v_img2[bufselect], img_in2, chunk_size*sizeof(input_type) );
-
-	for( j=0; j<num_row*num_column; j+=vector_length_old ) {
-		vbx_set_vl(vector_length);
-
-		if( j > 0 ) {
-			vbx_dma_to_host( img_out+j-vector_length_old, v_img1[1-bufselect], chunk_size_old*sizeof(output_type) );
-		} 
-
-		if( (j+vector_length_old) < (num_row*num_column-1) ) {
-			if( (j+vector_length_old*2) >= num_row*num_column ) {
-				vector_length =  num_row*num_column - j - vector_length_old;
-				chunk_size = vector_length;
-			}
-			vbx_dma_to_vector( v_img1[1-bufselect], img_in1+j+vector_length_old, chunk_size*sizeof(input_type) );
-			vbx_dma_to_vector( v_img2[1-bufselect], img_in2+j+vector_length_old, chunk_size*sizeof(input_type) );
-		} 		 		       
-
-		vbx( SVBHU, VMULLO, v_temp,            blending_const,     v_img1[bufselect] );
-		vbx( SVBHU, VMULLO, v_img1[bufselect], blending_const_bar, v_img2[bufselect] );
-		vbx( VVHU,  VADD,   v_img1[bufselect], v_img1[bufselect],  v_temp );
-		vbx( SVHBU, VSHR,   v_img1[bufselect], 8,                  v_img1[bufselect] );
-
-		bufselect = 1-bufselect;
-	}
-
-	vbx_dma_to_host( img_out+j-vector_length_old, v_img1[1-bufselect], chunk_size*sizeof(output_type) );
-	vbx_sp_free();
-	vbx_sync();
 }
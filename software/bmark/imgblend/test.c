@@ -72,6 +72,8 @@ void init_img( input_pointer input1, input_pointer input2 )
 int main(void)
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	double scalar_time, vector_time;
 
 	input_pointer img1;
@@ -110,23 +112,31 @@ int main(void)
 	printf("Executing Scalar Image Blend...\n");
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	scalar_blend( scalar_out, sc_img1, sc_img2, NUM_OF_ROWS, NUM_OF_COLUMNS, CONST_BLEND );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Scalar" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		scalar_blend( scalar_out, sc_img1, sc_img2, NUM_OF_ROWS, NUM_OF_COLUMNS, CONST_BLEND );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf("Finished Scalar Image Blend\n");
-	scalar_time = vbx_print_scalar_time(time_start, time_stop);
+	scalar_time = vbx_bench_end( &bench, 0.0, "", 0.0 );
 
 	printf("\nExecuting Vector Image Blend...\n");
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	vector_blend( vector_out, img1, img2, NUM_OF_ROWS, NUM_OF_COLUMNS, CONST_BLEND);
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		vector_blend( vector_out, img1, img2, NUM_OF_ROWS, NUM_OF_COLUMNS, CONST_BLEND);
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf("Finished Vector Image Blend\n");
 
-	vector_time = vbx_print_vector_time(time_start, time_stop, scalar_time);
+	vector_time = vbx_bench_end( &bench, 0.0, "", scalar_time );
 
 	int errors = 0;
 	for( j=0; j<NUM_OF_ROWS; j++ ) {
@@ -57,73 +57,97 @@ VBXCOPYRIGHT( test_libfix_math )
 double test_vector_sqrt(vbx_word_t *v_out, vbx_word_t  *v_in, int TEST_SIZE, double scalar_time, int hardware, int hardware_offset)
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting MXP libfixmath sqrt..." );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	vbx_set_vl(TEST_SIZE);
-	if(hardware){
-		vbw_fix16_sqrt_hw( v_out, v_in, TEST_SIZE, hardware_offset );
-	}else{
-		vbw_fix16_sqrt( v_out, v_in, TEST_SIZE );
+	vbx_bench_begin( &bench, "Vector sqrt" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		vbx_set_vl(TEST_SIZE);
+		if(hardware){
+			vbw_fix16_sqrt_hw( v_out, v_in, TEST_SIZE, hardware_offset );
+		}else{
+			vbw_fix16_sqrt( v_out, v_in, TEST_SIZE );
+		}
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
 	}
-	time_stop = vbx_timestamp();
 
 	printf( "...done\n" );
-	return vbx_print_vector_time( time_start, time_stop, scalar_time );
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
 double test_scalar_sqrt( int32_t  *scalar_out, int32_t  *scalar_in, int TEST_SIZE )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting scalar libfixmath sqrt...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	int i;
-	for(i=0;i<TEST_SIZE;i++){
-		scalar_out[i]  = fix16_sqrt(scalar_in[i]);
-	}   
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Scalar sqrt" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		int i;
+		for(i=0;i<TEST_SIZE;i++){
+			scalar_out[i]  = fix16_sqrt(scalar_in[i]);
+		}   
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_scalar_time( time_start, time_stop );
+	return vbx_bench_end( &bench, 0.0, "", 0.0 );
 }
 
 double test_vector_div(vbx_word_t *v_out, vbx_word_t  *v_in1, vbx_word_t *v_in2, int TEST_SIZE, double scalar_time, int hardware, int hardware_offset)
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting MXP libfixmath div..." );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	vbx_set_vl(TEST_SIZE);
-	if(hardware){
-		vbw_fix16_div_hw( v_out, v_in1, v_in2, TEST_SIZE, hardware_offset );
-	}else{
-		vbw_fix16_div( v_out, v_in1, v_in2, TEST_SIZE );
+	vbx_bench_begin( &bench, "Vector div" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		vbx_set_vl(TEST_SIZE);
+		if(hardware){
+			vbw_fix16_div_hw( v_out, v_in1, v_in2, TEST_SIZE, hardware_offset );
+		}else{
+			vbw_fix16_div( v_out, v_in1, v_in2, TEST_SIZE );
+		}
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
 	}
-	time_stop = vbx_timestamp();
 
 	printf( "...done\n" );
-	return vbx_print_vector_time( time_start, time_stop, scalar_time );
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
 double test_scalar_div( int32_t  *scalar_out, int32_t *scalar_in1, int32_t *scalar_in2, int TEST_SIZE )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting scalar libfixmath div...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	int i;
-	for(i=0;i<TEST_SIZE;i++){
-		scalar_out[i]  = fix16_div( scalar_in1[i], scalar_in2[i] );
-	}   
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Scalar div" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		int i;
+		for(i=0;i<TEST_SIZE;i++){
+			scalar_out[i]  = fix16_div( scalar_in1[i], scalar_in2[i] );
+		}   
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_scalar_time( time_start, time_stop );
+	return vbx_bench_end( &bench, 0.0, "", 0.0 );
 }
 
 int main(void)
@@ -151,7 +175,7 @@ int main(void)
 
 	double scalar_time, vector_time;
 	int errors = 0;
-	int hardware = USE_HARDWARE;
+	int hardware = USE_HARDWARE && this_mxp->vci_enabled; // the _hw variants need the VCI custom instructions
 
 	vbx_mxp_print_params();
 	printf( "\nLibfixmath test...\n" );
@@ -0,0 +1,256 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+
+#include "vbx_copyright.h"
+VBXCOPYRIGHT( test_minmax )
+
+/*
+ * Min, max and compare-exchange - Scalar version and Vector version
+ */
+
+#include <stdio.h>
+#include "vbx.h"
+#include "vbx_test.h"
+#include "vbw_minmax_all.h"
+
+#define VBX_TEMPLATE_T   VBX_BYTESIZE_DEF
+// signed   VBX_BYTESIZE_DEF    VBX_HALFSIZE_DEF    VBX_WORDSIZE_DEF
+// unsigned VBX_UBYTESIZE_DEF   VBX_UHALFSIZE_DEF   VBX_UWORDSIZE_DEF
+#include "vbw_template_t.h"
+
+#define ROWS 4
+#define COLS 64
+#define MATS 2
+#define N    (ROWS*COLS*MATS)
+
+enum { MIN, MAX };
+
+vbx_mm_t *scalar_a, *scalar_b, *scalar_min, *scalar_max, *vector_out;
+
+void scalar_cmpx( vbx_mm_t *mn, vbx_mm_t *mx, vbx_mm_t *a, vbx_mm_t *b, int n )
+{
+	int i;
+	for( i = 0; i < n; i++ ) {
+		vbx_mm_t x = a[i], y = b[i];
+		mn[i] = x < y ? x : y;
+		mx[i] = x < y ? y : x;
+	}
+}
+
+// loads the operands, so each case starts from the same vectors
+void load( vbx_sp_t *v_a, vbx_sp_t *v_b )
+{
+	vbx_dma_to_vector( v_a, scalar_a, N*sizeof(vbx_sp_t) );
+	vbx_dma_to_vector( v_b, scalar_b, N*sizeof(vbx_sp_t) );
+}
+
+int check( const char *name, vbx_sp_t *v, vbx_mm_t *expected )
+{
+	int errors;
+	vbx_dma_to_host( vector_out, v, N*sizeof(vbx_sp_t) );
+	vbx_sync();
+	errors = VBX_T(test_verify_array)( expected, vector_out, N );
+	printf( "%-28s %s\n", name, errors ? "FAILED" : "ok" );
+	return errors;
+}
+
+// every way the outputs of min and max can overlap the sources, with and without a temporary
+int test_min_max( int op, vbx_sp_t *v_a, vbx_sp_t *v_b, vbx_sp_t *v_c, vbx_sp_t *v_t )
+{
+	void (*f)( vbx_sp_t *, vbx_sp_t *, vbx_sp_t *, vbx_sp_t * ) = op == MIN ? VBX_T(vbw_min) : VBX_T(vbw_max);
+	vbx_mm_t *expected = op == MIN ? scalar_min : scalar_max;
+	int errors = 0;
+
+	vbx_set_vl( N );
+	load( v_a, v_b ); f( v_c, v_a, v_b, NULL );
+	errors += check( op == MIN ? "min c=a,b" : "max c=a,b", v_c, expected );
+	load( v_a, v_b ); f( v_a, v_a, v_b, NULL );
+	errors += check( op == MIN ? "min a=a,b" : "max a=a,b", v_a, expected );
+	load( v_a, v_b ); f( v_b, v_a, v_b, NULL );
+	errors += check( op == MIN ? "min b=a,b" : "max b=a,b", v_b, expected );
+	load( v_a, v_b ); f( v_a, v_a, v_b, v_t );
+	errors += check( op == MIN ? "min a=a,b temp" : "max a=a,b temp", v_a, expected );
+	load( v_a, v_b ); f( v_b, v_a, v_b, v_t );
+	errors += check( op == MIN ? "min b=a,b temp" : "max b=a,b temp", v_b, expected );
+	return errors;
+}
+
+// every way the outputs of a compare-exchange can overlap the sources
+int test_cmpx( vbx_sp_t *v_a, vbx_sp_t *v_b, vbx_sp_t *v_c, vbx_sp_t *v_d, vbx_sp_t *v_t )
+{
+	int errors = 0;
+
+	vbx_set_vl( N );
+	load( v_a, v_b ); VBX_T(vbw_cmpx)( v_c, v_d, v_a, v_b, NULL );
+	errors += check( "cmpx c,d=a,b min", v_c, scalar_min );
+	errors += check( "cmpx c,d=a,b max", v_d, scalar_max );
+	load( v_a, v_b ); VBX_T(vbw_cmpx)( v_a, v_b, v_a, v_b, v_t );
+	errors += check( "cmpx a,b=a,b temp min", v_a, scalar_min );
+	errors += check( "cmpx a,b=a,b temp max", v_b, scalar_max );
+	load( v_a, v_b ); VBX_T(vbw_cmpx)( v_b, v_a, v_a, v_b, v_t );
+	errors += check( "cmpx b,a=a,b temp min", v_b, scalar_min );
+	errors += check( "cmpx b,a=a,b temp max", v_a, scalar_max );
+	load( v_a, v_b ); VBX_T(vbw_cmpx)( v_a, v_d, v_a, v_b, NULL );
+	errors += check( "cmpx a,d=a,b min", v_a, scalar_min );
+	errors += check( "cmpx a,d=a,b max", v_d, scalar_max );
+	load( v_a, v_b ); VBX_T(vbw_cmpx)( v_c, v_a, v_a, v_b, NULL );
+	errors += check( "cmpx c,a=a,b min", v_c, scalar_min );
+	errors += check( "cmpx c,a=a,b max", v_a, scalar_max );
+	load( v_a, v_b ); VBX_T(vbw_cmpx)( v_b, v_d, v_a, v_b, NULL );
+	errors += check( "cmpx b,d=a,b min", v_b, scalar_min );
+	errors += check( "cmpx b,d=a,b max", v_d, scalar_max );
+	return errors;
+}
+
+// the same vectors as ROWS x COLS matrices, and MATS of those
+int test_2D_3D( vbx_sp_t *v_a, vbx_sp_t *v_b, vbx_sp_t *v_c, vbx_sp_t *v_t )
+{
+	const int row = COLS*sizeof(vbx_sp_t);
+	const int mat = ROWS*row;
+	int errors = 0;
+
+	vbx_set_vl( COLS );
+	vbx_set_2D( ROWS*MATS, row, row, row );
+	load( v_a, v_b ); VBX_T(vbw_min_2D)( v_c, v_a, v_b, NULL );
+	errors += check( "min_2D c=a,b", v_c, scalar_min );
+	load( v_a, v_b ); VBX_T(vbw_max_2D)( v_a, v_a, v_b, v_t );
+	errors += check( "max_2D a=a,b temp", v_a, scalar_max );
+	load( v_a, v_b ); VBX_T(vbw_cmpx_2D)( v_a, v_b, v_a, v_b, v_t );
+	errors += check( "cmpx_2D a,b=a,b temp min", v_a, scalar_min );
+	errors += check( "cmpx_2D a,b=a,b temp max", v_b, scalar_max );
+
+	vbx_set_2D( ROWS, row, row, row );
+	vbx_set_3D( MATS, mat, mat, mat );
+	load( v_a, v_b ); VBX_T(vbw_max_3D)( v_c, v_a, v_b, NULL );
+	errors += check( "max_3D c=a,b", v_c, scalar_max );
+	load( v_a, v_b ); VBX_T(vbw_min_3D)( v_b, v_a, v_b, v_t );
+	errors += check( "min_3D b=a,b temp", v_b, scalar_min );
+	load( v_a, v_b ); VBX_T(vbw_cmpx_3D)( v_c, v_b, v_a, v_b, NULL );
+	errors += check( "cmpx_3D c,b=a,b min", v_c, scalar_min );
+	errors += check( "cmpx_3D c,b=a,b max", v_b, scalar_max );
+	return errors;
+}
+
+double test_vector( vbx_sp_t *v_a, vbx_sp_t *v_b, vbx_sp_t *v_t, int n, double scalar_time )
+{
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
+	printf( "\nExecuting MXP compare-exchange...\n" );
+
+	vbx_set_vl( n );
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "Vector" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(vbw_cmpx)( v_a, v_b, v_a, v_b, v_t );
+		vbx_sync();
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+
+	printf( "...done\n" );
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
+}
+
+double test_scalar( vbx_mm_t *mn, vbx_mm_t *mx, vbx_mm_t *a, vbx_mm_t *b, int n )
+{
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
+	printf( "\nExecuting scalar compare-exchange...\n" );
+
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "Scalar" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		scalar_cmpx( mn, mx, a, b, n );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+
+	printf( "...done\n" );
+	return vbx_bench_end( &bench, 0.0, "", 0.0 );
+}
+
+int main(void)
+{
+	vbx_test_init();
+
+	double scalar_time;
+	int errors=0;
+
+	vbx_mxp_print_params();
+	printf( "\nMin/max test...\n" );
+	printf( "Vector length: %d\n", N );
+
+	scalar_a   = vbx_shared_malloc( N*sizeof(vbx_mm_t) );
+	scalar_b   = vbx_shared_malloc( N*sizeof(vbx_mm_t) );
+	scalar_min = malloc( N*sizeof(vbx_mm_t) );
+	scalar_max = malloc( N*sizeof(vbx_mm_t) );
+	vector_out = vbx_shared_malloc( N*sizeof(vbx_mm_t) );
+
+	vbx_sp_t *v_a = vbx_sp_malloc( N*sizeof(vbx_sp_t) );
+	vbx_sp_t *v_b = vbx_sp_malloc( N*sizeof(vbx_sp_t) );
+	vbx_sp_t *v_c = vbx_sp_malloc( N*sizeof(vbx_sp_t) );
+	vbx_sp_t *v_d = vbx_sp_malloc( N*sizeof(vbx_sp_t) );
+	vbx_sp_t *v_t = vbx_sp_malloc( N*sizeof(vbx_sp_t) );
+
+	// the whole range of the type, so the differences wrap
+	VBX_T(test_init_array)( scalar_a, N, 1 );
+	VBX_T(test_init_array)( scalar_b, N, 3 );
+	scalar_b[N-1] = scalar_a[N-1];
+
+	VBX_T(test_print_array)( scalar_a, MAX_PRINT_LENGTH );
+	VBX_T(test_print_array)( scalar_b, MAX_PRINT_LENGTH );
+
+	scalar_time = test_scalar( scalar_min, scalar_max, scalar_a, scalar_b, N );
+	VBX_T(test_print_array)( scalar_min, MAX_PRINT_LENGTH );
+
+	errors += test_min_max( MIN, v_a, v_b, v_c, v_t );
+	errors += test_min_max( MAX, v_a, v_b, v_c, v_t );
+	errors += test_cmpx( v_a, v_b, v_c, v_d, v_t );
+	errors += test_2D_3D( v_a, v_b, v_c, v_t );
+
+	load( v_a, v_b );
+	test_vector( v_a, v_b, v_t, N, scalar_time );
+	errors += check( "cmpx bench min", v_a, scalar_min );
+
+	VBX_TEST_END(errors);
+	return 0;
+}
@@ -0,0 +1,231 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+
+#include "vbx_copyright.h"
+VBXCOPYRIGHT( test_mtx_conv )
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "vbx.h"
+#include "vbx_test.h"
+#include "scalar_mtx_conv.h"
+#include "vbw_mtx_conv_all.h"
+
+#define VBX_TEMPLATE_T   VBX_UBYTESIZE_DEF
+// signed   VBX_BYTESIZE_DEF    VBX_HALFSIZE_DEF    VBX_WORDSIZE_DEF
+// unsigned VBX_UBYTESIZE_DEF   VBX_UHALFSIZE_DEF   VBX_UWORDSIZE_DEF
+#include "vbw_template_t.h"
+
+#define WIDTH  640
+#define PITCH  648
+#define HEIGHT 48
+#define LENGTH (PITCH*HEIGHT)
+
+// The kernel of a separable convolution
+static void outer_product( int32_t *coeffs, const int32_t *row_coeffs, const int32_t *col_coeffs, int kernel_rows, int kernel_cols )
+{
+	int r, c;
+	for( r = 0; r < kernel_rows; r++ ) {
+		for( c = 0; c < kernel_cols; c++ ) {
+			coeffs[r*kernel_cols+c] = col_coeffs[r]*row_coeffs[c];
+		}
+	}
+}
+
+static int check( const char *name, vbx_mm_t *scalar_out, vbx_mm_t *vector_out, int kernel_rows, int kernel_cols )
+{
+	int y, errors = 0;
+	for( y = 0; y < HEIGHT && !errors; y++ ) {
+		errors += VBX_T(test_verify_array)( scalar_out+y*PITCH, vector_out+y*PITCH, WIDTH );
+	}
+	if( errors ) {
+		printf( "%s: %dx%d kernel failed\n", name, kernel_rows, kernel_cols );
+	}
+	return errors;
+}
+
+// General and separable kernels of every shape up to the largest, against the scalar reference
+int test_sizes( vbx_mm_t *in, vbx_mm_t *scalar_out, vbx_mm_t *vector_out )
+{
+	static const int sizes[] = { 1, 2, 3, 4, 7, 10, VBW_CONV_MAX_TAPS };
+	const int num_sizes = sizeof(sizes)/sizeof(sizes[0]);
+	int32_t coeffs[VBW_CONV_MAX_TAPS*VBW_CONV_MAX_TAPS], row_coeffs[VBW_CONV_MAX_TAPS], col_coeffs[VBW_CONV_MAX_TAPS];
+	int i, j, k, kr, kc, shift, saturate, errors = 0;
+
+	for( i = 0; i < num_sizes; i++ ) {
+		for( j = 0; j < num_sizes; j++ ) {
+			kr = sizes[i];
+			kc = sizes[j];
+			shift = (i+j) % 9;
+			saturate = (i+j) % 2;
+			for( k = 0; k < kr*kc; k++ ) {
+				coeffs[k] = rand() % 15 - 5;
+			}
+			for( k = 0; k < VBW_CONV_MAX_TAPS; k++ ) {
+				row_coeffs[k] = rand() % 11 - 3;
+				col_coeffs[k] = rand() % 11 - 3;
+			}
+
+			VBX_T(scalar_mtx_conv)( scalar_out, in, coeffs, kr, kc, WIDTH, HEIGHT, PITCH, shift, saturate );
+			if( VBX_T(vbw_mtx_conv)( vector_out, in, coeffs, kr, kc, WIDTH, HEIGHT, PITCH, shift, saturate ) ) {
+				printf( "sizes: %dx%d kernel returned an error\n", kr, kc );
+				errors++;
+			}
+			errors += check( "sizes", scalar_out, vector_out, kr, kc );
+
+			outer_product( coeffs, row_coeffs, col_coeffs, kr, kc );
+			VBX_T(scalar_mtx_conv)( scalar_out, in, coeffs, kr, kc, WIDTH, HEIGHT, PITCH, shift, saturate );
+			if( VBX_T(vbw_mtx_conv_sep)( vector_out, in, row_coeffs, col_coeffs, kr, kc, WIDTH, HEIGHT, PITCH, shift, saturate ) ) {
+				printf( "sizes: separable %dx%d kernel returned an error\n", kr, kc );
+				errors++;
+			}
+			errors += check( "sizes separable", scalar_out, vector_out, kr, kc );
+		}
+	}
+	return errors;
+}
+
+// Unsharp mask, 2*in - blur, with saturation, written over its input
+int test_unsharp_in_place( vbx_mm_t *in, vbx_mm_t *scalar_out, vbx_mm_t *vector_out )
+{
+	static const int32_t sharpen[9] = { -1, -2, -1,
+	                                    -2, 28, -2,
+	                                    -1, -2, -1 };
+	int errors;
+
+	VBX_T(scalar_mtx_conv)( scalar_out, in, sharpen, 3, 3, WIDTH, HEIGHT, PITCH, 4, 1 );
+	VBX_T(test_copy_array)( vector_out, in, LENGTH );
+	errors = VBX_T(vbw_mtx_conv)( vector_out, vector_out, sharpen, 3, 3, WIDTH, HEIGHT, PITCH, 4, 1 ) != 0;
+	return errors + check( "unsharp in place", scalar_out, vector_out, 3, 3 );
+}
+
+// Kernels larger than allowed are refused
+int test_too_large( vbx_mm_t *in, vbx_mm_t *out )
+{
+	int32_t coeffs[VBW_CONV_MAX_TAPS+1] = { 0 };
+	int errors = 0;
+
+	if( VBX_T(vbw_mtx_conv)( out, in, coeffs, 1, VBW_CONV_MAX_TAPS+1, WIDTH, HEIGHT, PITCH, 0, 0 ) != -1 ||
+	    VBX_T(vbw_mtx_conv_sep)( out, in, coeffs, coeffs, VBW_CONV_MAX_TAPS+1, 1, WIDTH, HEIGHT, PITCH, 0, 0 ) != -1 ) {
+		printf( "too large: a %d tap kernel was not refused\n", VBW_CONV_MAX_TAPS+1 );
+		errors++;
+	}
+	return errors;
+}
+
+// 5x5 Gaussian blur, scalar against separable and general vector kernels
+int bench_gaussian( vbx_mm_t *in, vbx_mm_t *scalar_out, vbx_mm_t *vector_out )
+{
+	static const int32_t binomial[5] = { 1, 4, 6, 4, 1 };
+	int32_t coeffs[25];
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	double scalar_time;
+	int run, status, errors = 0;
+
+	outer_product( coeffs, binomial, binomial, 5, 5 );
+
+	printf( "\nExecuting scalar 5x5 Gaussian blur...\n" );
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "Scalar gaussian" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(scalar_mtx_conv)( scalar_out, in, coeffs, 5, 5, WIDTH, HEIGHT, PITCH, 8, 0 );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	scalar_time = vbx_bench_end( &bench, 0.0, "", 0.0 );
+
+	printf( "\nExecuting vector 5x5 Gaussian blur, separable...\n" );
+	status = 0;
+	vbx_bench_begin( &bench, "Vector gaussian separable" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		status |= VBX_T(vbw_mtx_conv_sep)( vector_out, in, binomial, binomial, 5, 5, WIDTH, HEIGHT, PITCH, 8, 0 );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	vbx_bench_end( &bench, 0.0, "", scalar_time );
+	errors += status != 0;
+	errors += check( "gaussian separable", scalar_out, vector_out, 5, 5 );
+
+	printf( "\nExecuting vector 5x5 Gaussian blur, general kernel...\n" );
+	status = 0;
+	vbx_bench_begin( &bench, "Vector gaussian" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		status |= VBX_T(vbw_mtx_conv)( vector_out, in, coeffs, 5, 5, WIDTH, HEIGHT, PITCH, 8, 0 );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	vbx_bench_end( &bench, 0.0, "", scalar_time );
+	errors += status != 0;
+	errors += check( "gaussian", scalar_out, vector_out, 5, 5 );
+	return errors;
+}
+
+int main(void)
+{
+	int errors = 0;
+
+	vbx_test_init();
+	vbx_mxp_print_params();
+	printf( "\nMatrix convolution test...\n" );
+	printf( "Image dimensions: %dx%d, pitch %d\n", WIDTH, HEIGHT, PITCH );
+
+	vbx_mm_t *in         = vbx_shared_malloc( LENGTH*sizeof(vbx_mm_t) );
+	vbx_mm_t *scalar_out = malloc( LENGTH*sizeof(vbx_mm_t) );
+	vbx_mm_t *vector_out = vbx_shared_malloc( LENGTH*sizeof(vbx_mm_t) );
+	if( !in || !scalar_out || !vector_out ) {
+		VBX_PRINTF( "ERROR: out of memory.\n" );
+		VBX_EXIT(-1);
+	}
+	VBX_T(test_init_array)( in, LENGTH, 1 );
+
+	errors += test_sizes( in, scalar_out, vector_out );
+	errors += test_unsharp_in_place( in, scalar_out, vector_out );
+	errors += test_too_large( in, vector_out );
+	errors += bench_gaussian( in, scalar_out, vector_out );
+
+	vbx_shared_free( in );
+	free( scalar_out );
+	vbx_shared_free( vector_out );
+
+	VBX_TEST_END(errors);
+	return 0;
+}
@@ -59,29 +59,41 @@ VBXCOPYRIGHT( test_mtx_fir )
 double test_vector( vbx_mm_t *out, vbx_mm_t *in, int32_t *coeffs, int test_row, int test_col, int ntaps_row, int ntaps_col, double scalar_time )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting MXP matrix FIR...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(vbw_mtx_2Dfir_transpose)( out, in, coeffs, test_row, test_col, ntaps_row, ntaps_col );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(vbw_mtx_2Dfir_transpose)( out, in, coeffs, test_row, test_col, ntaps_row, ntaps_col );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_vector_time( time_start, time_stop, scalar_time );
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
 double test_scalar( vbx_mm_t *scalar_out, vbx_mm_t *scalar_in, int32_t *coeffs, int test_row, int test_col, int ntaps_row, int ntaps_col)
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf("\nExecuting scalar matrix FIR...\n");
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(scalar_mtx_2Dfir)( scalar_out, scalar_in, coeffs, test_row, test_col, ntaps_row, ntaps_col );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Scalar" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(scalar_mtx_2Dfir)( scalar_out, scalar_in, coeffs, test_row, test_col, ntaps_row, ntaps_col );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_scalar_time( time_start, time_stop );
+	return vbx_bench_end( &bench, 0.0, "", 0.0 );
 }
 
 int main(void)
@@ -42,6 +42,8 @@ VBXCOPYRIGHT(test_median_argb)
 // This test currently requires at least 32KB of scratchpad memory.
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "vbx.h"
 #include "vbx_test.h"
 #include "scalar_mtx_median_argb32.h"
@@ -61,29 +63,59 @@ VBXCOPYRIGHT(test_median_argb)
 double test_vector(vbx_mm_t *vector_in, int filter_height, int filter_width, int image_height, int image_width, int image_pitch, double scalar_time)
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
+	const int image_bytes = image_height*image_pitch*sizeof(vbx_mm_t);
+	vbx_mm_t *image = malloc( image_bytes );
 	printf( "\nExecuting MXP matrix median...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	vbw_mtx_median_argb32( (unsigned *)vector_in, filter_height, filter_width, image_height, image_width, image_pitch);
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		// the image is filtered in place; start each run from the original
+		if( run ) {
+			memcpy( vector_in, image, image_bytes );
+		} else {
+			memcpy( image, vector_in, image_bytes );
+		}
+		time_start = vbx_timestamp();
+		vbw_mtx_median_argb32( (unsigned *)vector_in, filter_height, filter_width, image_height, image_width, image_pitch);
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
+	free( image );
 	printf( "...done\n" );
-	return vbx_print_vector_time(time_start, time_stop, scalar_time);
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
 double test_scalar(vbx_mm_t *scalar_in, int filter_height, int filter_width, int image_height, int image_width, int image_pitch)
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
+	const int image_bytes = image_height*image_pitch*sizeof(vbx_mm_t);
+	vbx_mm_t *image = malloc( image_bytes );
 	printf( "\nExecuting scalar matrix median...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	scalar_mtx_median_argb32( (pixel *)scalar_in, filter_height, filter_width, image_height, image_width, image_pitch);
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Scalar" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		// the image is filtered in place; start each run from the original
+		if( run ) {
+			memcpy( scalar_in, image, image_bytes );
+		} else {
+			memcpy( image, scalar_in, image_bytes );
+		}
+		time_start = vbx_timestamp();
+		scalar_mtx_median_argb32( (pixel *)scalar_in, filter_height, filter_width, image_height, image_width, image_pitch);
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
+	free( image );
 	printf( "...done\n" );
-	return vbx_print_scalar_time(time_start, time_stop);
+	return vbx_bench_end( &bench, 0.0, "", 0.0 );
 }
 
 int main(void)
@@ -60,34 +60,101 @@ VBXCOPYRIGHT( test_mtx_median )
 #define TEST_WIDTH 256
 #define TEST_PITCH (TEST_WIDTH*2)
 
+// rows too wide for one chunk
+#define WIDE_HEIGHT 10
+#define WIDE_WIDTH 8000
+#define WIDE_PITCH 8016
+
+static int verify_median( vbx_mm_t *scalar_out, vbx_mm_t *vector_out, int filter_height,
+		int filter_width, int image_height, int image_width, int image_pitch )
+{
+	int i, errors = 0;
+	for( i = 0; i < image_height-filter_height; i++ ){
+		errors += VBX_T(test_verify_array)( scalar_out+i*image_pitch, vector_out+i*image_pitch, image_width-filter_width );
+	}
+	return errors;
+}
+
+// The 3x3 and 5x5 networks and the bubble sort of the other shapes,
+// on rows that fit in one chunk and on rows split across chunks
+int test_shapes()
+{
+	static const short shapes[][2] = { {3,3}, {5,5}, {5,3}, {3,5}, {4,4}, {7,7} };
+	const int length = WIDE_HEIGHT*WIDE_PITCH;
+	int s, errors = 0, shape_errors;
+
+	vbx_mm_t *scalar_in  = malloc( length*sizeof(vbx_mm_t) );
+	vbx_mm_t *scalar_out = malloc( length*sizeof(vbx_mm_t) );
+	vbx_mm_t *vector_in  = vbx_shared_malloc( length*sizeof(vbx_mm_t) );
+	vbx_mm_t *vector_out = vbx_shared_malloc( length*sizeof(vbx_mm_t) );
+
+	VBX_T(test_init_matrix)( scalar_in, WIDE_HEIGHT, WIDE_PITCH, -2 );
+	VBX_T(test_copy_array)( vector_in, scalar_in, length );
+
+	for( s = 0; s < (int)(sizeof(shapes)/sizeof(shapes[0])); s++ ) {
+		const int fh = shapes[s][0], fw = shapes[s][1];
+
+		VBX_T(scalar_mtx_median)( scalar_out, scalar_in, fh, fw, WIDE_HEIGHT, TEST_WIDTH, WIDE_PITCH );
+		VBX_T(vbw_mtx_median)( vector_out, vector_in, fh, fw, WIDE_HEIGHT, TEST_WIDTH, WIDE_PITCH );
+		shape_errors = verify_median( scalar_out, vector_out, fh, fw, WIDE_HEIGHT, TEST_WIDTH, WIDE_PITCH );
+
+		VBX_T(scalar_mtx_median)( scalar_out, scalar_in, fh, fw, WIDE_HEIGHT, WIDE_WIDTH, WIDE_PITCH );
+		VBX_T(vbw_mtx_median)( vector_out, vector_in, fh, fw, WIDE_HEIGHT, WIDE_WIDTH, WIDE_PITCH );
+		shape_errors += verify_median( scalar_out, vector_out, fh, fw, WIDE_HEIGHT, WIDE_WIDTH, WIDE_PITCH );
+
+		if( shape_errors ) {
+			printf( "%dx%d median failed\n", fh, fw );
+		}
+		errors += shape_errors;
+	}
+
+	free( scalar_in );
+	free( scalar_out );
+	vbx_shared_free( vector_in );
+	vbx_shared_free( vector_out );
+	return errors;
+}
+
 double test_vector( vbx_mm_t *vector_out, vbx_mm_t *vector_in, int filter_height,
 		int filter_width, int image_height, int image_width, int image_pitch, double scalar_time )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting MXP matrix median...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T( vbw_mtx_median )( vector_out, vector_in, filter_height, filter_width, image_height, image_width, image_pitch);
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T( vbw_mtx_median )( vector_out, vector_in, filter_height, filter_width, image_height, image_width, image_pitch);
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_vector_time(time_start, time_stop, scalar_time);
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
 double test_scalar( vbx_mm_t *scalar_out, vbx_mm_t *scalar_in, int filter_height,
 		int filter_width, int image_height, int image_width, int image_pitch)
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting scalar matrix median...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T( scalar_mtx_median )( scalar_out, scalar_in, filter_height, filter_width, image_height, image_width, image_pitch);
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Scalar" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T( scalar_mtx_median )( scalar_out, scalar_in, filter_height, filter_width, image_height, image_width, image_pitch);
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_scalar_time(time_start, time_stop);
+	return vbx_bench_end( &bench, 0.0, "", 0.0 );
 }
 
 int main(void)
@@ -132,10 +199,8 @@ int main(void)
 	vector_time = test_vector( vector_out, vector_in, FILTER_HEIGHT, FILTER_WIDTH, TEST_HEIGHT, TEST_WIDTH, TEST_PITCH, scalar_time );
 	VBX_T(test_print_matrix)(vector_out, PRINT_RESULT_HEIGHT, PRINT_RESULT_WIDTH, TEST_PITCH);
 
-	int i;
-	for(i=0; i<TEST_HEIGHT-FILTER_HEIGHT; i++){
-		errors += VBX_T(test_verify_array)( scalar_out+i*TEST_PITCH, vector_out+i*TEST_PITCH, TEST_WIDTH-FILTER_WIDTH);
-	}
+	errors += verify_median( scalar_out, vector_out, FILTER_HEIGHT, FILTER_WIDTH, TEST_HEIGHT, TEST_WIDTH, TEST_PITCH );
+	errors += test_shapes();
 
 	VBX_TEST_END(errors);
 	return 0;
@@ -60,29 +60,41 @@ VBXCOPYRIGHT( test_mtx_mm )
 double test_vector_transposed(vbx_mm_t *vector_out, vbx_mm_t  *vector_in1, vbx_mm_t  *vector_in2_xp, int TEST_SIZE, double scalar_time )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting MXP matrix multiply (transposed)...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(vbw_mtx_mmt)( vector_out, vector_in1, vector_in2_xp, TEST_SIZE );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(vbw_mtx_mmt)( vector_out, vector_in1, vector_in2_xp, TEST_SIZE );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_vector_time( time_start, time_stop, scalar_time );
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
 double test_scalar( vbx_mm_t  *scalar_out, vbx_mm_t	 *scalar_in1, vbx_mm_t	*scalar_in2, int TEST_SIZE )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting scalar matrix multiply...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(scalar_mtx_mm)( scalar_out, scalar_in1, scalar_in2, TEST_SIZE );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Scalar" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(scalar_mtx_mm)( scalar_out, scalar_in1, scalar_in2, TEST_SIZE );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_scalar_time( time_start, time_stop );
+	return vbx_bench_end( &bench, 0.0, "", 0.0 );
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -157,25 +169,33 @@ double test_vector_with_transpose(int32_t *vector_out,
 								  int TEST_SIZE,
 								  double scalar_time )
 {
-	vbx_timestamp_t time_start, time_stop;
-	vbx_timestamp_t transpose_start, transpose_cycles;
-	int VBS;
+	vbx_timestamp_t time_start = 0, time_stop;
+	vbx_timestamp_t transpose_start = 0, transpose_cycles;
+	vbx_bench_t bench, bench_mm;
+	int run;
+	int VBS = 0;
 	double vector_time;
 	double N = (double) TEST_SIZE;
 
 	printf( "\nExecuting MXP matrix transpose then matrix multiply...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	// This requests more than 64KB of scratch;
-	// computes tile height, width = (128, 256)
-	// vbw_mtx_xp_NN_ext_word( vector_in2, vector_in1, TEST_SIZE );
-	// For scratchpad size of 64KB,
-	// computes tile height, width = (64, 128).
-	orig_vbw_mtx_xp_word( vector_in2, vector_in1, TEST_SIZE );
-	transpose_start = vbx_timestamp();
-	VBS = vbw_mtx_mmt_word( vector_out, vector_in1, vector_in2, TEST_SIZE );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector including transpose" );
+	vbx_bench_begin( &bench_mm, "Vector excluding transpose" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		// This requests more than 64KB of scratch;
+		// computes tile height, width = (128, 256)
+		// vbw_mtx_xp_NN_ext_word( vector_in2, vector_in1, TEST_SIZE );
+		// For scratchpad size of 64KB,
+		// computes tile height, width = (64, 128).
+		orig_vbw_mtx_xp_word( vector_in2, vector_in1, TEST_SIZE );
+		transpose_start = vbx_timestamp();
+		VBS = vbw_mtx_mmt_word( vector_out, vector_in1, vector_in2, TEST_SIZE );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+		vbx_bench_record( &bench_mm, transpose_start, time_stop );
+	}
 
 	transpose_cycles = vbx_mxp_cycles(transpose_start - time_start);
 	printf( "Transpose time in cycles: %llu\n", (unsigned long long) transpose_cycles);
@@ -184,13 +204,10 @@ double test_vector_with_transpose(int32_t *vector_out,
 
 	printf("\n");
 	print_results_header( "of vector code including transpose", TEST_SIZE, VBS );
-	vector_time = \
-		vbx_print_vector_time_per(time_start, time_stop, N*N*N,
-		                          "op", scalar_time);
+	vector_time = vbx_bench_end( &bench, N*N*N, "op", scalar_time );
 	printf("\n");
 	print_results_header( "of vector code excluding transpose", N, VBS );
-	vbx_print_vector_time_per(transpose_start, time_stop, N*N*N,
-	                          "op", scalar_time);
+	vbx_bench_end( &bench_mm, N*N*N, "op", scalar_time );
 
 	return vector_time;
 }
@@ -202,18 +219,24 @@ double test_scalar_tiled( int32_t *scalar_out,
 						  int TEST_SIZE )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	int BS = 32; // Works best, don't sweep anymore
 	double N = (double) TEST_SIZE;
 
 	printf( "\nExecuting scalar matrix multiply, kij tiled...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	scalar_block_kijkij_mm_word( scalar_out, scalar_in1, scalar_in2, TEST_SIZE, BS);
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Scalar tiled" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		scalar_block_kijkij_mm_word( scalar_out, scalar_in1, scalar_in2, TEST_SIZE, BS);
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	print_results_header( "of scalar code", N, BS );
-	return vbx_print_scalar_time_per( time_start, time_stop, N*N*N, "op" );
+	return vbx_bench_end( &bench, N*N*N, "op", 0.0 );
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -293,6 +316,85 @@ int orig_test(void)
 	return errors;
 }
 
+///////////////////////////////////////////////////////////////////////////
+// Multiplies an MxK matrix by a KxN matrix, with sizes that need not be
+// powers of two, passing the second matrix both as it is and transposed.
+int rect_test( const int M, const int N, const int K )
+{
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run, transposed;
+	int i, j, k;
+	double scalar_time;
+	int errors = 0;
+
+	printf( "\nMatrix multiply test, %dx%d by %dx%d...\n", M, K, K, N );
+
+	vbx_mm_t *scalar_in1 = malloc( M*K*sizeof(vbx_mm_t) );
+	vbx_mm_t *scalar_in2 = malloc( K*N*sizeof(vbx_mm_t) );
+	vbx_mm_t *scalar_out = malloc( M*N*sizeof(vbx_mm_t) );
+	vbx_mm_t *vector_in1 = vbx_shared_malloc( M*K*sizeof(vbx_mm_t) );
+	vbx_mm_t *vector_in2 = vbx_shared_malloc( K*N*sizeof(vbx_mm_t) );
+	vbx_mm_t *vector_out = vbx_shared_malloc( M*N*sizeof(vbx_mm_t) );
+
+	if( !scalar_in1 || !scalar_in2 || !scalar_out || !vector_in1 || !vector_in2 || !vector_out ) {
+		VBX_PRINTF( "ERROR: Out of memory.\n" );
+		VBX_EXIT( -1 );
+	}
+
+	VBX_T(test_init_array)( scalar_in1, M*K, 1 );
+	VBX_T(test_init_array)( scalar_in2, K*N, 2 );
+	VBX_T(test_copy_array)( vector_in1, scalar_in1, M*K );
+
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "Scalar MxNxK" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		for( i = 0; i < M; i++ ) {
+			for( j = 0; j < N; j++ ) {
+				vbx_mm_t sum = 0;
+				for( k = 0; k < K; k++ ) {
+					sum += scalar_in1[i*K+k] * scalar_in2[k*N+j];
+				}
+				scalar_out[i*N+j] = sum;
+			}
+		}
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	scalar_time = vbx_bench_end( &bench, (double)M*N*K, "op", 0.0 );
+
+	for( transposed = 0; transposed < 2; transposed++ ) {
+		if( transposed ) {
+			VBX_T(scalar_mtx_xp_MN)( vector_in2, scalar_in2, K, N );
+		} else {
+			VBX_T(test_copy_array)( vector_in2, scalar_in2, K*N );
+		}
+		VBX_T(test_zero_array)( vector_out, M*N );
+
+		vbx_timestamp_start();
+		vbx_bench_begin( &bench, transposed ? "Vector MxNxK transposed" : "Vector MxNxK" );
+		for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+			time_start = vbx_timestamp();
+			VBX_T(vbw_mtx_mm)( vector_out, vector_in1, vector_in2, M, N, K, transposed );
+			time_stop = vbx_timestamp();
+			vbx_bench_record( &bench, time_start, time_stop );
+		}
+		vbx_bench_end( &bench, (double)M*N*K, "op", scalar_time );
+
+		errors += VBX_T(test_verify_array)( scalar_out, vector_out, M*N );
+	}
+
+	vbx_shared_free(vector_out);
+	vbx_shared_free(vector_in2);
+	vbx_shared_free(vector_in1);
+	free(scalar_out);
+	free(scalar_in2);
+	free(scalar_in1);
+
+	return errors;
+}
+
 ///////////////////////////////////////////////////////////////////////////
 int main(void)
 {
@@ -348,6 +450,7 @@ int main(void)
 	free(scalar_in2);
 	free(scalar_in1);
 
+	errors += rect_test( 300, 100, 75 );
 	errors += orig_test();
 
 	VBX_TEST_END(errors);
@@ -151,6 +151,8 @@ int main(void)
 	int error_rc;
 
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	double scalar_time,vbx_time;
 
 	int total_errors = 0;
@@ -175,28 +177,39 @@ int main(void)
 
 	printf( "\nExecuting Scalar Motion Estimation Test...\n" );
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	vbw_mtx_motest_scalar_byte(scalar_result, scalar_x_input, scalar_x_input);
-	time_stop = vbx_timestamp();
+	vbx_bench_begin(&bench, "Scalar");
+	for (run = 0; run < vbx_bench_runs(&bench); run++) {
+		time_start = vbx_timestamp();
+		vbw_mtx_motest_scalar_byte(scalar_result, scalar_x_input, scalar_x_input);
+		time_stop = vbx_timestamp();
+		vbx_bench_record(&bench, time_start, time_stop);
+	}
 
 	print_matrix_output( scalar_result, SEARCH_HEIGHT, SEARCH_WIDTH );
 
-	scalar_time = vbx_print_scalar_time(time_start, time_stop);
+	scalar_time = vbx_bench_end(&bench, 0.0, "", 0.0);
 
 #ifdef USE_2D
 	printf( "\nExecuting Vector Motion Estimation Test (2D)...\n" );
 
 	vbw_mtx_motest_byte_setup();
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	error_rc = vbw_mtx_motest_byte(vector_result, vector_x_input, vector_x_input);
-	time_stop = vbx_timestamp();
+	vbx_bench_begin(&bench, "Vector 2D");
+	for (run = 0; run < vbx_bench_runs(&bench); run++) {
+		time_start = vbx_timestamp();
+		error_rc = vbw_mtx_motest_byte(vector_result, vector_x_input, vector_x_input);
+		time_stop = vbx_timestamp();
+		vbx_bench_record(&bench, time_start, time_stop);
+		if (error_rc) {
+			break;
+		}
+	}
 
 	if( !error_rc ) {
 
 		print_matrix_output( vector_result, SEARCH_HEIGHT, SEARCH_WIDTH );
 
-		vbx_time = vbx_print_vector_time(time_start, time_stop, scalar_time);
+		vbx_time = vbx_bench_end(&bench, 0.0, "", scalar_time);
 
 		vbx_sync(); vbx_sp_pop();
 
@@ -215,15 +228,22 @@ int main(void)
 
 	vbw_mtx_motest_3d_byte_setup();
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	error_rc = vbw_mtx_motest_3d_byte(vector_result, vector_x_input, vector_x_input);
-	time_stop = vbx_timestamp();
+	vbx_bench_begin(&bench, "Vector 3D");
+	for (run = 0; run < vbx_bench_runs(&bench); run++) {
+		time_start = vbx_timestamp();
+		error_rc = vbw_mtx_motest_3d_byte(vector_result, vector_x_input, vector_x_input);
+		time_stop = vbx_timestamp();
+		vbx_bench_record(&bench, time_start, time_stop);
+		if (error_rc) {
+			break;
+		}
+	}
 
 	if( !error_rc ) {
 
 		print_matrix_output( vector_result, SEARCH_HEIGHT, SEARCH_WIDTH );
 
-		vbx_time = vbx_print_vector_time(time_start, time_stop, scalar_time);
+		vbx_time = vbx_bench_end(&bench, 0.0, "", scalar_time);
 
 		vbx_sync(); vbx_sp_pop();
 
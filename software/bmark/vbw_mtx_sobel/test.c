@@ -39,8 +39,6 @@
 #include "vbx_copyright.h"
 VBXCOPYRIGHT(test_rgb2luma)
 
-// This test currently requires at least 32KB of scratchpad memory.
-
 #include <stdio.h>
 #include "vbx.h"
 #include "vbx_test.h"
@@ -88,6 +86,8 @@ int main(void)
 	pixel *scalar_output;
 
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	double scalar_time, vbx_time;
 	int x, y;
 	int errors = 0;
@@ -115,26 +115,34 @@ int main(void)
 	scalar_rgb2luma(scalar_luma, scalar_input, IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_PITCH);
 #endif
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
+	vbx_bench_begin(&bench, "Scalar");
+	for (run = 0; run < vbx_bench_runs(&bench); run++) {
+		time_start = vbx_timestamp();
 #if !USE_LUMA
-	scalar_rgb2luma(scalar_luma, scalar_input, IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_PITCH);
+		scalar_rgb2luma(scalar_luma, scalar_input, IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_PITCH);
 #endif
-	scalar_sobel_argb32_3x3(scalar_output, scalar_luma, IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_PITCH, RENORM_AMOUNT);
-	time_stop = vbx_timestamp();
-	scalar_time = vbx_print_scalar_time(time_start, time_stop);
+		scalar_sobel_argb32_3x3(scalar_output, scalar_luma, IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_PITCH, RENORM_AMOUNT);
+		time_stop = vbx_timestamp();
+		vbx_bench_record(&bench, time_start, time_stop);
+	}
+	scalar_time = vbx_bench_end(&bench, 0.0, "", 0.0);
 
 #if USE_LUMA
 	vbw_rgb2luma8(vbx_luma, (unsigned *)input, IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_PITCH);
 #endif
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
+	vbx_bench_begin(&bench, "Vector");
+	for (run = 0; run < vbx_bench_runs(&bench); run++) {
+		time_start = vbx_timestamp();
 #if USE_LUMA
-	vbw_sobel_luma8_3x3((unsigned *)vbx_output, vbx_luma, IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_PITCH, RENORM_AMOUNT);
+		vbw_sobel_luma8_3x3((unsigned *)vbx_output, vbx_luma, IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_PITCH, RENORM_AMOUNT);
 #else
-	vbw_sobel_argb32_3x3((unsigned *)vbx_output, (unsigned *)input, IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_PITCH, RENORM_AMOUNT);
+		vbw_sobel_argb32_3x3((unsigned *)vbx_output, (unsigned *)input, IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_PITCH, RENORM_AMOUNT);
 #endif
-	time_stop = vbx_timestamp();
-	vbx_time = vbx_print_vector_time(time_start, time_stop, scalar_time);
+		time_stop = vbx_timestamp();
+		vbx_bench_record(&bench, time_start, time_stop);
+	}
+	vbx_time = vbx_bench_end(&bench, 0.0, "", scalar_time);
 
 	for (y = 0; y < IMAGE_HEIGHT; y++) {
 		for (x = 0; x < IMAGE_WIDTH; x++) {
@@ -61,77 +61,117 @@ VBXCOPYRIGHT( test_mtx_xp )
 #define USE_XP_EXT 1
 #define USE_XP_SQUARE_EXT 1
 
-double test_vector_xp_square( vbx_sp_t *v_out, vbx_sp_t *v_in, int TEST_SIZE, double scalar_time )
+double test_vector_xp_square( vbx_sp_t *v_out, vbx_sp_t *v_in, vbx_mm_t *in, int TEST_SIZE, double scalar_time )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting MXP matrix transpose square...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(vbw_mtx_xp_square)( v_out, v_in, TEST_SIZE );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector transpose square" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		// the transpose overwrites v_in; reload it for the next run
+		if( run ) {
+			vbx_dma_to_vector( v_in, in, TEST_SIZE*TEST_SIZE*sizeof(vbx_sp_t) );
+			vbx_sync();
+		}
+		time_start = vbx_timestamp();
+		VBX_T(vbw_mtx_xp_square)( v_out, v_in, TEST_SIZE );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_vector_time( time_start, time_stop, scalar_time );
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
-double test_vector_xp( vbx_sp_t *v_out, vbx_sp_t *v_in, int TEST_ROW, int TEST_COL, double scalar_time )
+double test_vector_xp( vbx_sp_t *v_out, vbx_sp_t *v_in, vbx_mm_t *in, int TEST_ROW, int TEST_COL, double scalar_time )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting MXP matrix transpose...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(vbw_mtx_xp)( v_out, v_in, TEST_ROW, TEST_COL );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector transpose" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		// the transpose overwrites v_in; reload it for the next run
+		if( run ) {
+			vbx_dma_to_vector( v_in, in, TEST_ROW*TEST_COL*sizeof(vbx_sp_t) );
+			vbx_sync();
+		}
+		time_start = vbx_timestamp();
+		VBX_T(vbw_mtx_xp)( v_out, v_in, TEST_ROW, TEST_COL );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf("...done\n");
-	return vbx_print_vector_time( time_start, time_stop, scalar_time );
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
 double test_vector_xp_ext( vbx_mm_t *out, vbx_mm_t *in, int TEST_ROW, int TEST_COL, double scalar_time )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 
 	printf( "\nExecuting MXP matrix transpose - external memory...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(vbw_mtx_xp_MN_ext)( out, in, TEST_ROW, TEST_COL );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector transpose ext" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(vbw_mtx_xp_MN_ext)( out, in, TEST_ROW, TEST_COL );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_vector_time( time_start, time_stop, scalar_time );
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
 double test_vector_xp_square_ext( vbx_mm_t *out, vbx_mm_t *in, int TEST_SIZE, double scalar_time )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting MXP matrix transpose square - external memory...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(vbw_mtx_xp_NN_ext)( out, in, TEST_SIZE );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector transpose square ext" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(vbw_mtx_xp_NN_ext)( out, in, TEST_SIZE );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
 
-	return vbx_print_vector_time( time_start, time_stop, scalar_time );
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
 
 double test_scalar( vbx_mm_t *scalar_out, vbx_mm_t *scalar_in, int TEST_ROW, int TEST_COL )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting scalar xp...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(scalar_mtx_xp_MN)( scalar_out, scalar_in, TEST_ROW, TEST_COL );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Scalar" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(scalar_mtx_xp_MN)( scalar_out, scalar_in, TEST_ROW, TEST_COL );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_scalar_time( time_start, time_stop );
+	return vbx_bench_end( &bench, 0.0, "", 0.0 );
 }
 
 int main(void)
@@ -180,7 +220,7 @@ int main(void)
 
 #if USE_XP
 	vbx_dma_to_vector( v_in, vector_in, M*N*sizeof(vbx_sp_t) );
-	vector_time = test_vector_xp( v_out, v_in, M, N, scalar_time );
+	vector_time = test_vector_xp( v_out, v_in, vector_in, M, N, scalar_time );
 	vbx_dma_to_host( vector_out, v_out, M*N*sizeof(vbx_sp_t) );
 	vbx_sync();
 	VBX_T(test_print_matrix)( vector_out, PRINT_COLS, PRINT_ROWS, M );
@@ -189,7 +229,7 @@ int main(void)
 #endif
 #if TEST_ROWS == TEST_COLS && USE_XP_SQUARE
 	vbx_dma_to_vector( v_in, vector_in, M*N*sizeof(vbx_sp_t) );
-	vector_time = test_vector_xp_square( v_out, v_in, M, scalar_time );
+	vector_time = test_vector_xp_square( v_out, v_in, vector_in, M, scalar_time );
 	vbx_dma_to_host( vector_out, v_out, M*N*sizeof(vbx_sp_t) );
 	vbx_sync();
 	VBX_T(test_print_matrix)( vector_out, PRINT_COLS, PRINT_ROWS, M );
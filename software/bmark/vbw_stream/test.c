@@ -0,0 +1,452 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+
+#include "vbx_copyright.h"
+VBXCOPYRIGHT( test_stream )
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "vbx.h"
+#include "vbx_common.h"
+#include "vbx_test.h"
+#include "vbw_stream.h"
+#include "pixel.h"
+#include "vbw_mtx_sobel.h"
+#include "scalar_mtx_sobel.h"
+
+#define N      20000
+#define WIDTH  100
+#define PITCH  128
+#define HEIGHT 200
+
+// A wide image that only fits the scratchpad in strips
+#define WIDE_WIDTH  1000
+#define WIDE_PITCH  1024
+#define WIDE_HEIGHT 24
+#define WIDE_FREE   6000
+
+// out = a + b, 1D words
+static void add_chunk( const vbw_stream_chunk_t *c, void *arg )
+{
+	vbx_set_vl( c->rows*c->row_len );
+	vbx( VVW, VADD, (vbx_word_t *)c->v_out[0], (vbx_word_t *)c->v_in[0], (vbx_word_t *)c->v_in[1] );
+}
+
+// out = in*3 + 1 (bytes), and out2 = in (halfwords)
+static void scale_chunk( const vbw_stream_chunk_t *c, void *arg )
+{
+	vbx_set_vl( c->rows*c->row_len );
+	vbx( SVBU, VMUL, (vbx_ubyte_t *)c->v_out[0], 3, (vbx_ubyte_t *)c->v_in[0] );
+	vbx( SVBU, VADD, (vbx_ubyte_t *)c->v_out[0], 1, (vbx_ubyte_t *)c->v_out[0] );
+	vbx( VVBHU, VMOV, (vbx_uhalf_t *)c->v_out[1], (vbx_ubyte_t *)c->v_in[0], 0 );
+}
+
+// out = row above + row + row below, summed in the halfword temp
+static void vsum_chunk( const vbw_stream_chunk_t *c, void *arg )
+{
+	vbx_uhalf_t *v_in  = (vbx_uhalf_t *)c->v_in[0];
+	vbx_uhalf_t *v_sum = (vbx_uhalf_t *)c->v_temp;
+
+	vbx_set_vl( c->rows*c->row_len );
+	vbx( VVHU, VADD, v_sum, v_in - c->row_len, v_in );
+	vbx( VVHU, VADD, (vbx_uhalf_t *)c->v_out[0], v_sum, v_in + c->row_len );
+}
+
+// out = pixel up 1 and left 2 + pixel + pixel down 2 and right 1
+static void stencil_chunk( const vbw_stream_chunk_t *c, void *arg )
+{
+	const int    p    = c->in_pitch[0];
+	vbx_uhalf_t *v_in = (vbx_uhalf_t *)c->v_in[0];
+
+	vbx_set_vl( c->row_len );
+	vbx_set_2D( c->rows, c->row_len*sizeof(vbx_uhalf_t), p*sizeof(vbx_uhalf_t), p*sizeof(vbx_uhalf_t) );
+	vbx_2D( VVHU, VADD, (vbx_uhalf_t *)c->v_out[0], v_in - p - 2, v_in );
+	vbx_set_2D( c->rows, c->row_len*sizeof(vbx_uhalf_t), c->row_len*sizeof(vbx_uhalf_t), p*sizeof(vbx_uhalf_t) );
+	vbx_2D( VVHU, VADD, (vbx_uhalf_t *)c->v_out[0], (vbx_uhalf_t *)c->v_out[0], v_in + 2*p + 1 );
+}
+
+static int check_words( const char *name, int32_t *out, int32_t *a, int32_t *b, int n )
+{
+	int i, errors = 0;
+	for( i = 0; i < n; i++ ) {
+		if( out[i] != a[i] + b[i] ) {
+			if( errors++ < 5 )
+				printf( "%s: element %d is %d, expected %d\n", name, i, (int)out[i], (int)(a[i] + b[i]) );
+		}
+	}
+	return errors;
+}
+
+// 1D streams, as rows of one element
+int test_1d( int32_t *a, int32_t *b, int32_t *out )
+{
+	int i, errors;
+	vbw_stream_t in[2]  = { { a, sizeof(int32_t), 1, 0, 0 }, { b, sizeof(int32_t), 1, 0, 0 } };
+	vbw_stream_t res[1] = { { out, sizeof(int32_t), 1, 0, 0 } };
+
+	for( i = 0; i < N; i++ ) {
+		a[i] = i*7 - 1000;
+		b[i] = i*i;
+		out[i] = 0;
+	}
+	if( vbw_stream( in, 2, res, 1, N, 1, 0, add_chunk, NULL ) ) {
+		printf( "1d: out of scratchpad memory\n" );
+		return 1;
+	}
+	errors = check_words( "1d", out, a, b, N );
+	return errors;
+}
+
+// Rows with a pitch wider than the row, two outputs of different widths
+int test_pitch( uint8_t *img, uint8_t *out, uint16_t *out2 )
+{
+	int x, y, errors = 0;
+	vbw_stream_t in[1]  = { { img, sizeof(uint8_t), PITCH, 0, 0 } };
+	vbw_stream_t res[2] = { { out, sizeof(uint8_t), PITCH, 0, 0 }, { out2, sizeof(uint16_t), WIDTH, 0, 0 } };
+
+	for( y = 0; y < HEIGHT; y++ ) {
+		for( x = 0; x < PITCH; x++ ) {
+			img[y*PITCH+x] = y*13 + x;
+			out[y*PITCH+x] = 0xAA;
+		}
+	}
+	if( vbw_stream( in, 1, res, 2, HEIGHT, WIDTH, 0, scale_chunk, NULL ) ) {
+		printf( "pitch: out of scratchpad memory\n" );
+		return 1;
+	}
+	for( y = 0; y < HEIGHT; y++ ) {
+		for( x = 0; x < PITCH; x++ ) {
+			uint8_t expect = x < WIDTH ? (uint8_t)(img[y*PITCH+x]*3 + 1) : 0xAA;
+			if( out[y*PITCH+x] != expect || (x < WIDTH && out2[y*WIDTH+x] != img[y*PITCH+x]) ) {
+				if( errors++ < 5 )
+					printf( "pitch: pixel %d,%d is %d/%d, expected %d/%d\n", x, y,
+					        out[y*PITCH+x], x < WIDTH ? out2[y*WIDTH+x] : 0, expect, img[y*PITCH+x] );
+			}
+		}
+	}
+	return errors;
+}
+
+// An input with one halo row before and after each chunk
+int test_halo( uint16_t *img, uint16_t *out )
+{
+	int x, y, errors = 0;
+	// the first output row is image row 1, the last is image row HEIGHT-2
+	vbw_stream_t in[1]  = { { img + WIDTH, sizeof(uint16_t), WIDTH, 1, 1 } };
+	vbw_stream_t res[1] = { { out, sizeof(uint16_t), WIDTH, 0, 0 } };
+
+	for( y = 0; y < HEIGHT; y++ ) {
+		for( x = 0; x < WIDTH; x++ ) {
+			img[y*WIDTH+x] = y*WIDTH + x;
+		}
+	}
+	if( vbw_stream( in, 1, res, 1, HEIGHT-2, WIDTH, sizeof(uint16_t)*WIDTH, vsum_chunk, NULL ) ) {
+		printf( "halo: out of scratchpad memory\n" );
+		return 1;
+	}
+	for( y = 1; y < HEIGHT-1; y++ ) {
+		for( x = 0; x < WIDTH; x++ ) {
+			uint16_t expect = img[(y-1)*WIDTH+x] + img[y*WIDTH+x] + img[(y+1)*WIDTH+x];
+			if( out[(y-1)*WIDTH+x] != expect ) {
+				if( errors++ < 5 )
+					printf( "halo: pixel %d,%d is %d, expected %d\n", x, y, out[(y-1)*WIDTH+x], expect );
+			}
+		}
+	}
+	return errors;
+}
+
+// An asymmetric stencil over strips of a wide image
+int test_tiled( uint16_t *img, uint16_t *out )
+{
+	int x, y, width, depth, rows, errors = 0;
+	// outputs for rows 1 to WIDE_HEIGHT-3 and columns 2 to WIDE_WIDTH-2
+	const int out_rows = WIDE_HEIGHT-3, out_cols = WIDE_WIDTH-3;
+	vbw_stream_t in[1]  = { { img + WIDE_PITCH + 2, sizeof(uint16_t), WIDE_PITCH, 1, 2, 2, 1 } };
+	vbw_stream_t res[1] = { { out, sizeof(uint16_t), out_cols, 0, 0 } };
+
+	for( y = 0; y < WIDE_HEIGHT; y++ ) {
+		for( x = 0; x < WIDE_PITCH; x++ ) {
+			img[y*WIDE_PITCH+x] = y*7 + x*3;
+		}
+	}
+	vbx_sp_push();
+	vbx_sp_malloc( vbx_sp_getfree() - WIDE_FREE );
+	rows = vbw_stream_tiled_plan( in, 1, res, 1, out_rows, out_cols, 0, &width, &depth );
+	printf( "tiled: %d columns per strip, %d rows per chunk, depth %d\n", width, rows, depth );
+	if( width >= out_cols ) {
+		printf( "tiled: the image was not split into strips\n" );
+		errors++;
+	}
+	if( vbw_stream_tiled( in, 1, res, 1, out_rows, out_cols, 0, stencil_chunk, NULL ) ) {
+		printf( "tiled: out of scratchpad memory\n" );
+		errors++;
+	}
+	vbx_sp_pop();
+
+	for( y = 0; y < out_rows && errors < 5; y++ ) {
+		for( x = 0; x < out_cols; x++ ) {
+			const uint16_t *p = img + (y+1)*WIDE_PITCH + x+2;
+			uint16_t expect = p[-WIDE_PITCH-2] + p[0] + p[2*WIDE_PITCH+1];
+			if( out[y*out_cols+x] != expect ) {
+				if( errors++ < 5 )
+					printf( "tiled: pixel %d,%d is %d, expected %d\n", x, y, out[y*out_cols+x], expect );
+			}
+		}
+	}
+	return errors;
+}
+
+// Sobel edges of an image too wide for one row of each buffer
+int test_sobel( uint8_t *img, uint32_t *out )
+{
+	int x, y, errors = 0;
+	uint16_t *luma  = (uint16_t *)malloc( WIDE_PITCH*WIDE_HEIGHT*sizeof(uint16_t) );
+	pixel    *edges = (pixel *)malloc( WIDE_PITCH*WIDE_HEIGHT*sizeof(pixel) );
+
+	for( y = 0; y < WIDE_HEIGHT; y++ ) {
+		for( x = 0; x < WIDE_PITCH; x++ ) {
+			img[y*WIDE_PITCH+x]  = (x*x + y*37) & 0xFF;
+			luma[y*WIDE_PITCH+x] = img[y*WIDE_PITCH+x];
+			out[y*WIDE_PITCH+x]  = 0xDEADBEEF;
+		}
+	}
+	vbx_sp_push();
+	vbx_sp_malloc( vbx_sp_getfree() - WIDE_FREE );
+	if( vbw_sobel_luma8_3x3( out, img, WIDE_WIDTH, WIDE_HEIGHT, WIDE_PITCH, 2 ) ) {
+		errors++;
+	}
+	vbx_sp_pop();
+	scalar_sobel_argb32_3x3( edges, luma, WIDE_WIDTH, WIDE_HEIGHT, WIDE_PITCH, 2 );
+
+	for( y = 0; y < WIDE_HEIGHT; y++ ) {
+		for( x = 0; x < WIDE_PITCH; x++ ) {
+			const pixel *e = &edges[y*WIDE_PITCH+x];
+			uint32_t expect = x < WIDE_WIDTH ? (uint32_t)e->r << 16 | (uint32_t)e->g << 8 | e->b : 0xDEADBEEF;
+			if( (x < WIDE_WIDTH ? out[y*WIDE_PITCH+x] & 0xFFFFFF : out[y*WIDE_PITCH+x]) != expect ) {
+				if( errors++ < 5 )
+					printf( "sobel: pixel %d,%d is %08x, expected %08x\n", x, y, (unsigned)out[y*WIDE_PITCH+x], (unsigned)expect );
+			}
+		}
+	}
+	free( luma );
+	free( edges );
+	return errors;
+}
+
+// Sobel edges of an aRGB image written over the image itself
+int test_sobel_in_place( uint32_t *img )
+{
+	int x, y, errors = 0;
+	uint16_t *luma  = (uint16_t *)malloc( WIDE_PITCH*WIDE_HEIGHT*sizeof(uint16_t) );
+	pixel    *rgb   = (pixel *)malloc( WIDE_PITCH*WIDE_HEIGHT*sizeof(pixel) );
+	pixel    *edges = (pixel *)malloc( WIDE_PITCH*WIDE_HEIGHT*sizeof(pixel) );
+
+	for( y = 0; y < WIDE_HEIGHT; y++ ) {
+		for( x = 0; x < WIDE_PITCH; x++ ) {
+			img[y*WIDE_PITCH+x] = (x*x*3 + y*101) * 0x10203;
+			rgb[y*WIDE_PITCH+x] = *(pixel *)&img[y*WIDE_PITCH+x];
+		}
+	}
+	scalar_rgb2luma( luma, rgb, WIDE_WIDTH, WIDE_HEIGHT, WIDE_PITCH );
+	scalar_sobel_argb32_3x3( edges, luma, WIDE_WIDTH, WIDE_HEIGHT, WIDE_PITCH, 2 );
+	if( vbw_sobel_argb32_3x3( img, img, WIDE_WIDTH, WIDE_HEIGHT, WIDE_PITCH, 2 ) ) {
+		errors++;
+	}
+
+	for( y = 0; y < WIDE_HEIGHT; y++ ) {
+		for( x = 0; x < WIDE_WIDTH; x++ ) {
+			const pixel *e = &edges[y*WIDE_PITCH+x];
+			uint32_t expect = (uint32_t)e->r << 16 | (uint32_t)e->g << 8 | e->b;
+			if( (img[y*WIDE_PITCH+x] & 0xFFFFFF) != expect ) {
+				if( errors++ < 5 )
+					printf( "in place: pixel %d,%d is %08x, expected %08x\n", x, y, (unsigned)img[y*WIDE_PITCH+x], (unsigned)expect );
+			}
+		}
+	}
+	free( luma );
+	free( rgb );
+	free( edges );
+	return errors;
+}
+
+// Shrink the free scratchpad until the plan falls back to double buffering
+// and then to a single buffer; each depth must give the same results
+int test_depths( int32_t *a, int32_t *b, int32_t *out )
+{
+	int depth, last = 0, rows, errors = 0, i;
+	int free_bytes = vbx_sp_getfree();
+	vbw_stream_t in[2]  = { { a, sizeof(int32_t), 1, 0, 0 }, { b, sizeof(int32_t), 1, 0, 0 } };
+	vbw_stream_t res[1] = { { out, sizeof(int32_t), 1, 0, 0 } };
+
+	while( free_bytes > 0 ) {
+		vbx_sp_push();
+		if( vbx_sp_getfree() > free_bytes ) {
+			vbx_sp_malloc( vbx_sp_getfree() - free_bytes );
+		}
+		rows = vbw_stream_plan( in, 2, res, 1, N, 1, 0, &depth );
+		if( !rows ) {
+			vbx_sp_pop();
+			break;
+		}
+		if( depth != last ) {
+			for( i = 0; i < N; i++ ) {
+				out[i] = 0;
+			}
+			if( vbw_stream( in, 2, res, 1, N, 1, 0, add_chunk, NULL ) ) {
+				printf( "depths: depth %d out of scratchpad memory\n", depth );
+				errors++;
+			} else {
+				errors += check_words( "depths", out, a, b, N );
+			}
+			printf( "%d free bytes: depth %d, %d rows per chunk\n", free_bytes, depth, rows );
+			last = depth;
+		}
+		vbx_sp_pop();
+		free_bytes = free_bytes*3/4;
+	}
+	if( last != 1 ) {
+		printf( "depths: never fell back to a single buffer\n" );
+		errors++;
+	}
+	return errors;
+}
+
+// The double buffered kernel against the same work done one chunk at a time
+int bench( int32_t *a, int32_t *b, int32_t *out )
+{
+	int depth, rows, row, n, run, errors = 0;
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	double vbx_time_serial;
+	vbw_stream_t in[2]  = { { a, sizeof(int32_t), 1, 0, 0 }, { b, sizeof(int32_t), 1, 0, 0 } };
+	vbw_stream_t res[1] = { { out, sizeof(int32_t), 1, 0, 0 } };
+	vbx_word_t *v_a, *v_b;
+
+	vbx_sp_push();
+	// leave room for a fraction of the data, so it takes several chunks
+	if( vbx_sp_getfree() > N*sizeof(int32_t) ) {
+		vbx_sp_malloc( vbx_sp_getfree() - N*sizeof(int32_t) );
+	}
+	rows = vbw_stream_plan( in, 2, res, 1, N, 1, 0, &depth );
+	printf( "\nStreaming %d elements, %d per chunk, depth %d\n", N, rows, depth );
+
+	// the same chunks, with the DMA waited for before each compute
+	printf( "\nOne chunk at a time:\n" );
+	vbx_sp_push();
+	v_a = (vbx_word_t *)vbx_sp_malloc( rows*sizeof(vbx_word_t) );
+	v_b = (vbx_word_t *)vbx_sp_malloc( rows*sizeof(vbx_word_t) );
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "One chunk at a time" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		for( row = 0; row < N; row += rows ) {
+			n = N-row < rows ? N-row : rows;
+			vbx_dma_to_vector( v_a, a+row, n*sizeof(int32_t) );
+			vbx_dma_to_vector( v_b, b+row, n*sizeof(int32_t) );
+			vbx_set_vl( n );
+			vbx( VVW, VADD, v_a, v_a, v_b );
+			vbx_dma_to_host( out+row, v_a, n*sizeof(int32_t) );
+			vbx_sync();
+		}
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	vbx_time_serial = vbx_bench_end( &bench, 0.0, "", 0.0 );
+	vbx_sp_pop();
+	errors += check_words( "bench one chunk at a time", out, a, b, N );
+
+	printf( "\nStreamed:\n" );
+	vbx_bench_begin( &bench, "Streamed" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		vbw_stream( in, 2, res, 1, N, 1, 0, add_chunk, NULL );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	vbx_bench_end( &bench, 0.0, "", vbx_time_serial );
+
+	vbx_sp_pop();
+	return errors + check_words( "bench", out, a, b, N );
+}
+
+int main(void)
+{
+	int errors = 0;
+	int32_t  *a, *b, *out;
+	uint8_t  *img8, *out8;
+	uint16_t *img16, *out16;
+	uint32_t *wide_out;
+
+	vbx_test_init();
+
+	a     = (int32_t *)vbx_shared_malloc( N*sizeof(int32_t) );
+	b     = (int32_t *)vbx_shared_malloc( N*sizeof(int32_t) );
+	out   = (int32_t *)vbx_shared_malloc( N*sizeof(int32_t) );
+	img8  = (uint8_t *)vbx_shared_malloc( HEIGHT*PITCH*sizeof(uint8_t) );
+	out8  = (uint8_t *)vbx_shared_malloc( HEIGHT*PITCH*sizeof(uint8_t) );
+	img16 = (uint16_t *)vbx_shared_malloc( HEIGHT*PITCH*sizeof(uint16_t) );
+	out16 = (uint16_t *)vbx_shared_malloc( HEIGHT*PITCH*sizeof(uint16_t) );
+	wide_out = (uint32_t *)vbx_shared_malloc( WIDE_PITCH*WIDE_HEIGHT*sizeof(uint32_t) );
+	if( !a || !b || !out || !img8 || !out8 || !img16 || !out16 || !wide_out ) {
+		VBX_PRINTF( "ERROR: out of memory.\n" );
+		VBX_EXIT(-1);
+	}
+
+	errors += test_1d( a, b, out );
+	errors += test_pitch( img8, out8, out16 );
+	errors += test_halo( img16, out16 );
+	errors += test_tiled( img16, out16 );
+	errors += test_sobel( img8, wide_out );
+	errors += test_sobel_in_place( wide_out );
+	errors += test_depths( a, b, out );
+	errors += bench( a, b, out );
+
+	vbx_shared_free( a );
+	vbx_shared_free( b );
+	vbx_shared_free( out );
+	vbx_shared_free( img8 );
+	vbx_shared_free( out8 );
+	vbx_shared_free( img16 );
+	vbx_shared_free( out16 );
+	vbx_shared_free( wide_out );
+
+	VBX_TEST_END(errors);
+	return 0;
+}
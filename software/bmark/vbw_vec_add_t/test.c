@@ -57,32 +57,44 @@ VBXCOPYRIGHT( test_vec_add )
 double test_vector( vbx_sp_t *v_out, vbx_sp_t *v_in1, vbx_sp_t *v_in2, int N, double scalar_time )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting MXP vector add...\n" );
 
 	vbx_set_vl(N);
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(vbw_vec_add)( v_out, v_in1, v_in2 );
-	vbx_sync();
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(vbw_vec_add)( v_out, v_in1, v_in2 );
+		vbx_sync();
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_vector_time(time_start, time_stop, scalar_time );
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
 
 double test_scalar( vbx_mm_t *scalar_out, vbx_mm_t *scalar_in1, vbx_mm_t *scalar_in2, int N )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting scalar add...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(scalar_vec_add)( scalar_out, scalar_in1, scalar_in2, N );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Scalar" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(scalar_vec_add)( scalar_out, scalar_in1, scalar_in2, N );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_scalar_time( time_start, time_stop );
+	return vbx_bench_end( &bench, 0.0, "", 0.0 );
 }
 
 int main(void)
@@ -61,30 +61,42 @@ VBXCOPYRIGHT( test_vec_copy )
 double test_vector( vbx_sp_t *v_out, vbx_sp_t *v_in, int N, double scalar_time )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting vector copy...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(vbw_vec_copy)( v_out, v_in, N, PIPELINE_DEPTH );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(vbw_vec_copy)( v_out, v_in, N, PIPELINE_DEPTH );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_vector_time(time_start, time_stop, scalar_time);
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
 
 double test_scalar( vbx_mm_t *scalar_out, vbx_mm_t *scalar_in, int N )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf( "\nExecuting scalar copy...\n" );
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(scalar_vec_copy)( scalar_out, scalar_in, N );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Scalar" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(scalar_vec_copy)( scalar_out, scalar_in, N );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf( "...done\n" );
-	return vbx_print_scalar_time( time_start, time_stop );
+	return vbx_bench_end( &bench, 0.0, "", 0.0 );
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -63,67 +63,241 @@ VBXCOPYRIGHT( test_vec_fir )
 #define USE_TRANSPOSE
 #define USE_1D
 #define USE_2D
+#define USE_ENGINE
 
 #define NTAPS     16
 #define SAMP_SIZE 0x1000
+#define CHANNELS  2
 
 
 double test_vector_transpose( vbx_mm_t *vector_out, vbx_mm_t *sample, vbx_mm_t *coeffs, double scalar_time )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf("\nExecuting MXP vector transpose FIR.... \n");
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(vbw_vec_fir_transpose)( vector_out, sample, coeffs, SAMP_SIZE, NTAPS );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector transpose" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(vbw_vec_fir_transpose)( vector_out, sample, coeffs, SAMP_SIZE, NTAPS );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf("...done\n");
-	return vbx_print_vector_time( time_start, time_stop, scalar_time );
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
 double test_vector_1d( vbx_mm_t *vector_out, vbx_mm_t *sample, vbx_mm_t *coeffs, double scalar_time )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf("\nExecuting MXP vector FIR with Accum.... \n");
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(vbw_vec_fir_1d)( vector_out, sample, coeffs, SAMP_SIZE, NTAPS );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector 1D" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(vbw_vec_fir_1d)( vector_out, sample, coeffs, SAMP_SIZE, NTAPS );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf("...done\n");
-	return vbx_print_vector_time( time_start, time_stop, scalar_time );
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
 
 double test_vector_2d( vbx_mm_t *vector_out, vbx_mm_t *sample, vbx_mm_t *coeffs, double scalar_time )
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf("\nExecuting MXP vector FIR with Accum 2D....\n");
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(vbw_vec_fir_2d)( vector_out, sample, coeffs, SAMP_SIZE, NTAPS );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Vector 2D" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(vbw_vec_fir_2d)( vector_out, sample, coeffs, SAMP_SIZE, NTAPS );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf("...done\n");
-	return vbx_print_vector_time( time_start, time_stop, scalar_time );
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
 }
 
+double test_vector_engine( vbx_mm_t *vector_out, vbx_mm_t *sample, vbx_mm_t *coeffs, double scalar_time )
+{
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
+	printf("\nExecuting MXP vector FIR, form chosen per chunk....\n");
+
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "Vector engine" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(vbw_vec_fir)( vector_out, sample, coeffs, SAMP_SIZE, NTAPS, 1 );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+
+	printf("...done\n");
+	return vbx_bench_end( &bench, 0.0, "", scalar_time );
+}
+
+// Interleaved channels, each against the scalar filter of that channel alone
+int test_channels( vbx_mm_t *sample, vbx_mm_t *coeffs, int sample_size )
+{
+	int c, i, errors = 0;
+	const int frames = sample_size+NTAPS-1;
+	vbx_mm_t *mono       = malloc( frames*sizeof(vbx_mm_t) );
+	vbx_mm_t *scalar_out = malloc( sample_size*sizeof(vbx_mm_t) );
+	vbx_mm_t *vector_in  = vbx_shared_malloc( frames*CHANNELS*sizeof(vbx_mm_t) );
+	vbx_mm_t *vector_out = vbx_shared_malloc( sample_size*CHANNELS*sizeof(vbx_mm_t) );
+
+	for( i = 0; i < frames*CHANNELS; i++ ) {
+		vector_in[i] = sample[i % (SAMP_SIZE+NTAPS)] + i/(SAMP_SIZE+NTAPS);
+	}
+	if( VBX_T(vbw_vec_fir)( vector_out, vector_in, coeffs, sample_size, NTAPS, CHANNELS ) ) {
+		errors++;
+	}
+	for( c = 0; c < CHANNELS; c++ ) {
+		for( i = 0; i < frames; i++ ) {
+			mono[i] = vector_in[i*CHANNELS+c];
+		}
+		VBX_T(scalar_vec_fir)( scalar_out, mono, coeffs, frames, NTAPS );
+		for( i = 0; i < sample_size; i++ ) {
+			if( vector_out[i*CHANNELS+c] != scalar_out[i] ) {
+				printf( "\nChannel %d of %d fails at sample %d of %d.\n", c, CHANNELS, i, sample_size );
+				errors++;
+				break;
+			}
+		}
+	}
+
+	free( mono );
+	free( scalar_out );
+	vbx_shared_free( vector_in );
+	vbx_shared_free( vector_out );
+	return errors;
+}
+
+// Sample counts so short that one accumulating row per output is cheaper
+int test_short( vbx_mm_t *scalar_out, vbx_mm_t *sample, vbx_mm_t *coeffs )
+{
+	int n, errors = 0;
+	vbx_mm_t *vector_out = vbx_shared_malloc( SAMP_SIZE*sizeof(vbx_mm_t) );
+
+	for( n = 1; n <= 64; n = n*2+1 ) {
+		if( VBX_T(vbw_vec_fir)( vector_out, sample, coeffs, n, NTAPS, 1 ) ) {
+			errors++;
+		}
+		errors += VBX_T(test_verify_array)( scalar_out, vector_out, n );
+	}
+	vbx_shared_free( vector_out );
+	return errors;
+}
+
+// The scratchpad entry points fit their chunks around the caller's
+// stack allocations and heap blocks, and leave the stack as it was
+int test_sp_room( vbx_mm_t *scalar_out, vbx_mm_t *sample, vbx_mm_t *coeffs )
+{
+	const int bytes = vbx_sp_getfree()/4;
+	int used, errors = 0;
+	vbx_mm_t *vector_out = vbx_shared_malloc( SAMP_SIZE*sizeof(vbx_mm_t) );
+	vbx_void_t *v_heap;
+	vbx_sp_t *v_coeffs;
+
+	vbx_sp_push();
+	vbx_sp_malloc( bytes );
+	v_heap = vbx_sp_heap_malloc( NULL, bytes );
+	v_coeffs = (vbx_sp_t *)vbx_sp_heap_malloc( NULL, NTAPS*sizeof(vbx_sp_t) );
+	vbx_dma_to_vector( v_coeffs, coeffs, NTAPS*sizeof(vbx_sp_t) );
+	used = vbx_sp_getused();
+
+	VBX_T(vbw_vec_fir_1d_sp)( vector_out, sample, v_coeffs, SAMP_SIZE, NTAPS );
+	errors += VBX_T(test_verify_array)( scalar_out, vector_out, SAMP_SIZE-NTAPS );
+	VBX_T(vbw_vec_fir_2d_sp)( vector_out, sample, v_coeffs, SAMP_SIZE, NTAPS );
+	errors += VBX_T(test_verify_array)( scalar_out, vector_out, SAMP_SIZE-NTAPS );
+	if( VBX_T(vbw_vec_fir_sp)( vector_out, sample, coeffs, v_coeffs, SAMP_SIZE, NTAPS, 1 ) ) {
+		errors++;
+	}
+	errors += VBX_T(test_verify_array)( scalar_out, vector_out, SAMP_SIZE-NTAPS );
+	if( vbx_sp_getused() != used ) {
+		printf( "\nThe scratchpad entry points changed the stack.\n" );
+		errors++;
+	}
+
+	vbx_sp_heap_free( v_coeffs );
+	vbx_sp_heap_free( v_heap );
+	vbx_sp_pop();
+	vbx_shared_free( vector_out );
+	return errors;
+}
+
+// Taps rewritten in place between calls: the plain filters reload them,
+// the scratchpad entry points see them once the cache entry is invalidated
+int test_changed_taps( vbx_mm_t *sample, vbx_mm_t *coeffs )
+{
+	int pass, errors = 0;
+	vbx_mm_t *scalar_out = malloc( SAMP_SIZE*sizeof(vbx_mm_t) );
+	vbx_mm_t *vector_out = vbx_shared_malloc( SAMP_SIZE*sizeof(vbx_mm_t) );
+	vbx_sp_t *v_coeffs;
+
+	for( pass = 0; pass < 2; pass++ ) {
+		coeffs[pass] += 1;
+		VBX_T(scalar_vec_fir)( scalar_out, sample, coeffs, SAMP_SIZE, NTAPS );
+
+		VBX_T(vbw_vec_fir_1d)( vector_out, sample, coeffs, SAMP_SIZE, NTAPS );
+		errors += VBX_T(test_verify_array)( scalar_out, vector_out, SAMP_SIZE-NTAPS );
+		VBX_T(vbw_vec_fir_2d)( vector_out, sample, coeffs, SAMP_SIZE, NTAPS );
+		errors += VBX_T(test_verify_array)( scalar_out, vector_out, SAMP_SIZE-NTAPS );
+		if( VBX_T(vbw_vec_fir)( vector_out, sample, coeffs, SAMP_SIZE, NTAPS, 1 ) ) {
+			errors++;
+		}
+		errors += VBX_T(test_verify_array)( scalar_out, vector_out, SAMP_SIZE-NTAPS );
+
+		vbx_sp_cache_invalidate( coeffs );
+		v_coeffs = (vbx_sp_t *)vbx_sp_cache_get( coeffs, NTAPS*sizeof(vbx_sp_t) );
+		VBX_T(vbw_vec_fir_2d_sp)( vector_out, sample, v_coeffs, SAMP_SIZE, NTAPS );
+		errors += VBX_T(test_verify_array)( scalar_out, vector_out, SAMP_SIZE-NTAPS );
+		if( VBX_T(vbw_vec_fir_sp)( vector_out, sample, coeffs, v_coeffs, SAMP_SIZE, NTAPS, 1 ) ) {
+			errors++;
+		}
+		errors += VBX_T(test_verify_array)( scalar_out, vector_out, SAMP_SIZE-NTAPS );
+		vbx_sp_cache_put( v_coeffs );
+	}
+
+	vbx_sp_cache_invalidate( coeffs );
+	free( scalar_out );
+	vbx_shared_free( vector_out );
+	return errors;
+}
 
 double test_scalar( vbx_mm_t *scalar_out, vbx_mm_t *scalar_sample, vbx_mm_t *scalar_coeffs)
 {
 	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
 	printf("\nExecuting scalar vector FIR...\n");
 
 	vbx_timestamp_start();
-	time_start = vbx_timestamp();
-	VBX_T(scalar_vec_fir)( scalar_out, scalar_sample, scalar_coeffs, SAMP_SIZE, NTAPS );
-	time_stop = vbx_timestamp();
+	vbx_bench_begin( &bench, "Scalar" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		VBX_T(scalar_vec_fir)( scalar_out, scalar_sample, scalar_coeffs, SAMP_SIZE, NTAPS );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
 
 	printf("...done\n");
-	return vbx_print_scalar_time( time_start, time_stop );
+	return vbx_bench_end( &bench, 0.0, "", 0.0 );
 }
 
 
@@ -183,6 +357,17 @@ int main(void)
 	errors += VBX_T(test_verify_array)( scalar_out, vector_out, SAMP_SIZE-NTAPS );
 	#endif //USE_2D
 
+	#ifdef USE_ENGINE
+	vector_time = test_vector_engine( vector_out, sample, coeffs, scalar_time );
+	VBX_T(test_print_array)( vector_out,  min(SAMP_SIZE,MAX_PRINT_LENGTH) );
+	errors += VBX_T(test_verify_array)( scalar_out, vector_out, SAMP_SIZE-NTAPS );
+	errors += test_short( scalar_out, sample, coeffs );
+	errors += test_channels( sample, coeffs, SAMP_SIZE/CHANNELS );
+	#endif //USE_ENGINE
+
+	errors += test_sp_room( scalar_out, sample, coeffs );
+	errors += test_changed_taps( sample, coeffs );
+
 	VBX_TEST_END(errors);
 	return 0;
 }
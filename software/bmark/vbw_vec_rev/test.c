@@ -182,6 +182,9 @@ int vbw_vec_reverse_test_word()
 	int NREPS = 1000;
 	int i,k;
 	vbx_timestamp_t start=0,finish=0;
+	vbx_bench_t bench;
+	char name[64];
+	int run;
 
 	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
 	const int VBX_SCRATCHPAD_SIZE = this_mxp->scratchpad_size;
@@ -204,15 +207,20 @@ int vbw_vec_reverse_test_word()
 #if 1
 		// measure performance of function call
 		vbx_sync();
-		start = vbx_timestamp();
-		for(k=0; k<NREPS; k++ ) {
-			vbx_sp_push();
-			vdst = vbw_vec_reverse_word( vsrc, N );
-			vbx_sync();
-			vbx_sp_pop();
+		sprintf( name, "Reverse word function N=%d", N );
+		vbx_bench_begin( &bench, name );
+		for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+			start = vbx_timestamp();
+			for(k=0; k<NREPS; k++ ) {
+				vbx_sp_push();
+				vdst = vbw_vec_reverse_word( vsrc, N );
+				vbx_sync();
+				vbx_sp_pop();
+			}
+			finish = vbx_timestamp();
+			vbx_bench_record( &bench, start, finish );
 		}
-		finish = vbx_timestamp();
-		printf( "length %d:\tf(),macro %llu ", N, (unsigned long long) vbx_mxp_cycles((finish-start)/NREPS) );
+		vbx_bench_end( &bench, NREPS, "call", 0.0 );
 		verify_vector_word( vsrc, vdst, N );
 #endif
 
@@ -223,16 +231,21 @@ int vbw_vec_reverse_test_word()
 		vbx_sp_push();
 //		vdst = (vbx_word_t *)vbx_sp_malloc( NBYTES );
 //		if( !vdst ) VBX_EXIT(-1);
-		start = vbx_timestamp();
-		for(k=0; k<NREPS; k++ ) {
-			vbx_sp_push();
-			vbw_vec_reverse_word_safe( vdst, vsrc, N );
-			vbx_sp_pop();
-			vbx_sync();
+		sprintf( name, "Reverse word macro N=%d", N );
+		vbx_bench_begin( &bench, name );
+		for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+			start = vbx_timestamp();
+			for(k=0; k<NREPS; k++ ) {
+				vbx_sp_push();
+				vbw_vec_reverse_word_safe( vdst, vsrc, N );
+				vbx_sp_pop();
+				vbx_sync();
+			}
+			finish = vbx_timestamp();
+			vbx_bench_record( &bench, start, finish );
 		}
-		finish = vbx_timestamp();
 		vbx_sp_pop();
-		printf( "%llu cycles\n", (unsigned long long) vbx_mxp_cycles((finish-start)/NREPS) );
+		vbx_bench_end( &bench, NREPS, "call", 0.0 );
 		verify_vector_word( vsrc, vdst, N );
 
 #if 0
@@ -265,7 +278,10 @@ int vbw_vec_reverse_test_half()
 	int NBYTES;
 	int NREPS = 1000;
 	int i,k;
-	int start=0,finish=0;
+	vbx_timestamp_t start=0,finish=0;
+	vbx_bench_t bench;
+	char name[64];
+	int run;
 
 	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
 	const int VBX_SCRATCHPAD_SIZE = this_mxp->scratchpad_size;
@@ -288,15 +304,20 @@ int vbw_vec_reverse_test_half()
 
 		// measure performance of function call
 		vbx_sync();
-		start = vbx_timestamp();
-		for(k=0; k<NREPS; k++ ) {
-			vbx_sp_push();
-			vdst = vbw_vec_reverse_half( vsrc, N );
-			vbx_sp_pop();
-			vbx_sync();
+		sprintf( name, "Reverse half function N=%d", N );
+		vbx_bench_begin( &bench, name );
+		for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+			start = vbx_timestamp();
+			for(k=0; k<NREPS; k++ ) {
+				vbx_sp_push();
+				vdst = vbw_vec_reverse_half( vsrc, N );
+				vbx_sp_pop();
+				vbx_sync();
+			}
+			finish = vbx_timestamp();
+			vbx_bench_record( &bench, start, finish );
 		}
-		finish = vbx_timestamp();
-		printf( "length %d:\tf(),macro %llu ", N, (unsigned long long) vbx_mxp_cycles((finish-start)/NREPS) );
+		vbx_bench_end( &bench, NREPS, "call", 0.0 );
 		verify_vector_half( vsrc, vdst, N );
 
 		vbx_set_vl( N );
@@ -306,17 +327,22 @@ int vbw_vec_reverse_test_half()
 		vbx_sp_push();
 		vdst = (vbx_half_t *)vbx_sp_malloc( NBYTES );
 		if( !vdst ) VBX_EXIT(-1);
-		start = vbx_timestamp();
-		for(k=0; k<NREPS; k++ ) {
-			vbx_sp_push();
-//FIXME using the wrong macro/function call here
-			vbw_vec_reverse_half_fast( vdst, vsrc, N );
-			vbx_sp_pop();
-			vbx_sync();
+		sprintf( name, "Reverse half macro N=%d", N );
+		vbx_bench_begin( &bench, name );
+		for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+			start = vbx_timestamp();
+			for(k=0; k<NREPS; k++ ) {
+				vbx_sp_push();
+	//FIXME using the wrong macro/function call here
+				vbw_vec_reverse_half_fast( vdst, vsrc, N );
+				vbx_sp_pop();
+				vbx_sync();
+			}
+			finish = vbx_timestamp();
+			vbx_bench_record( &bench, start, finish );
 		}
-		finish = vbx_timestamp();
 		vbx_sp_pop();
-		printf( "%llu cycles\n", (unsigned long long) vbx_mxp_cycles((finish-start)/NREPS) );
+		vbx_bench_end( &bench, NREPS, "call", 0.0 );
 		verify_vector_half( vsrc, vdst, N );
 
 #if 0
@@ -350,7 +376,10 @@ int vbw_vec_reverse_test_byte()
 	int NBYTES;
 	int NREPS = 1000;
 	int i,k;
-	int start=0,finish=0;
+	vbx_timestamp_t start=0,finish=0;
+	vbx_bench_t bench;
+	char name[64];
+	int run;
 
 	vbx_mxp_t *this_mxp = VBX_GET_THIS_MXP();
 	const int VBX_SCRATCHPAD_SIZE = this_mxp->scratchpad_size;
@@ -374,15 +403,20 @@ int vbw_vec_reverse_test_byte()
 
 		// measure performance of function call
 		vbx_sync();
-		start = vbx_timestamp();
-		for(k=0; k<NREPS; k++ ) {
-			vbx_sp_push();
-			vdst = (vbx_byte_t *)vbw_vec_reverse_byte( vsrc, N );
-			vbx_sync();
-			vbx_sp_pop();
+		sprintf( name, "Reverse byte function N=%d", N );
+		vbx_bench_begin( &bench, name );
+		for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+			start = vbx_timestamp();
+			for(k=0; k<NREPS; k++ ) {
+				vbx_sp_push();
+				vdst = (vbx_byte_t *)vbw_vec_reverse_byte( vsrc, N );
+				vbx_sync();
+				vbx_sp_pop();
+			}
+			finish = vbx_timestamp();
+			vbx_bench_record( &bench, start, finish );
 		}
-		finish = vbx_timestamp();
-		printf( "length %d:\tf(),macro %llu ", N, (unsigned long long) vbx_mxp_cycles((finish-start)/NREPS) );
+		vbx_bench_end( &bench, NREPS, "call", 0.0 );
 		verify_vector_byte( vsrc, vdst, N );
 
 		vbx_set_vl( N );
@@ -392,14 +426,19 @@ int vbw_vec_reverse_test_byte()
 		vbx_sp_push();
 		vdst = (vbx_byte_t *)vbx_sp_malloc( NBYTES );
 		if( !vdst ) VBX_EXIT(-1);
-		start = vbx_timestamp();
-		for(k=0; k<NREPS; k++ ) {
-			vbw_vec_reverse_byte_fast( vdst, vsrc, N );
-			vbx_sync();
+		sprintf( name, "Reverse byte macro N=%d", N );
+		vbx_bench_begin( &bench, name );
+		for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+			start = vbx_timestamp();
+			for(k=0; k<NREPS; k++ ) {
+				vbw_vec_reverse_byte_fast( vdst, vsrc, N );
+				vbx_sync();
+			}
+			finish = vbx_timestamp();
+			vbx_bench_record( &bench, start, finish );
 		}
-		finish = vbx_timestamp();
 		vbx_sp_pop();
-		printf( "%llu cycles\n", (unsigned long long) vbx_mxp_cycles((finish-start)/NREPS) );
+		vbx_bench_end( &bench, NREPS, "call", 0.0 );
 		verify_vector_byte( vsrc, vdst, N );
 
 #if 1
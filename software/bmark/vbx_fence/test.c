@@ -0,0 +1,256 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+
+#include "vbx_copyright.h"
+VBXCOPYRIGHT( test_fence )
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "vbx.h"
+#include "vbx_common.h"
+#include "vbx_test.h"
+
+#define N       4096
+#define FRAMES  8
+#define FENCES  1000
+#define MAX_POLLS 100000000
+
+// Host frame f, element i
+#define PIXEL(f,i) ((uint32_t)((f)*7919 + (i)*31))
+
+static void fill( uint32_t *buf, int frame, int n )
+{
+	int i;
+	for( i = 0; i < n; i++ )
+		buf[i] = PIXEL(frame,i);
+}
+
+// Queues out = in + frame; does not wait
+static void process( uint32_t *out, uint32_t *in, vbx_uword_t *v, int frame, int n )
+{
+	vbx_dma_to_vector( v, in, n*sizeof(uint32_t) );
+	vbx_set_vl( n );
+	vbx( SVWU, VADD, v, frame, v );
+	vbx_dma_to_host( out, v, n*sizeof(uint32_t) );
+}
+
+static int check( const char *name, uint32_t *out, int frame, int n )
+{
+	int i, errors = 0;
+	for( i = 0; i < n; i++ ) {
+		if( out[i] != PIXEL(frame,i) + frame ) {
+			if( errors++ < 5 )
+				printf( "%s: frame %d element %d is %08x, expected %08x\n",
+				        name, frame, i, (unsigned)out[i], (unsigned)(PIXEL(frame,i) + frame) );
+		}
+	}
+	return errors;
+}
+
+// Waiting on a fence makes the results of everything before it visible
+int test_wait( uint32_t *in, uint32_t *out, vbx_uword_t *v )
+{
+	int n, errors = 0;
+	vbx_fence_t fence;
+
+	for( n = 1; n <= N; n *= 4 ) {
+		fill( in, n, n );
+		process( out, in, v, n, n );
+		fence = vbx_fence();
+		vbx_fence_wait( fence );
+		if( !vbx_fence_done( fence ) ) {
+			printf( "wait: fence not done after waiting\n" );
+			errors++;
+		}
+		errors += check( "wait", out, n, n );
+	}
+	return errors;
+}
+
+// Polling a fence returns without blocking, and eventually reports it done
+int test_poll( uint32_t *in, uint32_t *out, vbx_uword_t *v )
+{
+	int polls = 0;
+	vbx_fence_t fence;
+
+	fill( in, 1, N );
+	process( out, in, v, 1, N );
+	fence = vbx_fence();
+	while( !vbx_fence_done( fence ) ) {
+		if( ++polls == MAX_POLLS ) {
+			printf( "poll: fence not done after %d polls\n", polls );
+			return 1;
+		}
+	}
+	return check( "poll", out, 1, N );
+}
+
+// Fences complete in order, however old they are
+int test_order( vbx_uword_t *v )
+{
+	int i, errors = 0;
+	vbx_fence_t first, middle = 0, last = 0;
+
+	first = vbx_fence();
+	for( i = 1; i < FENCES; i++ ) {
+		vbx_set_vl( N );
+		vbx( SVWU, VMOV, v, i, 0 );
+		last = vbx_fence();
+		if( i == FENCES/2 )
+			middle = last;
+	}
+	vbx_fence_wait( last );
+	if( !vbx_fence_done( first ) || !vbx_fence_done( middle ) || !vbx_fence_done( last ) ) {
+		printf( "order: an earlier fence is not done\n" );
+		errors++;
+	}
+	return errors;
+}
+
+// A fence still works when the scratchpad is full
+int test_full( uint32_t *in, uint32_t *out, vbx_uword_t *v )
+{
+	int errors;
+	vbx_fence_t fence;
+
+	vbx_sp_push();
+	vbx_sp_malloc( vbx_sp_getfree() );
+	fill( in, 2, N );
+	process( out, in, v, 2, N );
+	fence = vbx_fence();
+	vbx_fence_wait( fence );
+	errors = check( "full", out, 2, N );
+	vbx_sp_pop();
+	return errors;
+}
+
+// A fence with the stack full up to a resident cache entry leaves the entry intact
+int test_full_cache( uint32_t *in, uint32_t *out )
+{
+	int errors;
+	vbx_fence_t fence;
+	vbx_void_t *v_table, *v_hit;
+
+	fill( in, 3, N );
+	v_table = vbx_sp_cache_get( in, N*sizeof(uint32_t) );
+	if( !v_table ) {
+		printf( "full cache: no room for the cache entry\n" );
+		return 1;
+	}
+	vbx_sp_cache_put( v_table );
+
+	// fill the stack allocator without evicting the entry
+	vbx_sp_push();
+	vbx_sp_malloc( vbx_sp_getfree() - N*sizeof(uint32_t) );
+	fence = vbx_fence();
+	vbx_fence_wait( fence );
+	vbx_sp_pop();
+
+	v_hit = vbx_sp_cache_get( in, N*sizeof(uint32_t) );
+	errors = v_hit != v_table;
+	if( errors ) {
+		printf( "full cache: the cache entry was evicted\n" );
+	} else {
+		vbx_dma_to_host( out, v_hit, N*sizeof(uint32_t) );
+		vbx_sync();
+		errors = test_verify_array_word( (int32_t *)in, (int32_t *)out, N );
+	}
+	vbx_sp_cache_put( v_hit );
+	vbx_sp_cache_invalidate( in );
+	return errors;
+}
+
+// Frame pipeline: the host prepares frame f+1 while the MXP works on
+// frame f, waiting only for the frame whose host buffers it reuses
+int test_pipeline( uint32_t *in[2], uint32_t *out[2], vbx_uword_t *v[2] )
+{
+	int f, errors = 0;
+	vbx_fence_t fence[2] = { 0, 0 };
+
+	for( f = 0; f <= FRAMES; f++ ) {
+		const int b = f % 2;
+		vbx_fence_wait( fence[b] );
+		if( f >= 2 )
+			errors += check( "pipeline", out[b], f-2, N );
+		if( f == FRAMES )
+			break;
+		fill( in[b], f, N );
+		process( out[b], in[b], v[b], f, N );
+		fence[b] = vbx_fence();
+	}
+	vbx_fence_wait( fence[(f-1) % 2] );
+	errors += check( "pipeline", out[(f-1) % 2], f-1, N );
+	return errors;
+}
+
+int main(void)
+{
+	int errors = 0;
+	uint32_t *in[2], *out[2];
+	vbx_uword_t *v[2];
+
+	vbx_test_init();
+
+	in[0]  = (uint32_t *)vbx_shared_malloc( N*sizeof(uint32_t) );
+	in[1]  = (uint32_t *)vbx_shared_malloc( N*sizeof(uint32_t) );
+	out[0] = (uint32_t *)vbx_shared_malloc( N*sizeof(uint32_t) );
+	out[1] = (uint32_t *)vbx_shared_malloc( N*sizeof(uint32_t) );
+	v[0]   = (vbx_uword_t *)vbx_sp_malloc( N*sizeof(vbx_uword_t) );
+	v[1]   = (vbx_uword_t *)vbx_sp_malloc( N*sizeof(vbx_uword_t) );
+	if( !in[0] || !in[1] || !out[0] || !out[1] || !v[0] || !v[1] ) {
+		VBX_PRINTF( "ERROR: out of memory.\n" );
+		VBX_EXIT(-1);
+	}
+
+	errors += test_wait( in[0], out[0], v[0] );
+	errors += test_poll( in[0], out[0], v[0] );
+	errors += test_order( v[0] );
+	errors += test_full( in[0], out[0], v[0] );
+	errors += test_full_cache( in[1], out[1] );
+	errors += test_pipeline( in, out, v );
+
+	vbx_sp_free();
+	vbx_shared_free( in[0] );
+	vbx_shared_free( in[1] );
+	vbx_shared_free( out[0] );
+	vbx_shared_free( out[1] );
+
+	VBX_TEST_END(errors);
+	return 0;
+}
@@ -0,0 +1,164 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+
+#include "vbx_copyright.h"
+VBXCOPYRIGHT( test_hazard )
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// copy forward checks only, so the expected hazards are the only warnings
+#define VBX_RTC_COP_FWD
+
+#include "vbx.h"
+#include "vbx_common.h"
+#include "vbx_test.h"
+
+// Checks one instruction: a hazard must be reported if and only if expected
+static int expect( const char *name, int hazard )
+{
+	int failed = RUNTIME_CHECK_FAILED;
+	RUNTIME_CHECK_FAILED = 0;
+	vbx_sync();
+	printf( "%-40s %s\n", name, failed == hazard ? "ok" : "FAILED" );
+	return failed != hazard;
+}
+
+// 1D: n elements are several waves of the vector lanes
+int test_1D( vbx_word_t *v_a, vbx_word_t *v_b, int lanes, int n )
+{
+	int errors = 0;
+	vbx_byte_t *v_bytes = (vbx_byte_t *)v_a;
+
+	vbx_set_vl( n );
+	vbx( VVW, VADD, v_b, v_a, v_a );
+	errors += expect( "dest above sources", 0 );
+	vbx( VVW, VADD, v_a, v_a, v_b );
+	errors += expect( "in place", 0 );
+	vbx( SVW, VADD, v_a, 1, v_a );
+	errors += expect( "in place, scalar source", 0 );
+	vbx( VVW, VMOV, v_a, v_a+1, 0 );
+	errors += expect( "shift down", 0 );
+	vbx( VVW, VMOV, v_a+1, v_a, 0 );
+	errors += expect( "shift up", 1 );
+	vbx( VVWB, VMOV, v_bytes, v_a, 0 );
+	errors += expect( "narrow in place", 0 );
+	vbx( VVBW, VMOV, v_a, v_bytes, 0 );
+	errors += expect( "widen in place", 1 );
+
+	// within one wave, all sources are read before any result is written
+	vbx_set_vl( lanes-1 );
+	vbx( VVW, VMOV, v_a+1, v_a, 0 );
+	errors += expect( "shift up within a wave", 0 );
+	return errors;
+}
+
+// 2D: rows of n elements, one after another
+int test_2D( vbx_word_t *v_a, vbx_word_t *v_b, int n, int nrows )
+{
+	int errors = 0;
+	int row = n*sizeof(vbx_word_t);
+
+	vbx_set_vl( n );
+	vbx_set_2D( nrows, row, row, row );
+	vbx_2D( VVW, VADD, v_a, v_a, v_a );
+	errors += expect( "2D in place", 0 );
+	vbx_2D( VVW, VMOV, v_a, v_a+n, 0 );
+	errors += expect( "2D rows down", 0 );
+	vbx_2D( VVW, VMOV, v_a+n, v_a, 0 );
+	errors += expect( "2D rows up", 1 );
+
+	// summing rows into row 0 reads row 0 again after each row writes it
+	vbx_set_2D( nrows-1, 0, row, 0 );
+	vbx_2D( VVW, VADD, v_a, v_a+n, v_a );
+	errors += expect( "2D rows summed into row 0", 1 );
+	vbx_2D( VVW, VADD, v_a, v_a+n, v_b );
+	errors += expect( "2D rows written to row 0", 0 );
+	return errors;
+}
+
+// 3D: matrices of nrows rows, one after another
+int test_3D( vbx_word_t *v_a, int n, int nrows, int nmats )
+{
+	int errors = 0;
+	int row = n*sizeof(vbx_word_t);
+	int mat = nrows*row;
+
+	vbx_set_vl( n );
+	vbx_set_2D( nrows, row, row, row );
+	vbx_set_3D( nmats, mat, mat, mat );
+	vbx_3D( VVW, VADD, v_a, v_a, v_a );
+	errors += expect( "3D in place", 0 );
+	vbx_3D( VVW, VMOV, v_a, v_a+nrows*n, 0 );
+	errors += expect( "3D matrices down", 0 );
+	vbx_3D( VVW, VMOV, v_a+nrows*n, v_a, 0 );
+	errors += expect( "3D matrices up", 1 );
+
+	// reversing each matrix in place: row 0 is written before the last
+	// row reads it
+	vbx_set_2D( nrows, row, -row, row );
+	vbx_3D( VVW, VMOV, v_a, v_a+(nrows-1)*n, 0 );
+	errors += expect( "3D rows reversed in place", 1 );
+	return errors;
+}
+
+int main(void)
+{
+	int lanes, n, errors = 0;
+	vbx_word_t *v_a, *v_b;
+
+	vbx_test_init();
+
+	lanes = VBX_GET_THIS_MXP()->vector_lanes;
+	n = 4*lanes;
+	v_a = (vbx_word_t *)vbx_sp_malloc( 16*n*sizeof(vbx_word_t) );
+	v_b = (vbx_word_t *)vbx_sp_malloc( 16*n*sizeof(vbx_word_t) );
+	if( !v_a || !v_b ) {
+		VBX_PRINTF( "ERROR: out of memory.\n" );
+		VBX_EXIT(-1);
+	}
+
+	errors += test_1D( v_a, v_b, lanes, n );
+	errors += test_2D( v_a, v_b, n, 8 );
+	errors += test_3D( v_a, n, 4, 3 );
+
+	vbx_sp_free();
+
+	VBX_TEST_END(errors);
+	return 0;
+}
@@ -0,0 +1,66 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**@file*/
+
+// The per-row kernel of test.c, built with the configuration of the file
+// that includes this one. Define ROWS to its name first.
+
+#ifndef ROWS
+#error "Define ROWS before including rows.h"
+#endif
+
+// out = in + 1, one row at a time, with the per-row allocation, setup and
+// DMA of a row-by-row image kernel
+void ROWS( uint8_t *out, uint8_t *in, int width, int height )
+{
+	vbx_ubyte_t *v_in, *v_out;
+	int y;
+
+	vbx_set_vl( width );
+	for( y = 0; y < height; y++ ) {
+		vbx_sp_push();
+		v_in  = (vbx_ubyte_t *)vbx_sp_malloc( width*sizeof(vbx_ubyte_t) );
+		v_out = (vbx_ubyte_t *)vbx_sp_malloc( width*sizeof(vbx_ubyte_t) );
+		vbx_dma_to_vector( v_in, in + y*width, width*sizeof(vbx_ubyte_t) );
+		vbx_set_vl( width );
+		vbx( SVBU, VADD, v_out, 1, v_in );
+		vbx_dma_to_host( out + y*width, v_out, width*sizeof(vbx_ubyte_t) );
+		vbx_sp_pop();
+	}
+	vbx_sync();
+}
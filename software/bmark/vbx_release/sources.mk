@@ -0,0 +1 @@
+C_SRCS += test.c release.c
@@ -0,0 +1,130 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+
+#include "vbx_copyright.h"
+VBXCOPYRIGHT( test_release )
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vbx.h"
+#include "vbx_common.h"
+#include "vbx_test.h"
+
+#define WIDTH   64
+#define HEIGHT  4096
+
+#define ROWS rows_debug
+#include "rows.h"
+
+void rows_release( uint8_t *out, uint8_t *in, int width, int height );
+
+// The same per-row kernel, built with the default checks and in release.c
+// with -DVBX_RELEASE=1, gives the same result faster
+int test_rows( uint8_t *in, uint8_t *out_debug, uint8_t *out_release )
+{
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	double debug_time;
+	int run, i, errors = 0;
+
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "default rows" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		rows_debug( out_debug, in, WIDTH, HEIGHT );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	debug_time = vbx_bench_end( &bench, 0.0, (char *)"", 0.0 );
+
+	vbx_bench_begin( &bench, "release rows" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		rows_release( out_release, in, WIDTH, HEIGHT );
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	vbx_bench_end( &bench, 0.0, (char *)"", debug_time );
+
+	for( i = 0; i < WIDTH*HEIGHT; i++ ) {
+		if( out_debug[i] != (uint8_t)(in[i]+1) || out_release[i] != out_debug[i] ) {
+			printf( "rows: element %d is %d and %d, expected %d\n",
+			        i, out_debug[i], out_release[i], (uint8_t)(in[i]+1) );
+			errors++;
+			break;
+		}
+	}
+	if( vbx_sp_getused() ) {
+		printf( "rows: %d scratchpad bytes left allocated\n", vbx_sp_getused() );
+		errors++;
+	}
+	printf( "%-32s %s\n", "rows", errors ? "FAILED" : "ok" );
+	return errors;
+}
+
+int main(void)
+{
+	int i, errors = 0;
+	uint8_t *in, *out_debug, *out_release;
+
+	vbx_test_init();
+	vbx_mxp_print_params();
+	printf( "\nRelease build test...\n" );
+
+	in          = (uint8_t *)vbx_shared_malloc( WIDTH*HEIGHT );
+	out_debug   = (uint8_t *)vbx_shared_malloc( WIDTH*HEIGHT );
+	out_release = (uint8_t *)vbx_shared_malloc( WIDTH*HEIGHT );
+	if( !in || !out_debug || !out_release ) {
+		VBX_PRINTF( "ERROR: out of memory.\n" );
+		VBX_EXIT(-1);
+	}
+	for( i = 0; i < WIDTH*HEIGHT; i++ ) {
+		in[i] = (uint8_t)(i*13);
+	}
+
+	errors += test_rows( in, out_debug, out_release );
+
+	vbx_shared_free( in );
+	vbx_shared_free( out_debug );
+	vbx_shared_free( out_release );
+
+	VBX_TEST_END(errors);
+	return 0;
+}
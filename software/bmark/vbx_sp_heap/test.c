@@ -0,0 +1,313 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+
+#include "vbx_copyright.h"
+VBXCOPYRIGHT( test_sp_heap )
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "vbx.h"
+#include "vbx_common.h"
+#include "vbx_test.h"
+
+#define N       1024 // words per frame
+#define TAPS    4096 // words of coefficients
+#define FRAMES  16
+
+static int check_value( const char *name, int value, int expected )
+{
+	if( value != expected )
+		printf( "%s: got %d, expected %d\n", name, value, expected );
+	return value != expected;
+}
+
+// Blocks are aligned as their pool asks, come out of the stack allocator's
+// free space, and go back to it when freed, in any order
+int test_alloc()
+{
+	int errors = 0;
+	int free0 = vbx_sp_getfree();
+	vbx_sp_heap_stats_t stats;
+	vbx_sp_pool_t *coef = vbx_sp_pool( "coef", 0 );
+	vbx_sp_pool_t *lut  = vbx_sp_pool( "lut", 1024 );
+	vbx_void_t *a, *b, *c, *d;
+
+	errors += check_value( "pool lookup", vbx_sp_pool( "coef", 0 ) == coef, 1 );
+	a = vbx_sp_heap_malloc( coef, 1000 );
+	b = vbx_sp_heap_malloc( lut, 3000 );
+	c = vbx_sp_heap_malloc( coef, 500 );
+	if( !a || !b || !c ) {
+		printf( "alloc: heap allocation failed\n" );
+		return 1;
+	}
+	errors += check_value( "lut alignment", (int)((uintptr_t)b % 1024), 0 );
+	vbx_sp_heap_stats( &stats );
+	errors += check_value( "stack free space", vbx_sp_getfree(), free0 - stats.size );
+	errors += check_value( "blocks", stats.blocks, 3 );
+	errors += check_value( "coef blocks", coef->blocks, 2 );
+
+	// a hole in the middle, filled by a smaller block
+	vbx_sp_heap_free( b );
+	vbx_sp_heap_stats( &stats );
+	errors += check_value( "holes after free", stats.holes, 1 );
+	errors += check_value( "lut used", lut->used, 0 );
+	d = vbx_sp_heap_malloc( coef, 2000 );
+	errors += check_value( "best fit", (char *)d >= (char *)b && (char *)d < (char *)b + 3000, 1 );
+	errors += check_value( "heap did not grow", vbx_sp_getfree(), free0 - stats.size );
+
+	// out of order frees give everything back
+	vbx_sp_heap_free( a );
+	vbx_sp_heap_free( d );
+	vbx_sp_heap_free( c );
+	vbx_sp_heap_stats( &stats );
+	errors += check_value( "heap size after free", stats.size, 0 );
+	errors += check_value( "stack free space after free", vbx_sp_getfree(), free0 );
+	errors += check_value( "coef high water", coef->high_water >= 3500, 1 );
+
+	// a request larger than the free space fails without taking anything
+	errors += check_value( "too large", vbx_sp_heap_malloc( NULL, free0 + 1 ) == NULL, 1 );
+	errors += check_value( "stack free space after failure", vbx_sp_getfree(), free0 );
+
+	printf( "%-32s %s\n", "alloc", errors ? "FAILED" : "ok" );
+	return errors;
+}
+
+// Heap blocks keep their data through vbx_sp_push/pop and vbx_sp_free
+int test_persist( uint32_t *in, uint32_t *out )
+{
+	int n, errors;
+	vbx_uword_t *h = (vbx_uword_t *)vbx_sp_heap_malloc( vbx_sp_pool( "coef", 0 ), N*sizeof(vbx_uword_t) );
+	vbx_uword_t *v;
+
+	test_init_array_word( (int32_t *)in, N, 1 );
+	vbx_dma_to_vector( h, in, N*sizeof(vbx_uword_t) );
+
+	// overwrite all of the stack allocator's space, before and after vbx_sp_free()
+	vbx_sp_push();
+	n = vbx_sp_getfree() / sizeof(vbx_uword_t);
+	v = (vbx_uword_t *)vbx_sp_malloc( n*sizeof(vbx_uword_t) );
+	vbx_set_vl( n );
+	vbx( SVWU, VMOV, v, 0, 0 );
+	vbx_sp_pop();
+	vbx_sp_free();
+	v = (vbx_uword_t *)vbx_sp_malloc( n*sizeof(vbx_uword_t) );
+	vbx( SVWU, VMOV, v, 0, 0 );
+
+	vbx_dma_to_host( out, h, N*sizeof(vbx_uword_t) );
+	vbx_sync();
+	errors = test_verify_array_word( (int32_t *)in, (int32_t *)out, N );
+	printf( "%-32s %s\n", "persist", errors ? "FAILED" : "ok" );
+	vbx_sp_free();
+	vbx_sp_heap_free( h );
+	return errors;
+}
+
+// Cache entries are found by host address and size, keep the data of the
+// host buffer, and are evicted least recently used first, unless locked
+int test_cache( uint32_t *coef, uint32_t *out )
+{
+	const int bytes = 1024*sizeof(uint32_t);
+	int errors = 0;
+	int free0 = vbx_sp_getfree();
+	vbx_sp_cache_stats_t stats;
+	vbx_void_t *a, *b, *c, *v;
+
+	a = vbx_sp_cache_get( coef, bytes );
+	b = vbx_sp_cache_get( coef+1024, bytes );
+	c = vbx_sp_cache_get( coef, bytes/2 );
+	if( !a || !b || !c ) {
+		printf( "cache: lookup failed\n" );
+		return 1;
+	}
+	vbx_sp_cache_put( a );
+	vbx_sp_cache_put( b );
+	vbx_sp_cache_put( c );
+	errors += check_value( "hit", vbx_sp_cache_get( coef, bytes ) == a, 1 );
+	vbx_sp_cache_put( a );
+	errors += check_value( "hit", vbx_sp_cache_get( coef+1024, bytes ) == b, 1 );
+	vbx_sp_cache_put( b );
+	vbx_sp_cache_stats( &stats );
+	errors += check_value( "entries", stats.entries, 3 );
+	errors += check_value( "hits", stats.hits, 2 );
+	errors += check_value( "misses", stats.misses, 3 );
+	errors += check_value( "locked", stats.locked, 0 );
+
+	vbx_dma_to_host( out, b, bytes );
+	vbx_sync();
+	errors += test_verify_array_word( (int32_t *)coef+1024, (int32_t *)out, 1024 );
+
+	// unlocked entries count as free, the stack allocator evicts them when it needs their space
+	errors += check_value( "free space with unlocked entries", vbx_sp_getfree(), free0 );
+
+	// the stack allocator takes the space of the least recently used entry, c
+	v = vbx_sp_malloc( free0 - 2*bytes );
+	vbx_sp_cache_stats( &stats );
+	errors += check_value( "evictions", stats.evictions, 1 );
+	errors += check_value( "kept b", vbx_sp_cache_get( coef+1024, bytes ) == b, 1 );
+	vbx_sp_free();
+	errors += check_value( "stack space", v != NULL, 1 );
+
+	// locked entries stay, invalidation drops every size of a buffer
+	vbx_sp_cache_flush();
+	vbx_sp_cache_stats( &stats );
+	errors += check_value( "entries after flush", stats.entries, 1 );
+	vbx_sp_cache_put( b );
+	a = vbx_sp_cache_get( coef, bytes );
+	c = vbx_sp_cache_get( coef, bytes/2 );
+	vbx_sp_cache_put( a );
+	vbx_sp_cache_put( c );
+	vbx_sp_cache_invalidate( coef );
+	vbx_sp_cache_stats( &stats );
+	errors += check_value( "entries after invalidate", stats.entries, 1 );
+	vbx_sp_cache_invalidate( coef+1024 );
+	errors += check_value( "stack free space after invalidate", vbx_sp_getfree(), free0 );
+
+	printf( "%-32s %s\n", "cache", errors ? "FAILED" : "ok" );
+	return errors;
+}
+
+// One frame: out = in * coefficients, with the coefficients already at v_coef
+static void frame( uint32_t *out, uint32_t *in, vbx_uword_t *v_coef )
+{
+	vbx_uword_t *v = (vbx_uword_t *)vbx_sp_malloc( N*sizeof(vbx_uword_t) );
+	vbx_dma_to_vector( v, in, N*sizeof(vbx_uword_t) );
+	vbx_set_vl( N );
+	vbx( VVWU, VMUL, v, v, v_coef );
+	vbx_dma_to_host( out, v, N*sizeof(vbx_uword_t) );
+}
+
+// Coefficients reloaded with every frame, as a stack allocation must be,
+// against coefficients kept in the heap, and in the residency cache
+int test_frames( uint32_t *in, uint32_t *coef, uint32_t *out )
+{
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	double reload_time;
+	int f, run, errors = 0;
+	vbx_uword_t *v_coef;
+
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "reload coefficients" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		for( f = 0; f < FRAMES; f++ ) {
+			vbx_sp_push();
+			v_coef = (vbx_uword_t *)vbx_sp_malloc( TAPS*sizeof(vbx_uword_t) );
+			vbx_dma_to_vector( v_coef, coef, TAPS*sizeof(vbx_uword_t) );
+			frame( out, in, v_coef );
+			vbx_sp_pop();
+		}
+		vbx_sync();
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	reload_time = vbx_bench_end( &bench, 0.0, (char *)"", 0.0 );
+
+	vbx_bench_begin( &bench, "heap coefficients" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		v_coef = (vbx_uword_t *)vbx_sp_heap_malloc( vbx_sp_pool( "coef", 0 ), TAPS*sizeof(vbx_uword_t) );
+		vbx_dma_to_vector( v_coef, coef, TAPS*sizeof(vbx_uword_t) );
+		for( f = 0; f < FRAMES; f++ ) {
+			vbx_sp_push();
+			frame( out, in, v_coef );
+			vbx_sp_pop();
+		}
+		vbx_sync();
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+		vbx_sp_heap_free( v_coef );
+	}
+	vbx_bench_end( &bench, 0.0, (char *)"", reload_time );
+
+	vbx_bench_begin( &bench, "cached coefficients" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		for( f = 0; f < FRAMES; f++ ) {
+			vbx_sp_push();
+			v_coef = (vbx_uword_t *)vbx_sp_cache_get( coef, TAPS*sizeof(vbx_uword_t) );
+			frame( out, in, v_coef );
+			vbx_sp_cache_put( v_coef );
+			vbx_sp_pop();
+		}
+		vbx_sync();
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+		vbx_sp_cache_invalidate( coef );
+	}
+	vbx_bench_end( &bench, 0.0, (char *)"", reload_time );
+
+	for( f = 0; f < N && !errors; f++ )
+		errors += out[f] != in[f]*coef[f];
+	printf( "%-32s %s\n", "frames", errors ? "FAILED" : "ok" );
+	return errors;
+}
+
+int main(void)
+{
+	int errors = 0;
+	uint32_t *in, *coef, *out;
+
+	vbx_test_init();
+	vbx_mxp_print_params();
+	printf( "\nScratchpad heap test...\n" );
+
+	in   = (uint32_t *)vbx_shared_malloc( N*sizeof(uint32_t) );
+	coef = (uint32_t *)vbx_shared_malloc( TAPS*sizeof(uint32_t) );
+	out  = (uint32_t *)vbx_shared_malloc( N*sizeof(uint32_t) );
+	if( !in || !coef || !out ) {
+		VBX_PRINTF( "ERROR: out of memory.\n" );
+		VBX_EXIT(-1);
+	}
+	test_init_array_word( (int32_t *)in, N, 2 );
+	test_init_array_word( (int32_t *)coef, TAPS, 3 );
+
+	errors += test_alloc();
+	errors += test_persist( in, out );
+	errors += test_cache( coef, out );
+	errors += test_frames( in, coef, out );
+	vbx_sp_heap_print();
+
+	vbx_shared_free( in );
+	vbx_shared_free( coef );
+	vbx_shared_free( out );
+
+	VBX_TEST_END(errors);
+	return 0;
+}
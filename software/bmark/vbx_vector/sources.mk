@@ -0,0 +1 @@
+CXX_SRCS += test.cpp
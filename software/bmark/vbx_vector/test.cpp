@@ -0,0 +1,633 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+
+#include "vbx_copyright.h"
+VBXCOPYRIGHT( test_vector )
+
+/*
+ * C++ vector expressions - Scalar version, C++ version and C version
+ */
+
+#include <stdio.h>
+#include "vbx.h"
+#include "vbx_test.h"
+#include "vbx_vector.hpp"
+
+using namespace VBX;
+
+#define N 1024
+#define ROWS 64 // ROWS*COLS == N
+#define COLS 16
+#define HOST_N 100003 // several strips of the scratchpad, and a partial one
+
+typedef vbx_word_t word;
+
+word *scalar_a, *scalar_b, *scalar_c, *scalar_d, *scalar_out, *vector_out;
+
+template<typename T,typename E>
+int temps(const Expr<T,E>&)
+{
+	return E::temps;
+}
+
+int check( const char *name, const Vector<word>& v, word *expected )
+{
+	int errors;
+	v.get_data( vector_out );
+	vbx_sync();
+	errors = test_verify_array_word( expected, vector_out, N );
+	printf( "%-32s %s\n", name, errors ? "FAILED" : "ok" );
+	return errors;
+}
+
+int check_temps( const char *name, int temps, int expected )
+{
+	printf( "%-32s %d temporaries%s\n", name, temps, temps == expected ? "" : ", FAILED" );
+	return temps != expected;
+}
+
+int test_expressions( Vector<word>& a, Vector<word>& b, Vector<word>& c, Vector<word>& d, Vector<word>& o )
+{
+	int i, errors = 0;
+	const word *sa = scalar_a, *sb = scalar_b, *sc = scalar_c, *sd = scalar_d;
+	word *so = scalar_out;
+
+	set_vl( N );
+
+	o = (a+b)*c - d;
+	for( i = 0; i < N; i++ ) so[i] = (sa[i]+sb[i])*sc[i] - sd[i];
+	errors += check( "(a+b)*c-d", o, so );
+
+	o = (a+b)*(c+d);
+	for( i = 0; i < N; i++ ) so[i] = (sa[i]+sb[i])*(sc[i]+sd[i]);
+	errors += check( "(a+b)*(c+d)", o, so );
+
+	o = a*b + (c*d - (a^d));
+	for( i = 0; i < N; i++ ) so[i] = sa[i]*sb[i] + (sc[i]*sd[i] - (sa[i]^sd[i]));
+	errors += check( "a*b+(c*d-(a^d))", o, so );
+
+	// the right operand needs more temporaries, so it is evaluated first
+	o = a*b + (c*d + (a*c - b*d));
+	for( i = 0; i < N; i++ ) so[i] = sa[i]*sb[i] + (sc[i]*sd[i] + (sa[i]*sc[i] - sb[i]*sd[i]));
+	errors += check( "a*b+(c*d+(a*c-b*d))", o, so );
+
+	o = ((a+b)*(c-d)) - ((a^c)*(b|d));
+	for( i = 0; i < N; i++ ) so[i] = ((sa[i]+sb[i])*(sc[i]-sd[i])) - ((sa[i]^sc[i])*(sb[i]|sd[i]));
+	errors += check( "((a+b)*(c-d))-((a^c)*(b|d))", o, so );
+
+	o = 3 - a;
+	for( i = 0; i < N; i++ ) so[i] = 3 - sa[i];
+	errors += check( "3-a", o, so );
+
+	o = (a - 3) | 1;
+	for( i = 0; i < N; i++ ) so[i] = (sa[i] - 3) | 1;
+	errors += check( "(a-3)|1", o, so );
+
+	o = ((a << 2) >> 1) & 0xfff;
+	for( i = 0; i < N; i++ ) so[i] = ((sa[i] << 2) >> 1) & 0xfff;
+	errors += check( "((a<<2)>>1)&0xfff", o, so );
+
+	o = 7*a + ENUM<word>()*3;
+	for( i = 0; i < N; i++ ) so[i] = 7*sa[i] + i*3;
+	errors += check( "7*a+enum*3", o, so );
+
+	o = a[1] + b;
+	for( i = 0; i < N; i++ ) so[i] = sa[i+1] + sb[i];
+	errors += check( "a[1]+b", o, so );
+
+	o = d;
+	o.cond_move( a < b, c + d );
+	for( i = 0; i < N; i++ ) so[i] = sa[i] < sb[i] ? sc[i] + sd[i] : sd[i];
+	errors += check( "cond_move(a<b,c+d)", o, so );
+
+	o = d;
+	o.cond_move( (a & 1) == 0, 5 );
+	for( i = 0; i < N; i++ ) so[i] = (sa[i] & 1) == 0 ? 5 : sd[i];
+	errors += check( "cond_move((a&1)==0,5)", o, so );
+
+	o = c;
+	o += a*b;
+	for( i = 0; i < N; i++ ) so[i] = sc[i] + sa[i]*sb[i];
+	errors += check( "o+=a*b", o, so );
+
+	// the destination is an operand of a node that is not evaluated last
+	o = c;
+	o = (a+b)*o;
+	for( i = 0; i < N; i++ ) so[i] = (sa[i]+sb[i])*sc[i];
+	errors += check( "o=(a+b)*o", o, so );
+
+	errors += check_temps( "(a+b)*c-d", temps( (a+b)*c-d ), 0 );
+	errors += check_temps( "(a+b)*(c+d)", temps( (a+b)*(c+d) ), 1 );
+	errors += check_temps( "a*b+(c*d-(a^d))", temps( a*b+(c*d-(a^d)) ), 1 );
+	errors += check_temps( "a*b+(c*d+(a*c-b*d))", temps( a*b+(c*d+(a*c-b*d)) ), 1 );
+	errors += check_temps( "((a+b)*(c-d))-((a^c)*(b|d))", temps( ((a+b)*(c-d))-((a^c)*(b|d)) ), 2 );
+	return errors;
+}
+
+double test_cpp( Vector<word>& a, Vector<word>& b, Vector<word>& c, Vector<word>& d, Vector<word>& o, double scalar_time )
+{
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
+	printf( "\nExecuting C++ (a+b)*c-d...\n" );
+
+	set_vl( N );
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "C++" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		o = (a+b)*c - d;
+		vbx_sync();
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+
+	printf( "...done\n" );
+	return vbx_bench_end( &bench, 0.0, (char *)"", scalar_time );
+}
+
+double test_c( word *v_a, word *v_b, word *v_c, word *v_d, word *v_o, double scalar_time )
+{
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int run;
+	printf( "\nExecuting C (a+b)*c-d...\n" );
+
+	vbx_set_vl( N );
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "C" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		vbx( VVW, VADD, v_o, v_a, v_b );
+		vbx( VVW, VMUL, v_o, v_o, v_c );
+		vbx( VVW, VSUB, v_o, v_o, v_d );
+		vbx_sync();
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+
+	printf( "...done\n" );
+	return vbx_bench_end( &bench, 0.0, (char *)"", scalar_time );
+}
+
+double test_scalar( word *o, word *a, word *b, word *c, word *d )
+{
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int i, run;
+	printf( "\nExecuting scalar (a+b)*c-d...\n" );
+
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "Scalar" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		for( i = 0; i < N; i++ )
+			o[i] = (a[i]+b[i])*c[i] - d[i];
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+
+	printf( "...done\n" );
+	return vbx_bench_end( &bench, 0.0, (char *)"", 0.0 );
+}
+
+int check_value( const char *name, int value, int expected )
+{
+	printf( "%-32s %s\n", name, value == expected ? "ok" : "FAILED" );
+	if( value != expected ) printf( "  got %d, expected %d\n", value, expected );
+	return value != expected;
+}
+
+int test_reductions()
+{
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	double host_time;
+	int i, r, run, errors = 0;
+	const word *sa = scalar_a, *sb = scalar_b, *sc = scalar_c;
+	word s, lo, hi;
+	int ilo, ihi;
+
+	printf( "\nReductions\n" );
+	Vector<word> a(N), b(N), c(N), rows(ROWS);
+	a.set_data( scalar_a );
+	b.set_data( scalar_b );
+	c.set_data( scalar_c );
+	set_vl( N );
+
+	for( s = 0, i = 0; i < N; i++ ) s += sa[i];
+	errors += check_value( "sum(a)", sum(a), s );
+	for( s = 0, i = 0; i < N; i++ ) s += sa[i]*sb[i];
+	errors += check_value( "dot(a,b)", dot(a,b), s );
+	for( s = 0, i = 0; i < N; i++ ) s += sa[i]*sb[i] - sc[i];
+	errors += check_value( "sum(a*b-c)", sum(a*b-c), s );
+
+	for( ilo = ihi = 0, i = 1; i < N; i++ ) {
+		if( sa[i] < sa[ilo] ) ilo = i;
+		if( sa[i] > sa[ihi] ) ihi = i;
+	}
+	errors += check_value( "minimum(a)", minimum(a), sa[ilo] );
+	errors += check_value( "maximum(a)", maximum(a), sa[ihi] );
+	errors += check_value( "a[argmin(a)]", sa[argmin(a)], sa[ilo] );
+	errors += check_value( "a[argmax(a)]", sa[argmax(a)], sa[ihi] );
+
+	for( lo = hi = sa[0]-sb[0], i = 1; i < N; i++ ) {
+		lo = sa[i]-sb[i] < lo ? sa[i]-sb[i] : lo;
+		hi = sa[i]-sb[i] > hi ? sa[i]-sb[i] : hi;
+	}
+	errors += check_value( "minimum(a-b)", minimum(a-b), lo );
+	errors += check_value( "maximum(a-b)", maximum(a-b), hi );
+
+	// byte elements with indices past 255
+	{
+		vbx_ubyte_t *bytes = (vbx_ubyte_t *)vbx_shared_malloc( N );
+		test_init_array_ubyte( bytes, N, 9 );
+		for( i = 0; i < N; i++ ) bytes[i] = bytes[i] | 1;
+		bytes[N-7] = 0;
+		bytes[300] = 255;
+		Vector<vbx_ubyte_t> u(N);
+		u.set_data( bytes );
+		errors += check_value( "argmin(ubytes)", argmin(u), N-7 );
+		errors += check_value( "ubytes[argmax(ubytes)]", bytes[argmax(u)], 255 );
+		vbx_shared_free( bytes );
+	}
+
+	Matrix<word> ma(ROWS,COLS), mb(ROWS,COLS);
+	ma.set_data( scalar_a );
+	mb.set_data( scalar_b );
+	row_sums( rows, ma*mb, ROWS, COLS );
+	for( r = 0; r < ROWS; r++ ) {
+		for( s = 0, i = 0; i < COLS; i++ ) s += sa[r*COLS+i]*sb[r*COLS+i];
+		scalar_out[r] = s;
+	}
+	rows.get_data( vector_out );
+	vbx_sync();
+	r = test_verify_array_word( scalar_out, vector_out, ROWS );
+	printf( "%-32s %s\n", "row_sums(a*b)", r ? "FAILED" : "ok" );
+	errors += r;
+
+	// the alternative to an on-chip reduction: multiply, DMA the products back and add them up
+	set_vl( N );
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "Host sum" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		c = a*b;
+		c.get_data( vector_out );
+		vbx_sync();
+		for( s = 0, i = 0; i < N; i++ ) s += vector_out[i];
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	host_time = vbx_bench_end( &bench, 0.0, (char *)"", 0.0 );
+
+	vbx_bench_begin( &bench, "dot" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		s = dot(a,b);
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	vbx_bench_end( &bench, 0.0, (char *)"", host_time );
+
+	return errors;
+}
+
+template<typename T>
+int check_array( const char *name, const Vector<T>& v, T *expected, int (*verify)(T *, T *, int) )
+{
+	int errors;
+	T *out = (T *)vbx_shared_malloc( N*sizeof(T) );
+	v.get_data( out );
+	vbx_sync();
+	errors = verify( expected, out, N );
+	printf( "%-32s %s\n", name, errors ? "FAILED" : "ok" );
+	vbx_shared_free( out );
+	return errors;
+}
+
+int test_convert()
+{
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	double vmov_time;
+	int i, run, errors = 0;
+	vbx_ubyte_t *sa = (vbx_ubyte_t *)vbx_shared_malloc( N );
+	vbx_ubyte_t *sb = (vbx_ubyte_t *)vbx_shared_malloc( N );
+	vbx_byte_t  *sc = (vbx_byte_t *)vbx_shared_malloc( N );
+	vbx_uhalf_t *sh = (vbx_uhalf_t *)vbx_shared_malloc( N*sizeof(vbx_uhalf_t) );
+	vbx_uhalf_t *eh = (vbx_uhalf_t *)malloc( N*sizeof(vbx_uhalf_t) );
+	vbx_half_t  *es = (vbx_half_t *)malloc( N*sizeof(vbx_half_t) );
+	vbx_ubyte_t *eb = (vbx_ubyte_t *)malloc( N );
+	vbx_uword_t *ew = (vbx_uword_t *)malloc( N*sizeof(vbx_uword_t) );
+	vbx_uword_t s;
+
+	printf( "\nMixed width\n" );
+	test_init_array_ubyte( sa, N, 10 );
+	test_init_array_ubyte( sb, N, 11 );
+	test_init_array_byte( sc, N, 12 );
+	test_init_array_uhalf( sh, N, 13 );
+	Vector<vbx_ubyte_t> a(N), b(N), o(N);
+	Vector<vbx_byte_t> c(N);
+	Vector<vbx_uhalf_t> h(N), g(N);
+	Vector<vbx_half_t> t(N);
+	Vector<vbx_uword_t> w(N);
+	a.set_data( sa );
+	b.set_data( sb );
+	c.set_data( sc );
+	g.set_data( sh );
+	set_vl( N );
+
+	for( i = 0; i < N; i++ ) eh[i] = sa[i] << 1;
+	h = widen(a) << 1;
+	errors += check_array( "widen(a)<<1", h, eh, test_verify_array_uhalf );
+	for( i = 0; i < N; i++ ) eh[i] = sa[i] * sb[i];
+	h = widen(a) * widen(b);
+	errors += check_array( "widen(a)*widen(b)", h, eh, test_verify_array_uhalf );
+	h = widen(a*b);
+	errors += check_array( "widen(a*b)", h, eh, test_verify_array_uhalf );
+	for( i = 0; i < N; i++ ) eh[i] = (vbx_uhalf_t)( sa[i]*sh[i] + sb[i] );
+	h = widen(a)*g + widen(b);
+	errors += check_array( "widen(a)*g+widen(b)", h, eh, test_verify_array_uhalf );
+	for( i = 0; i < N; i++ ) eb[i] = (vbx_ubyte_t)( (sh[i] + sa[i]) >> 2 );
+	o = narrow((g + widen(a)) >> 2);
+	errors += check_array( "narrow((g+widen(a))>>2)", o, eb, test_verify_array_ubyte );
+	for( i = 0; i < N; i++ ) es[i] = sc[i] - 300;
+	t = widen(c) - 300;
+	errors += check_array( "widen(signed)-300", t, es, test_verify_array_half );
+	for( i = 0; i < N; i++ ) ew[i] = sa[i] + i;
+	w = widen(widen(a)) + ENUM<vbx_uword_t>();
+	errors += check_array( "widen(widen(a))+enum", w, ew, test_verify_array_uword );
+	for( s = 0, i = 0; i < N; i++ ) s += sa[i];
+	errors += check_value( "sum(widen(widen(a)))", sum(widen(widen(a))), s );
+	errors += check_temps( "widen(a)*widen(b)", temps( widen(a)*widen(b) ), 0 );
+	errors += check_temps( "narrow((g+widen(a))>>2)", temps( narrow((g+widen(a))>>2) ), 1 );
+
+	// the alternative to a mixed width instruction: widen with a VMOV, then shift
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "VMOV then shift" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		vbxx( VMOV, h.get_sp_ptr(), a.get_sp_ptr() );
+		vbxx( VSHL, h.get_sp_ptr(), 1, h.get_sp_ptr() );
+		vbx_sync();
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	vmov_time = vbx_bench_end( &bench, 0.0, (char *)"", 0.0 );
+
+	vbx_bench_begin( &bench, "widen(a)<<1" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		h = widen(a) << 1;
+		vbx_sync();
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	vbx_bench_end( &bench, 0.0, (char *)"", vmov_time );
+
+	vbx_shared_free( sa );
+	vbx_shared_free( sb );
+	vbx_shared_free( sc );
+	vbx_shared_free( sh );
+	free( eh );
+	free( es );
+	free( eb );
+	free( ew );
+	return errors;
+}
+
+int check_matrix( const char *name, const Matrix<word>& m, word *expected )
+{
+	int errors;
+	m.get_data( vector_out );
+	vbx_sync();
+	errors = test_verify_array_word( expected, vector_out, m.get_rows()*m.get_cols()*m.get_mats() );
+	printf( "%-32s %s\n", name, errors ? "FAILED" : "ok" );
+	return errors;
+}
+
+int test_matrix()
+{
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	double row_time;
+	int i, r, k, run, errors = 0;
+	const word *sa = scalar_a, *sb = scalar_b, *sc = scalar_c, *sd = scalar_d;
+	word *so = scalar_out;
+
+	printf( "\nMatrix %dx%d\n", ROWS, COLS );
+	Matrix<word> a(ROWS,COLS), b(ROWS,COLS), c(ROWS,COLS), d(ROWS,COLS), o(ROWS,COLS);
+	Vector<word> v(COLS);
+	a.set_data( scalar_a );
+	b.set_data( scalar_b );
+	c.set_data( scalar_c );
+	d.set_data( scalar_d );
+	v.set_data( scalar_c );
+
+	o = (a+b)*c - d;
+	for( i = 0; i < N; i++ ) so[i] = (sa[i]+sb[i])*sc[i] - sd[i];
+	errors += check_matrix( "matrix (a+b)*c-d", o, so );
+
+	o = a - v;
+	for( i = 0; i < N; i++ ) so[i] = sa[i] - sc[i%COLS];
+	errors += check_matrix( "matrix a-row", o, so );
+
+	// a block of o, and a block of a with the same shape elsewhere in a
+	o = a;
+	MatrixView<word> blk = o.block( 8, 4, 16, 8 );
+	blk = blk*3 + a.block( 0, 8, 16, 8 );
+	for( i = 0; i < N; i++ ) so[i] = sa[i];
+	for( r = 0; r < 16; r++ ) {
+		for( k = 0; k < 8; k++ ) {
+			so[(r+8)*COLS+k+4] = sa[(r+8)*COLS+k+4]*3 + sa[r*COLS+k+8];
+		}
+	}
+	errors += check_matrix( "matrix block", o, so );
+
+	// 3D: the four 4x4 tiles across the top of d, as a strided view and as dense matrices
+	Vector<word> vd(N);
+	vd.set_data( scalar_d );
+	MatrixView<word> tiles( vd, 4, 4, COLS, 4, 4 );
+	Matrix<word> m3(4,4,4);
+	m3 = (tiles+1)*tiles;
+	for( i = 0; i < 4*4*4; i++ ) {
+		word x = sd[(i/4%4)*COLS + i/16*4 + i%4];
+		so[i] = (x+1)*x;
+	}
+	errors += check_matrix( "matrix 3D tiles", m3, so );
+
+	tiles = m3 - tiles;
+	for( i = 0; i < N; i++ ) so[i] = i < 4*COLS ? sd[i]*sd[i] : sd[i];
+	errors += check( "matrix 3D view", vd, so );
+
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "Row by row" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		vbx_set_vl( COLS );
+		for( r = 0; r < ROWS; r++ ) {
+			vbx( VVW, VADD, o.get_sp_ptr()+r*COLS, a.get_sp_ptr()+r*COLS, b.get_sp_ptr()+r*COLS );
+			vbx( VVW, VMUL, o.get_sp_ptr()+r*COLS, o.get_sp_ptr()+r*COLS, c.get_sp_ptr()+r*COLS );
+			vbx( VVW, VSUB, o.get_sp_ptr()+r*COLS, o.get_sp_ptr()+r*COLS, d.get_sp_ptr()+r*COLS );
+		}
+		vbx_sync();
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	row_time = vbx_bench_end( &bench, 0.0, (char *)"", 0.0 );
+
+	vbx_bench_begin( &bench, "Matrix" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		o = (a+b)*c - d;
+		vbx_sync();
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	vbx_bench_end( &bench, 0.0, (char *)"", row_time );
+	for( i = 0; i < N; i++ ) so[i] = (sa[i]+sb[i])*sc[i] - sd[i];
+	errors += check_matrix( "matrix bench", o, so );
+
+	return errors;
+}
+
+int verify_host( const char *name, word *expected, word *actual, int n )
+{
+	int errors = test_verify_array_word( expected, actual, n );
+	printf( "%-32s %s\n", name, errors ? "FAILED" : "ok" );
+	return errors;
+}
+
+int test_host( double *scalar_time )
+{
+	vbx_timestamp_t time_start, time_stop;
+	vbx_bench_t bench;
+	int i, run, errors = 0;
+	HostVector<word> a(HOST_N), b(HOST_N), c(HOST_N), d(HOST_N), o(HOST_N);
+	word *sa = a.get_host_ptr(), *sb = b.get_host_ptr(), *sc = c.get_host_ptr(), *sd = d.get_host_ptr();
+	word *so = (word *)malloc( HOST_N*sizeof(word) );
+
+	printf( "\nHost vector length: %d\n", HOST_N );
+	test_init_array_word( sa, HOST_N, 5 );
+	test_init_array_word( sb, HOST_N, 6 );
+	test_init_array_word( sc, HOST_N, 7 );
+	test_init_array_word( sd, HOST_N, 8 );
+
+	vbx_timestamp_start();
+	vbx_bench_begin( &bench, "Scalar host" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		for( i = 0; i < HOST_N; i++ ) so[i] = (sa[i]+sb[i])*sc[i] - sd[i];
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	*scalar_time = vbx_bench_end( &bench, 0.0, (char *)"", 0.0 );
+
+	vbx_bench_begin( &bench, "HostVector" );
+	for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+		time_start = vbx_timestamp();
+		o = (a+b)*c - d;
+		time_stop = vbx_timestamp();
+		vbx_bench_record( &bench, time_start, time_stop );
+	}
+	vbx_bench_end( &bench, 0.0, (char *)"", *scalar_time );
+	errors += verify_host( "host (a+b)*c-d", so, o.get_host_ptr(), HOST_N );
+
+	for( i = 0; i < HOST_N; i++ ) so[i] = sa[i]*2 + sb[i];
+	a = a*2 + b;
+	errors += verify_host( "host a=a*2+b", so, sa, HOST_N );
+
+	for( i = 0; i < HOST_N; i++ ) so[i] = sa[i]*sa[i] - 1;
+	o = a*a - 1;
+	errors += verify_host( "host a*a-1", so, o.get_host_ptr(), HOST_N );
+
+	o = c;
+	errors += verify_host( "host copy", sc, o.get_host_ptr(), HOST_N );
+
+	free( so );
+	return errors;
+}
+
+int main(void)
+{
+	vbx_test_init();
+
+	double scalar_time;
+	int errors=0;
+
+	vbx_mxp_print_params();
+	printf( "\nC++ vector expression test...\n" );
+	printf( "Vector length: %d\n", N );
+
+	scalar_a   = (word *)vbx_shared_malloc( (N+1)*sizeof(word) );
+	scalar_b   = (word *)vbx_shared_malloc( N*sizeof(word) );
+	scalar_c   = (word *)vbx_shared_malloc( N*sizeof(word) );
+	scalar_d   = (word *)vbx_shared_malloc( N*sizeof(word) );
+	scalar_out = (word *)malloc( N*sizeof(word) );
+	vector_out = (word *)vbx_shared_malloc( N*sizeof(word) );
+
+	test_init_array_word( scalar_a, N+1, 1 );
+	test_init_array_word( scalar_b, N, 2 );
+	test_init_array_word( scalar_c, N, 3 );
+	test_init_array_word( scalar_d, N, 4 );
+
+	{
+		Vector<word> a(N+1), b(N), c(N), d(N), o(N);
+		a.set_data( scalar_a );
+		b.set_data( scalar_b );
+		c.set_data( scalar_c );
+		d.set_data( scalar_d );
+
+		errors += test_expressions( a, b, c, d, o );
+
+		scalar_time = test_scalar( scalar_out, scalar_a, scalar_b, scalar_c, scalar_d );
+		test_c( a.get_sp_ptr(), b.get_sp_ptr(), c.get_sp_ptr(), d.get_sp_ptr(), o.get_sp_ptr(), scalar_time );
+		errors += check( "C bench", o, scalar_out );
+		test_cpp( a, b, c, d, o, scalar_time );
+		errors += check( "C++ bench", o, scalar_out );
+	}
+
+	errors += test_matrix();
+	errors += test_reductions();
+	errors += test_convert();
+	errors += test_host( &scalar_time );
+
+	VBX_TEST_END(errors);
+	return 0;
+}
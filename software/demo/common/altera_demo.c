@@ -367,11 +367,10 @@ vbx_timestamp_t switch_buffers(demo_t* pDemo)
 	pixel *temp;
 	vbx_timestamp_t time_start, time_stop, wait_time;
 
-	//Update frame reader to output last processed
-	IOWR(ALT_VIP_VFR_0_BASE, FRAME_READER_PB0_BASE, (int)(pDemo->buffer[BUFFER_PROCESSING]));
-
-	//Record how many cycles were spend waiting for the last frame from the video input to finish transferring
-	if(pDemo->frame_ready){
+	//Record how many cycles were spend waiting for the last frame from the video input to finish transferring,
+	//and for the MXP to finish writing the processed frame. Only the processed frame's fence is waited on,
+	//so the MXP may already be working ahead.
+	if(pDemo->frame_ready && vbx_fence_done(pDemo->frame_fence)){
 		wait_time = 0;
 	}
 	else {
@@ -379,10 +378,14 @@ vbx_timestamp_t switch_buffers(demo_t* pDemo)
 		while(!(pDemo->frame_ready)){
 			usleep(100);//Don't hog bus
 		}
+		vbx_fence_wait(pDemo->frame_fence);
 		time_stop = vbx_timestamp();
 		wait_time = time_stop - time_start;
 	}
 
+	//Update frame reader to output last processed
+	IOWR(ALT_VIP_VFR_0_BASE, FRAME_READER_PB0_BASE, (int)(pDemo->buffer[BUFFER_PROCESSING]));
+
 	//Move buffer pointers
 #if defined(__FRAME_WRITER) || defined(__STREAM_WRITER)
 	alt_ic_irq_disable(0, FRAME_WRITER_0_IRQ);
@@ -417,9 +420,11 @@ vbx_timestamp_t frame_buffer_update(demo_t *pDemo, int uses_video_in)
 	if (uses_video_in) {
 		wait_time = switch_buffers(pDemo);
 	} else {
+		vbx_fence_wait(pDemo->frame_fence);
 		wait_time = 0;
 	}
 #else
+	vbx_fence_wait(pDemo->frame_fence);
 	wait_time = 0;
 #endif
 
@@ -63,7 +63,7 @@ int ball_calibrate(pixel *input, pixel *output, int player, pixel *color);
 
 void vector_uv_row(vptr_uword v_pixel, vptr_uhalf v_temp0, vptr_half v_temp1, vbx_byte_t *v_u, vbx_byte_t *v_v, int width);
 void vector_thresh_row(vbx_byte_t *v_bin, vbx_byte_t *v_u, vbx_byte_t *v_v, vbx_byte_t *v_high, vbx_byte_t *v_low, vbx_byte_t *v_temp, int width, int u, int v, int thresh);
-void vector_accum(vptr_uword v_acc, vptr_uword v_num, vptr_ubyte v_row, vptr_uword v_temp0, vptr_uword v_temp1, int width);
+void vector_accum(vptr_uword v_acc, vptr_uword v_num, vptr_ubyte v_row, vptr_uword v_temp0, vptr_uword v_temp1, int width, int rows);
 void vector_uv( pixel *in, pixel *out, int height, int width, feat_kalman *kal0, feat_kalman *kal1);
 int vector_ball_detect(pixel *input, pixel *output, feat_kalman *kal0, feat_kalman *kal1, pixel *color0, pixel* color1, int draw_ball);
 
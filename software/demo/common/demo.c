@@ -541,7 +541,8 @@ void loop_demo(demo_t *pDemo)
 			console_speedup(current_mode, total_ms[current_mode], total_ms[current_mode-1], uses_vector, cycles);
 		}
 
-		// flush data cache, swap frame buffers, and check for new mode
+		// fence the frame, flush data cache, swap frame buffers, and check for new mode
+		pDemo->frame_fence = vbx_fence();
 		vbx_dcache_flush_all();
 		wait_time = frame_buffer_update(pDemo, uses_video_in);
 		wait_ms = time_to_ms(wait_time);
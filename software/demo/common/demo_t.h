@@ -41,10 +41,12 @@
 
 #include "alt_video_display.h"
 #include "pixel.h"
+#include "vbx.h"
 
 typedef struct demo_t {
 	alt_video_display *pDisplay;
 	int frame_ready;
+	vbx_fence_t frame_fence; // complete when the processed frame is in memory
 	struct pixel** buffer;
 	unsigned short *short_buffer;
 } demo_t;
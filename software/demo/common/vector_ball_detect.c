@@ -41,6 +41,7 @@ VBXCOPYRIGHT( vector_ball_detect )
 
 #include "demo.h"
 #include "ball_detect.h"
+#include "vbw_stream.h"
 
 	pixel _color0;
 	pixel _color1;
@@ -132,63 +133,78 @@ void vector_thresh_row(vbx_byte_t *v_bin, vbx_byte_t *v_u, vbx_byte_t *v_v, vbx_
 	vbx(VVB, VAND, v_bin, v_bin, v_temp);
 }
 
-void vector_accum(vptr_uword v_acc, vptr_uword v_num, vptr_ubyte v_row, vptr_uword v_temp0, vptr_uword v_temp1, int width)
+void vector_accum(vptr_uword v_acc, vptr_uword v_num, vptr_ubyte v_row, vptr_uword v_temp0, vptr_uword v_temp1, int width, int rows)
 {
-	vbx_set_vl(width-2);//for edges
+	// rows are contiguous; convert them all, then accumulate one sum per row
+	vbx_set_vl(rows*width-2);//for edges
 
 	vbx(VVBW, VMOV, (vbx_word_t*)v_temp0, (vbx_byte_t*)v_row, 0);
 	vbx(SVW, VSUB, (vbx_word_t*)v_temp1, 0, (vbx_word_t*)v_temp0);
 	vbx(SVW, VCMV_LTZ, (vbx_word_t*)v_temp1, 1, (vbx_word_t*)v_temp1);
-	vbx_acc(VVWU, VMOV, v_num, v_temp1, 0);
-	vbx_acc(VEWU, VMUL, v_acc, v_temp1, 0);
+
+	vbx_set_vl(width-2);
+	vbx_set_2D(rows, sizeof(vbx_uword_t), width*sizeof(vbx_uword_t), 0);
+	vbx_acc_2D(VVWU, VMOV, v_num, v_temp1, 0);
+	vbx_acc_2D(VEWU, VMUL, v_acc, v_temp1, 0);
 }
 
-void vector_uv( pixel *in, pixel *out, int height, int width, feat_kalman *kal0, feat_kalman *kal1)
+typedef struct {
+	vptr_uword v_acc, v_num;
+#if TRACK_TWO
+	vptr_uword v_2acc, v_2num;
+#endif
+	int u0, v0, u1, v1, thresh;
+} vector_uv_t;
+
+// Thresholds a batch of rows, converted as one vector, and accumulates each row
+static void vector_uv_rows(const vbw_stream_chunk_t *chunk, void *arg)
 {
-	vbx_sp_push();
-	vptr_uword v_pix0 = (vptr_uword)vbx_sp_malloc(width*sizeof(vbx_uword_t));
-	vptr_uword v_pix1 = (vptr_uword)vbx_sp_malloc(width*sizeof(vbx_uword_t));
+	const vector_uv_t *uv = (const vector_uv_t *)arg;
+	const int width = chunk->row_len;
+	const int n     = chunk->rows*width;
 
-	vptr_uword v_tempi = (vptr_uword)vbx_sp_malloc(width*sizeof(vbx_uword_t));
-	vptr_uword v_tempii = (vptr_uword)vbx_sp_malloc(width*sizeof(vbx_uword_t));
+	vptr_uword v_tempi  = (vptr_uword)chunk->v_temp;
+	vptr_uword v_tempii = v_tempi + n;
 
-	vptr_uhalf v_temp0   = (vptr_uhalf)v_tempi;
-	vptr_half v_temp1   = (vptr_half)v_temp0 + width;
+	vptr_uhalf v_temp0 = (vptr_uhalf)v_tempi;
+	vptr_half  v_temp1 = (vptr_half)v_temp0 + n;
 
-	vbx_byte_t *v_u   = (vbx_byte_t *)vbx_sp_malloc(width*sizeof(vbx_byte_t));
-	vbx_byte_t *v_v   = (vbx_byte_t *)vbx_sp_malloc(width*sizeof(vbx_byte_t));
+	vbx_byte_t *v_u = (vbx_byte_t *)(v_tempii + n);
+	vbx_byte_t *v_v = v_u + n;
+
+	vptr_ubyte v_bin0 = (vptr_ubyte)(v_v + n);
+	vptr_ubyte v_bin1 = v_bin0 + n;
+
+	vbx_byte_t *v_tempA = (vbx_byte_t *)v_temp0;
+	vbx_byte_t *v_tempB = (vbx_byte_t *)v_temp1;
+	vbx_byte_t *v_tempC = v_tempB + n;
+
+	vector_uv_row(       (vptr_uword)chunk->v_in[0], v_temp0, v_temp1,  v_u, v_v, n);
+	vector_thresh_row( (vbx_byte_t*)v_bin0, v_u, v_v, v_tempA, v_tempB, v_tempC, n, uv->u0, uv->v0, uv->thresh);
+#if TRACK_TWO
+	vector_thresh_row( (vbx_byte_t*)v_bin1, v_u, v_v, v_tempA, v_tempB, v_tempC, n, uv->u1, uv->v1, uv->thresh);
+#endif
+	vector_accum( uv->v_acc +chunk->row, uv->v_num +chunk->row, v_bin0+1, v_tempi, v_tempii, width, chunk->rows);
+#if TRACK_TWO
+	vector_accum( uv->v_2acc +chunk->row, uv->v_2num +chunk->row, v_bin1+1, v_tempi, v_tempii, width, chunk->rows);
+#endif
+}
 
-	vptr_ubyte v_bin0 = (vptr_ubyte)vbx_sp_malloc(width*sizeof(vbx_ubyte_t));
-	vptr_ubyte v_bin1 = (vptr_ubyte)vbx_sp_malloc(width*sizeof(vbx_ubyte_t));
+void vector_uv( pixel *in, pixel *out, int height, int width, feat_kalman *kal0, feat_kalman *kal1)
+{
+	vbx_sp_push();
 
 	vptr_uword v_acc = (vptr_uword)vbx_sp_malloc((height-2)*sizeof(vbx_uword_t));
 	vptr_uword v_num = (vptr_uword)vbx_sp_malloc((height-2)*sizeof(vbx_uword_t));
 
 	vptr_uword v_total = (vptr_uword)vbx_sp_malloc(3*sizeof(vbx_uword_t));
 
-	vbx_byte_t *v_tempA  = (vbx_byte_t *) v_temp0;
-	vbx_byte_t *v_tempB = (vbx_byte_t *) v_temp1;
-	vbx_byte_t *v_tempC = v_tempB + width;
-
-	vptr_ubyte v_final = v_bin0;
 #if TRACK_TWO
-	vptr_ubyte v_2final = v_bin1;
-
 	vptr_uword v_2acc = (vptr_uword)vbx_sp_malloc((height-2)*sizeof(vbx_uword_t));
 	vptr_uword v_2num = (vptr_uword)vbx_sp_malloc((height-2)*sizeof(vbx_uword_t));
 	vptr_uword v_2total = (vptr_uword)vbx_sp_malloc(3*sizeof(vbx_uword_t));
 #endif
 
-	vptr_uword v_pixel[2]; 
-	v_pixel[0] = v_pix0;
-	v_pixel[1] = v_pix1;
-
-	vptr_ubyte v_bin[2]; 
-	v_bin[0] = v_bin0;
-	v_bin[1] = v_bin1;
-
-	int buf=1;
-
 	int r0 = _color0.r;
 	int g0 = _color0.g;
 	int b0 = _color0.b;
@@ -197,74 +213,33 @@ void vector_uv( pixel *in, pixel *out, int height, int width, feat_kalman *kal0,
 	int g1 = _color1.g;
 	int b1 = _color1.b;
 
-	int u0 = (((-38*r0 -74*g0 +112*b0) + 127) >> 8) + 128;
-	int v0 = (((112*r0 -94*g0  -18*b0) + 127) >> 8) + 128;
+	vector_uv_t uv;
+	uv.u0 = (((-38*r0 -74*g0 +112*b0) + 127) >> 8) + 128;
+	uv.v0 = (((112*r0 -94*g0  -18*b0) + 127) >> 8) + 128;
 
-	int u1 = (((-38*r1 -74*g1 +112*b1) + 127) >> 8) + 128;
-	int v1 = (((112*r1 -94*g1  -18*b1) + 127) >> 8) + 128;
+	uv.u1 = (((-38*r1 -74*g1 +112*b1) + 127) >> 8) + 128;
+	uv.v1 = (((112*r1 -94*g1  -18*b1) + 127) >> 8) + 128;
 
-	int thresh = THRESHOLD;
+	uv.thresh = THRESHOLD;
 
-	//init
-	vbx_set_vl(width);
-	vbx( VVBU, VMOV, v_final, 0, 0 );
-	vbx( VVWU, VMOV, v_acc, 0, 0 );
-	vbx( VVWU, VMOV, v_num, 0, 0 );
-
-#if TRACK_TWO
-	vbx( VVBU, VMOV, v_2final, 0, 0 );
-	vbx( VVWU, VMOV, v_2acc, 0, 0 );
-	vbx( VVWU, VMOV, v_2num, 0, 0 );
-#endif
-
-	vbx_dma_to_vector(    v_pixel[!buf], in +0*width, width*sizeof(vbx_uword_t));
-	buf=!buf;
-
-	vbx_dma_to_vector(    v_pixel[!buf], in +1*width, width*sizeof(vbx_uword_t));
-	vector_uv_row(       v_pixel[buf], v_temp0, v_temp1,  v_u, v_v, width);
-	vector_thresh_row( (vbx_byte_t*)v_bin[0], v_u, v_v, v_tempA, v_tempB, v_tempC, width, u0, v0, thresh);
+	uv.v_acc = v_acc;
+	uv.v_num = v_num;
 #if TRACK_TWO
-	vector_thresh_row( (vbx_byte_t*)v_bin[1], v_u, v_v, v_tempA, v_tempB, v_tempC, width, u1, v1, thresh);
+	uv.v_2acc = v_2acc;
+	uv.v_2num = v_2num;
 #endif
-	buf=!buf;
 
-	vbx_dma_to_vector(    v_pixel[!buf], in +2*width, width*sizeof(vbx_uword_t));
-	vector_uv_row(       v_pixel[buf], v_temp0, v_temp1,  v_u, v_v, width);
-	vector_thresh_row( (vbx_byte_t*)v_bin[0], v_u, v_v, v_tempA, v_tempB, v_tempC, width, u0, v0, thresh);
-#if TRACK_TWO
-	vector_thresh_row( (vbx_byte_t*)v_bin[1], v_u, v_v, v_tempA, v_tempB, v_tempC, width, u1, v1, thresh);
-	buf=!buf;
-#endif
-
-	int y;
-	for(y=3; y<height; y++){
-		vbx_dma_to_vector(    v_pixel[!buf], in +y*width, width*sizeof(vbx_uword_t));
-		vector_uv_row(       v_pixel[buf], v_temp0, v_temp1,  v_u, v_v, width);
-		vector_thresh_row( (vbx_byte_t*)v_bin[0], v_u, v_v, v_tempA, v_tempB, v_tempC, width, u0, v0, thresh);
-#if TRACK_TWO
-		vector_thresh_row( (vbx_byte_t*)v_bin[1], v_u, v_v, v_tempA, v_tempB, v_tempC, width, u1, v1, thresh);
-#endif
-		vector_accum( v_acc +y-3, v_num +y-3, v_final+1, v_tempi, v_tempii, width);
-#if TRACK_TWO
-		vector_accum( v_2acc +y-3, v_2num +y-3, v_2final+1, v_tempi, v_tempii, width);
-#endif
-
-		buf=!buf;
+	// Rows 2 to height-1 stream through in batches, each row accumulated
+	// into v_acc/v_num at row-2; per pixel: two word temporaries, u, v and
+	// a bin for each colour
+	vbw_stream_t pixels = { in + 2*width, sizeof(vbx_uword_t), width, 0, 0 };
+	if (vbw_stream(&pixels, 1, NULL, 0, height-2, width,
+	               (2*sizeof(vbx_uword_t) + 4*sizeof(vbx_ubyte_t))*width, vector_uv_rows, &uv)) {
+		printf("Out of scratchpad memory\n");
+		vbx_sp_pop();
+		return;
 	}
 
-	//final
-	vector_uv_row(       v_pixel[buf], v_temp0, v_temp1,  v_u, v_v, width);
-	vector_thresh_row( (vbx_byte_t*)v_bin[0], v_u, v_v, v_tempA, v_tempB, v_tempC, width, u0, v0, thresh);
-#if TRACK_TWO
-	vector_thresh_row( (vbx_byte_t*)v_bin[1], v_u, v_v, v_tempA, v_tempB, v_tempC, width, u1, v1, thresh);
-#endif
-	vector_accum( v_acc +height-3, v_num +height-3, v_final+1, v_tempi, v_tempii, width);
-#if TRACK_TWO
-	vector_accum( v_2acc +height-3, v_2num +height-3, v_2final+1, v_tempi, v_tempii, width);
-#endif
-
-
-	vbx_sync();
 	vbx_set_vl( height-2 );
 	vbx_acc( VVWU, VMOV, v_total+0, v_num, 0);
 	vbx_acc( VVWU, VMOV, v_total+1, v_acc, 0);
@@ -127,8 +127,8 @@ void vector_draw_alpha(int startx, int starty, pixel *bg, pixel *fg, int size_x,
 		for(j = 0; j < lines_per_pass; j++){
 			vbx_dma_to_host(bg_buffer+(j*IMAGE_WIDTH), v_fg+(j*size_x), size_x*sizeof(pixel));
 		}
-		vbx_sync();
 	}
+	// No vbx_sync(): the frame is fenced before it is displayed
 
 	vbx_sp_free();
 }
@@ -41,6 +41,7 @@ VBXCOPYRIGHT( vector_haar_detect )
 
 #include "demo.h"
 #include "haar_detect.h"
+#include "vbw_stream.h"
 #include "sqrtLUT.h"
 
 int stage_count[22];
@@ -384,59 +385,53 @@ void vector_row_haar_2D( vptr_word v_int, vptr_word v_tmp, int win, int width, i
 		vbx_sync();
 }
 
-void vector_get_img(short *idest, pixel *isrc, short bin, const int image_width, const int image_height, const int image_pitch)
+// Bins and converts a batch of rows to luma as one vector; each element
+// of the input is bin pixels, of which the first is kept
+static void vector_get_img_rows(const vbw_stream_chunk_t *chunk, void *arg)
 {
-	
-	vptr_uword v_next, v_in, v_reduced;
-	vptr_uhalf v_temp, v_out, v_luma;
-	vptr_uword v_tmp_word;
-	vptr_uhalf v_tmp_half;
-	v_in       = (vptr_uword)vbx_sp_malloc(image_width*sizeof(vbx_uword_t));
-	v_next     = (vptr_uword)vbx_sp_malloc(image_width*sizeof(vbx_uword_t));
-	v_reduced  = (vptr_uword)vbx_sp_malloc(image_width/bin*sizeof(vbx_uword_t));
-	v_temp     = (vptr_uhalf)vbx_sp_malloc(image_width/bin*sizeof(vbx_uhalf_t));
-	v_luma     = (vptr_uhalf)vbx_sp_malloc(image_width/bin*sizeof(vbx_uhalf_t));
-	v_out      = (vptr_uhalf)vbx_sp_malloc(image_width/bin*sizeof(vbx_uhalf_t));
-	if (v_out == NULL) exit( -1);
-
-	vbx_dma_to_vector(v_next, isrc+image_pitch, image_width*sizeof(vbx_uword_t));
+	const int bin = *(const short *)arg;
+	const int n   = chunk->rows*chunk->row_len;
 
-	int y;
-	for(y = 0; y < image_height/bin; y++){
-	  // transfer in row of camera input
-	  SWAP(v_next, v_in, v_tmp_word);
-	  vbx_dma_to_vector(v_next, isrc+( bin*(y+1))*image_pitch, image_width*sizeof(vbx_uword_t));
+	vptr_uword v_in      = (vptr_uword)chunk->v_in[0];
+	vptr_uhalf v_luma    = (vptr_uhalf)chunk->v_out[0];
+	vptr_uword v_reduced = (vptr_uword)chunk->v_temp;
+	vptr_uhalf v_temp    = (vptr_uhalf)(v_reduced + n);
 
-	  // bin image: for IMAGE_WIDTH / bin times, transfer a pixel, move over bin pixels
-	  vbx_set_vl(1);
-	  vbx_set_2D(image_width/bin, sizeof(vbx_uword_t), bin*sizeof(vbx_uword_t),0);
-	  vbx_2D(VVWU, VMOV, v_reduced, v_in, 0);
+	// bin image: for each output pixel, transfer a pixel, move over bin pixels
+	vbx_set_vl(1);
+	vbx_set_2D(n, sizeof(vbx_uword_t), bin*sizeof(vbx_uword_t),0);
+	vbx_2D(VVWU, VMOV, v_reduced, v_in, 0);
 
-	  vbx_set_vl(image_width/bin);
+	vbx_set_vl(n);
 
-		//Move the b component into v_luma
-		vbx(SVWHU, VAND, v_temp, 0xFF,   v_reduced);
-		vbx(SVHU,  VMUL, v_luma, 25,     v_temp);
+	//Move the b component into v_luma
+	vbx(SVWHU, VAND, v_temp, 0xFF,   v_reduced);
+	vbx(SVHU,  VMUL, v_luma, 25,     v_temp);
 
-		//Move g into v_temp and add it to v_luma
-		vbx(SVWHU, VAND, v_temp, 0xFF,   (vptr_uword)(((vptr_ubyte)v_reduced)+1));
-		vbx(SVHU,  VMUL, v_temp, 129,    v_temp);
-		vbx(VVHU,  VADD, v_luma, v_luma, v_temp);
+	//Move g into v_temp and add it to v_luma
+	vbx(SVWHU, VAND, v_temp, 0xFF,   (vptr_uword)(((vptr_ubyte)v_reduced)+1));
+	vbx(SVHU,  VMUL, v_temp, 129,    v_temp);
+	vbx(VVHU,  VADD, v_luma, v_luma, v_temp);
 
-		//Move r into v_temp and add it to v_luma
-		vbx(SVWHU, VAND, v_temp, 0xFF,   (vptr_uword)(((vptr_ubyte)v_reduced)+2));
-		vbx(SVHU,  VMUL, v_temp, 66,     v_temp);
-		vbx(VVHU,  VADD, v_luma, v_luma, v_temp);
+	//Move r into v_temp and add it to v_luma
+	vbx(SVWHU, VAND, v_temp, 0xFF,   (vptr_uword)(((vptr_ubyte)v_reduced)+2));
+	vbx(SVHU,  VMUL, v_temp, 66,     v_temp);
+	vbx(VVHU,  VADD, v_luma, v_luma, v_temp);
 
-		vbx(SVHU,  VSHR, v_luma, 8,      v_luma);
+	vbx(SVHU,  VSHR, v_luma, 8,      v_luma);
+}
 
-	  // transfer binned image out
-	  SWAP(v_out, v_luma, v_tmp_half);
-	  vbx_dma_to_host(idest+y*image_width/bin, v_out, image_width/bin*sizeof(vbx_uhalf_t));
+void vector_get_img(short *idest, pixel *isrc, short bin, const int image_width, const int image_height, const int image_pitch)
+{
+	// every bin-th row, as image_width/bin elements of bin pixels, streams
+	// through in batches; the first pixel of each element is kept
+	vbw_stream_t in  = { isrc,  bin*sizeof(vbx_uword_t), image_pitch, 0, 0 };
+	vbw_stream_t out = { idest, sizeof(vbx_uhalf_t),     image_width/bin, 0, 0 };
+
+	if (vbw_stream(&in, 1, &out, 1, image_height/bin, image_width/bin,
+	               (sizeof(vbx_uword_t) + sizeof(vbx_uhalf_t))*(image_width/bin), vector_get_img_rows, &bin)) {
+		exit( -1);
 	}
-
-	vbx_sync();
-	vbx_sp_free();
 }
 
 void vector_BLIP(short* img, short height, short width, short* scaled_img, short scaled_height, short scaled_width, short value)
@@ -43,6 +43,7 @@
 #include "scalar_mtx_sobel.h"
 #include "scalar_mtx_median.h"
 #include "scalar_mtx_fir.h"
+#include "scalar_mtx_conv.h"
 #include "scalar_mtx_xp.h"
 
 #include "scalar_vec_divide.h"
@@ -0,0 +1,129 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**@file*/
+#include "scalar_mtx_conv.h"
+
+// Reads element i of an image of elements of size bytes
+static uint32_t get( const void *image, const int i, const int size, const int is_signed )
+{
+	switch( size ) {
+	case 1:  return is_signed ? (uint32_t)((int8_t  *)image)[i] : ((uint8_t  *)image)[i];
+	case 2:  return is_signed ? (uint32_t)((int16_t *)image)[i] : ((uint16_t *)image)[i];
+	default: return ((uint32_t *)image)[i];
+	}
+}
+
+static void put( void *image, const int i, const int size, const uint32_t value )
+{
+	switch( size ) {
+	case 1:  ((uint8_t  *)image)[i] = value; break;
+	case 2:  ((uint16_t *)image)[i] = value; break;
+	default: ((uint32_t *)image)[i] = value; break;
+	}
+}
+
+/** 2D convolution scalar, for any element type.
+ *	Each output pixel is the 32-bit sum of the kernel around it, rounded,
+ *	shifted and optionally saturated; the pixels the kernel does not fit
+ *	around are 0. Unsigned words are summed unsigned, the others signed.
+ */
+static void scalar_mtx_conv( void *output, void *input, const int32_t *coeffs, const int kernel_rows, const int kernel_cols,
+                             const int image_width, const int image_height, const int image_pitch, const int shift, const int saturate,
+                             const int size, const int is_signed )
+{
+	const int top  = (kernel_rows-1)/2;
+	const int left = (kernel_cols-1)/2;
+	const int32_t max = size == 4 ? 0 : is_signed ? (1 << (8*size-1)) - 1 : (1 << 8*size) - 1;
+	const int32_t min = size == 4 ? 0 : is_signed ? -(1 << (8*size-1)) : 0;
+	int x, y, r, c;
+	uint32_t sum;
+
+	for( y = 0; y < image_height; y++ ) {
+		for( x = 0; x < image_width; x++ ) {
+			if( y < top || y >= image_height-(kernel_rows-1-top) ||
+			    x < left || x >= image_width-(kernel_cols-1-left) ) {
+				put( output, y*image_pitch+x, size, 0 );
+				continue;
+			}
+			sum = 0;
+			for( r = 0; r < kernel_rows; r++ ) {
+				for( c = 0; c < kernel_cols; c++ ) {
+					sum += get( input, (y-top+r)*image_pitch + x-left+c, size, is_signed ) * (uint32_t)coeffs[r*kernel_cols+c];
+				}
+			}
+			if( shift > 0 ) {
+				sum += 1u << (shift-1);
+				sum = (size == 4 && !is_signed) ? sum >> shift : (uint32_t)((int32_t)sum >> shift);
+			}
+			if( saturate && size < 4 ) {
+				sum = (int32_t)sum > max ? (uint32_t)max : (int32_t)sum < min ? (uint32_t)min : sum;
+			}
+			put( output, y*image_pitch+x, size, sum );
+		}
+	}
+}
+
+void scalar_mtx_conv_byte( int8_t *output, int8_t *input, const int32_t *coeffs, const int kernel_rows, const int kernel_cols, const int image_width, const int image_height, const int image_pitch, const int shift, const int saturate )
+{
+	scalar_mtx_conv( output, input, coeffs, kernel_rows, kernel_cols, image_width, image_height, image_pitch, shift, saturate, sizeof(int8_t), 1 );
+}
+
+void scalar_mtx_conv_half( int16_t *output, int16_t *input, const int32_t *coeffs, const int kernel_rows, const int kernel_cols, const int image_width, const int image_height, const int image_pitch, const int shift, const int saturate )
+{
+	scalar_mtx_conv( output, input, coeffs, kernel_rows, kernel_cols, image_width, image_height, image_pitch, shift, saturate, sizeof(int16_t), 1 );
+}
+
+void scalar_mtx_conv_word( int32_t *output, int32_t *input, const int32_t *coeffs, const int kernel_rows, const int kernel_cols, const int image_width, const int image_height, const int image_pitch, const int shift, const int saturate )
+{
+	scalar_mtx_conv( output, input, coeffs, kernel_rows, kernel_cols, image_width, image_height, image_pitch, shift, saturate, sizeof(int32_t), 1 );
+}
+
+void scalar_mtx_conv_ubyte( uint8_t *output, uint8_t *input, const int32_t *coeffs, const int kernel_rows, const int kernel_cols, const int image_width, const int image_height, const int image_pitch, const int shift, const int saturate )
+{
+	scalar_mtx_conv( output, input, coeffs, kernel_rows, kernel_cols, image_width, image_height, image_pitch, shift, saturate, sizeof(uint8_t), 0 );
+}
+
+void scalar_mtx_conv_uhalf( uint16_t *output, uint16_t *input, const int32_t *coeffs, const int kernel_rows, const int kernel_cols, const int image_width, const int image_height, const int image_pitch, const int shift, const int saturate )
+{
+	scalar_mtx_conv( output, input, coeffs, kernel_rows, kernel_cols, image_width, image_height, image_pitch, shift, saturate, sizeof(uint16_t), 0 );
+}
+
+void scalar_mtx_conv_uword( uint32_t *output, uint32_t *input, const int32_t *coeffs, const int kernel_rows, const int kernel_cols, const int image_width, const int image_height, const int image_pitch, const int shift, const int saturate )
+{
+	scalar_mtx_conv( output, input, coeffs, kernel_rows, kernel_cols, image_width, image_height, image_pitch, shift, saturate, sizeof(uint32_t), 0 );
+}
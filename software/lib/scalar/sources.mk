@@ -1,3 +1,4 @@
+C_SRCS += scalar_mtx_conv.c
 C_SRCS += scalar_mtx_fir.c
 C_SRCS += scalar_mtx_median.c
 C_SRCS += scalar_mtx_median_argb32.c
@@ -0,0 +1,7 @@
+C_SRCS += vbxsim.c
+C_SRCS += vbxsim_exec.c
+C_SRCS += vbxsim_simd_generic.c
+C_SRCS += vbxsim_simd_avx2.c
+C_SRCS += vbxsim_simd_avx512.c
+C_SRCS += vbxsim_thread.c
+C_SRCS += vbxsim_timing.c
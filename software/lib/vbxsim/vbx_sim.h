@@ -0,0 +1,283 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**
+ * @file
+ * @defgroup VBX_sim VBX simulator
+ * @brief Host-native MXP instruction simulator
+ *
+ * Selected by vbx_asm_or_sim.h when VBX_SIMULATOR is defined. Every
+ * vbxasm* macro is turned into a call to vbxsim_instr(), which executes
+ * the whole (1D, 2D or 3D) vector instruction on the host before returning.
+ * Scratchpad pointers are ordinary host pointers into the simulated
+ * scratchpad allocated by vbxsim_init().
+ *
+ * @ingroup VBXapi
+ */
+/**@{*/
+
+#ifndef __VBX_SIM_H
+#define __VBX_SIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "vbx_types.h"
+
+// Instruction modifiers, OR'ed together
+#define VBXSIM_MOD_NONE    0x0
+#define VBXSIM_MOD_ACC     0x1
+#define VBXSIM_MOD_2D      0x2
+#define VBXSIM_MOD_3D      0x4
+
+// Type-mode encoding. Bits 0-4 match the MXP type-mode field:
+// bit 0 is signed, bits 1-2 the destination size and bits 3-4 the
+// source size (0=byte, 1=half, 2=word).
+#define VBXSIM_SIGNED      0x01
+#define VBXSIM_DST_SHIFT   1
+#define VBXSIM_SRC_SHIFT   3
+#define VBXSIM_SIZE_MASK   0x3
+#define VBXSIM_SCALAR_A    0x20 ///< srcA is a scalar (SV, SE)
+#define VBXSIM_ENUM_B      0x40 ///< srcB is the enumeration 0,1,2,... (VE, SE)
+
+#define VBXSIM_DST_BYTES(MODE)  (1<<(((MODE)>>VBXSIM_DST_SHIFT)&VBXSIM_SIZE_MASK))
+#define VBXSIM_SRC_BYTES(MODE)  (1<<(((MODE)>>VBXSIM_SRC_SHIFT)&VBXSIM_SIZE_MASK))
+
+// vector-vector
+#define VVBU_SIM   0
+#define VVBBU_SIM  0
+#define VVBS_SIM   1
+#define VVBBS_SIM  1
+#define VVB_SIM    1
+#define VVBB_SIM   1
+#define VVBHU_SIM  2
+#define VVBHS_SIM  3
+#define VVBH_SIM   3
+#define VVBWU_SIM  4
+#define VVBWS_SIM  5
+#define VVBW_SIM   5
+#define VVHBU_SIM  8
+#define VVHBS_SIM  9
+#define VVHB_SIM   9
+#define VVHU_SIM   10
+#define VVHHU_SIM  10
+#define VVHS_SIM   11
+#define VVHHS_SIM  11
+#define VVH_SIM    11
+#define VVHH_SIM   11
+#define VVHWU_SIM  12
+#define VVHWS_SIM  13
+#define VVHW_SIM   13
+#define VVWBU_SIM  16
+#define VVWBS_SIM  17
+#define VVWB_SIM   17
+#define VVWHU_SIM  18
+#define VVWHS_SIM  19
+#define VVWH_SIM   19
+#define VVWU_SIM   20
+#define VVWWU_SIM  20
+#define VVWS_SIM   21
+#define VVWWS_SIM  21
+#define VVW_SIM    21
+#define VVWW_SIM   21
+
+// scalar-vector
+#define SVBU_SIM   (VVBU_SIM|VBXSIM_SCALAR_A)
+#define SVBBU_SIM  (VVBBU_SIM|VBXSIM_SCALAR_A)
+#define SVBS_SIM   (VVBS_SIM|VBXSIM_SCALAR_A)
+#define SVBBS_SIM  (VVBBS_SIM|VBXSIM_SCALAR_A)
+#define SVB_SIM    (VVB_SIM|VBXSIM_SCALAR_A)
+#define SVBB_SIM   (VVBB_SIM|VBXSIM_SCALAR_A)
+#define SVBHU_SIM  (VVBHU_SIM|VBXSIM_SCALAR_A)
+#define SVBHS_SIM  (VVBHS_SIM|VBXSIM_SCALAR_A)
+#define SVBH_SIM   (VVBH_SIM|VBXSIM_SCALAR_A)
+#define SVBWU_SIM  (VVBWU_SIM|VBXSIM_SCALAR_A)
+#define SVBWS_SIM  (VVBWS_SIM|VBXSIM_SCALAR_A)
+#define SVBW_SIM   (VVBW_SIM|VBXSIM_SCALAR_A)
+#define SVHBU_SIM  (VVHBU_SIM|VBXSIM_SCALAR_A)
+#define SVHBS_SIM  (VVHBS_SIM|VBXSIM_SCALAR_A)
+#define SVHB_SIM   (VVHB_SIM|VBXSIM_SCALAR_A)
+#define SVHU_SIM   (VVHU_SIM|VBXSIM_SCALAR_A)
+#define SVHHU_SIM  (VVHHU_SIM|VBXSIM_SCALAR_A)
+#define SVHS_SIM   (VVHS_SIM|VBXSIM_SCALAR_A)
+#define SVHHS_SIM  (VVHHS_SIM|VBXSIM_SCALAR_A)
+#define SVH_SIM    (VVH_SIM|VBXSIM_SCALAR_A)
+#define SVHH_SIM   (VVHH_SIM|VBXSIM_SCALAR_A)
+#define SVHWU_SIM  (VVHWU_SIM|VBXSIM_SCALAR_A)
+#define SVHWS_SIM  (VVHWS_SIM|VBXSIM_SCALAR_A)
+#define SVHW_SIM   (VVHW_SIM|VBXSIM_SCALAR_A)
+#define SVWBU_SIM  (VVWBU_SIM|VBXSIM_SCALAR_A)
+#define SVWBS_SIM  (VVWBS_SIM|VBXSIM_SCALAR_A)
+#define SVWB_SIM   (VVWB_SIM|VBXSIM_SCALAR_A)
+#define SVWHU_SIM  (VVWHU_SIM|VBXSIM_SCALAR_A)
+#define SVWHS_SIM  (VVWHS_SIM|VBXSIM_SCALAR_A)
+#define SVWH_SIM   (VVWH_SIM|VBXSIM_SCALAR_A)
+#define SVWU_SIM   (VVWU_SIM|VBXSIM_SCALAR_A)
+#define SVWWU_SIM  (VVWWU_SIM|VBXSIM_SCALAR_A)
+#define SVWS_SIM   (VVWS_SIM|VBXSIM_SCALAR_A)
+#define SVWWS_SIM  (VVWWS_SIM|VBXSIM_SCALAR_A)
+#define SVW_SIM    (VVW_SIM|VBXSIM_SCALAR_A)
+#define SVWW_SIM   (VVWW_SIM|VBXSIM_SCALAR_A)
+
+// vector-enumerated
+#define VEBU_SIM   (VVBU_SIM|VBXSIM_ENUM_B)
+#define VEBBU_SIM  (VVBBU_SIM|VBXSIM_ENUM_B)
+#define VEBS_SIM   (VVBS_SIM|VBXSIM_ENUM_B)
+#define VEBBS_SIM  (VVBBS_SIM|VBXSIM_ENUM_B)
+#define VEB_SIM    (VVB_SIM|VBXSIM_ENUM_B)
+#define VEBB_SIM   (VVBB_SIM|VBXSIM_ENUM_B)
+#define VEBHU_SIM  (VVBHU_SIM|VBXSIM_ENUM_B)
+#define VEBHS_SIM  (VVBHS_SIM|VBXSIM_ENUM_B)
+#define VEBH_SIM   (VVBH_SIM|VBXSIM_ENUM_B)
+#define VEBWU_SIM  (VVBWU_SIM|VBXSIM_ENUM_B)
+#define VEBWS_SIM  (VVBWS_SIM|VBXSIM_ENUM_B)
+#define VEBW_SIM   (VVBW_SIM|VBXSIM_ENUM_B)
+#define VEHBU_SIM  (VVHBU_SIM|VBXSIM_ENUM_B)
+#define VEHBS_SIM  (VVHBS_SIM|VBXSIM_ENUM_B)
+#define VEHB_SIM   (VVHB_SIM|VBXSIM_ENUM_B)
+#define VEHU_SIM   (VVHU_SIM|VBXSIM_ENUM_B)
+#define VEHHU_SIM  (VVHHU_SIM|VBXSIM_ENUM_B)
+#define VEHS_SIM   (VVHS_SIM|VBXSIM_ENUM_B)
+#define VEHHS_SIM  (VVHHS_SIM|VBXSIM_ENUM_B)
+#define VEH_SIM    (VVH_SIM|VBXSIM_ENUM_B)
+#define VEHH_SIM   (VVHH_SIM|VBXSIM_ENUM_B)
+#define VEHWU_SIM  (VVHWU_SIM|VBXSIM_ENUM_B)
+#define VEHWS_SIM  (VVHWS_SIM|VBXSIM_ENUM_B)
+#define VEHW_SIM   (VVHW_SIM|VBXSIM_ENUM_B)
+#define VEWBU_SIM  (VVWBU_SIM|VBXSIM_ENUM_B)
+#define VEWBS_SIM  (VVWBS_SIM|VBXSIM_ENUM_B)
+#define VEWB_SIM   (VVWB_SIM|VBXSIM_ENUM_B)
+#define VEWHU_SIM  (VVWHU_SIM|VBXSIM_ENUM_B)
+#define VEWHS_SIM  (VVWHS_SIM|VBXSIM_ENUM_B)
+#define VEWH_SIM   (VVWH_SIM|VBXSIM_ENUM_B)
+#define VEWU_SIM   (VVWU_SIM|VBXSIM_ENUM_B)
+#define VEWWU_SIM  (VVWWU_SIM|VBXSIM_ENUM_B)
+#define VEWS_SIM   (VVWS_SIM|VBXSIM_ENUM_B)
+#define VEWWS_SIM  (VVWWS_SIM|VBXSIM_ENUM_B)
+#define VEW_SIM    (VVW_SIM|VBXSIM_ENUM_B)
+#define VEWW_SIM   (VVWW_SIM|VBXSIM_ENUM_B)
+
+// scalar-enumerated
+#define SEBU_SIM   (VVBU_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEBBU_SIM  (VVBBU_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEBS_SIM   (VVBS_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEBBS_SIM  (VVBBS_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEB_SIM    (VVB_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEBB_SIM   (VVBB_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEBHU_SIM  (VVBHU_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEBHS_SIM  (VVBHS_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEBH_SIM   (VVBH_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEBWU_SIM  (VVBWU_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEBWS_SIM  (VVBWS_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEBW_SIM   (VVBW_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEHBU_SIM  (VVHBU_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEHBS_SIM  (VVHBS_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEHB_SIM   (VVHB_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEHU_SIM   (VVHU_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEHHU_SIM  (VVHHU_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEHS_SIM   (VVHS_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEHHS_SIM  (VVHHS_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEH_SIM    (VVH_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEHH_SIM   (VVHH_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEHWU_SIM  (VVHWU_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEHWS_SIM  (VVHWS_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEHW_SIM   (VVHW_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEWBU_SIM  (VVWBU_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEWBS_SIM  (VVWBS_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEWB_SIM   (VVWB_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEWHU_SIM  (VVWHU_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEWHS_SIM  (VVWHS_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEWH_SIM   (VVWH_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEWU_SIM   (VVWU_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEWWU_SIM  (VVWWU_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEWS_SIM   (VVWS_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEWWS_SIM  (VVWWS_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEW_SIM    (VVW_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+#define SEWW_SIM   (VVWW_SIM|VBXSIM_SCALAR_A|VBXSIM_ENUM_B)
+/** Execute one vector instruction.
+ *
+ * @param[in] mods -- VBXSIM_MOD_* flags
+ * @param[in] mode -- one of the *_SIM type-mode encodings above
+ * @param[in] v_op -- instruction
+ * @param[in] dest -- destination scratchpad address
+ * @param[in] srcA -- source A scratchpad address, or scalar value
+ * @param[in] srcB -- source B scratchpad address (ignored for VE/SE)
+ */
+void vbxsim_instr( int mods, int mode, vinstr_t v_op, intptr_t dest, intptr_t srcA, intptr_t srcB );
+
+// Instruction and DMA statistics, used by vbx_counters.h
+unsigned vbxsim_get_instr_count( int instr );
+unsigned vbxsim_get_instr_cycles( int instr, int lanes );
+unsigned vbxsim_get_dma_count();
+unsigned vbxsim_get_dma_cycles( int width_words );
+unsigned vbxsim_get_total_cycles();
+unsigned vbxsim_get_instr_hazard_cycles();
+unsigned vbxsim_get_dma_hazard_cycles();
+unsigned vbxsim_get_dma_queue_stall_cycles();
+double   vbxsim_get_dma_efficiency(); ///< bytes moved per byte of DMA bandwidth while the DMA engine was busy
+void     vbxsim_reset_counts();
+void     vbxsim_print_counts();
+
+#define _vbxasm(VMODE,VINSTR,DEST,SRCA,SRCB) \
+	vbxsim_instr(VBXSIM_MOD_NONE,VMODE##_SIM,VINSTR,(intptr_t)(DEST),(intptr_t)(SRCA),(intptr_t)(SRCB))
+#define _vbxasm_acc(VMODE,VINSTR,DEST,SRCA,SRCB) \
+	vbxsim_instr(VBXSIM_MOD_ACC,VMODE##_SIM,VINSTR,(intptr_t)(DEST),(intptr_t)(SRCA),(intptr_t)(SRCB))
+#define _vbxasm_2D(VMODE,VINSTR,DEST,SRCA,SRCB) \
+	vbxsim_instr(VBXSIM_MOD_2D,VMODE##_SIM,VINSTR,(intptr_t)(DEST),(intptr_t)(SRCA),(intptr_t)(SRCB))
+#define _vbxasm_acc_2D(VMODE,VINSTR,DEST,SRCA,SRCB) \
+	vbxsim_instr(VBXSIM_MOD_ACC|VBXSIM_MOD_2D,VMODE##_SIM,VINSTR,(intptr_t)(DEST),(intptr_t)(SRCA),(intptr_t)(SRCB))
+#define _vbxasm_3D(VMODE,VINSTR,DEST,SRCA,SRCB) \
+	vbxsim_instr(VBXSIM_MOD_2D|VBXSIM_MOD_3D,VMODE##_SIM,VINSTR,(intptr_t)(DEST),(intptr_t)(SRCA),(intptr_t)(SRCB))
+#define _vbxasm_acc_3D(VMODE,VINSTR,DEST,SRCA,SRCB) \
+	vbxsim_instr(VBXSIM_MOD_ACC|VBXSIM_MOD_2D|VBXSIM_MOD_3D,VMODE##_SIM,VINSTR,(intptr_t)(DEST),(intptr_t)(SRCA),(intptr_t)(SRCB))
+
+// NOTE: the double-macro calling is required to ensure macro arguments are fully expanded.
+#define vbxasm(VMODE,VINSTR,DEST,SRCA,SRCB)             _vbxasm(VMODE,VINSTR,DEST,SRCA,SRCB)
+#define vbxasm_acc(VMODE,VINSTR,DEST,SRCA,SRCB)         _vbxasm_acc(VMODE,VINSTR,DEST,SRCA,SRCB)
+#define vbxasm_2D(VMODE,VINSTR,DEST,SRCA,SRCB)          _vbxasm_2D(VMODE,VINSTR,DEST,SRCA,SRCB)
+#define vbxasm_acc_2D(VMODE,VINSTR,DEST,SRCA,SRCB)      _vbxasm_acc_2D(VMODE,VINSTR,DEST,SRCA,SRCB)
+#define vbxasm_3D(VMODE,VINSTR,DEST,SRCA,SRCB)          _vbxasm_3D(VMODE,VINSTR,DEST,SRCA,SRCB)
+#define vbxasm_acc_3D(VMODE,VINSTR,DEST,SRCA,SRCB)      _vbxasm_acc_3D(VMODE,VINSTR,DEST,SRCA,SRCB)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __VBX_SIM_H
+/**@}*/
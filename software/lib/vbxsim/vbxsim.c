@@ -0,0 +1,447 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**@file*/
+
+#include "vbx_copyright.h"
+VBXCOPYRIGHT( vbxsim )
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "vbx.h"
+#include "vbx_port.h"
+#include "vbxsim_state.h"
+#include "vbxsim_simd.h"
+
+#ifndef VBXSIM_CORE_FREQ
+#define VBXSIM_CORE_FREQ 100000000 ///< simulated MXP clock, used to convert host time to MXP cycles
+#endif
+
+#ifndef VBXSIM_MEMORY_WIDTH_LANES
+#define VBXSIM_MEMORY_WIDTH_LANES 0 ///< DMA width in 32-bit words; 0 means one word per vector lane
+#endif
+
+vbxsim_state_t vbxsim;
+
+// --------------------------------------------------------
+// Host timestamp
+//
+// Timestamps normally come from the host clock. With VBXSIM_CLOCK=model
+// they follow the timing model instead: host time spent outside the
+// simulator, plus the modelled time the host spends issuing commands and
+// waiting in vbx_sync(). Vector code is then timed as the MXP would run it.
+
+static uint64_t host_ns()
+{
+	struct timespec ts;
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+uint64_t vbxsim_clock_enter()
+{
+	return vbxsim.clock_model ? host_ns() : 0;
+}
+
+void vbxsim_clock_leave( uint64_t start )
+{
+	if( vbxsim.clock_model )
+		vbxsim.sim_ns += host_ns() - start;
+}
+
+int vbx_timestamp_start()
+{
+	return 0;
+}
+
+uint32_t vbx_timestamp_freq()
+{
+	return 1000000000;
+}
+
+vbx_timestamp_t vbx_timestamp()
+{
+	if( !vbxsim.clock_model )
+		return host_ns();
+	return host_ns() - vbxsim.sim_ns +
+	       (vbx_timestamp_t)((double)vbxsim_timing_host() * 1e9 / vbxsim.mxp.core_freq);
+}
+
+// --------------------------------------------------------
+// Initialization
+
+void vbxsim_init( int num_lanes,
+                  int scratchpad_capacity_kb,
+                  int fxp_word_frac_bits,
+                  int fxp_half_frac_bits,
+                  int fxp_byte_frac_bits )
+{
+	static int stats_registered = 0;
+	vbx_mxp_t *this_mxp = &vbxsim.mxp;
+	int size = scratchpad_capacity_kb*1024;
+	const char *clock = getenv( "VBXSIM_CLOCK" );
+	uint8_t *sp;
+
+	if( vbxsim.flags ) {
+		vbxsim_destroy();
+	}
+
+	// align the scratchpad to the widest configuration so that the
+	// alignment of scratchpad addresses behaves as on hardware
+	if( posix_memalign( (void **)&sp, 4096, size ) ) {
+		sp = NULL;
+	}
+	vbxsim.flags = (uint8_t *)calloc( size, 1 );
+	if( !sp || !vbxsim.flags ) {
+		VBX_PRINTF( "ERROR: failed to allocate %d KB simulated scratchpad.\n", scratchpad_capacity_kb );
+		VBX_FATAL( __LINE__, __FILE__, -1 );
+	}
+	memset( sp, 0, size );
+
+	memset( this_mxp, 0, sizeof(*this_mxp) );
+	this_mxp->scratchpad_addr            = sp;
+	this_mxp->scratchpad_end             = sp + size;
+	this_mxp->scratchpad_size            = size;
+	this_mxp->core_freq                  = VBXSIM_CORE_FREQ;
+	this_mxp->dma_alignment_bytes        = 4*(VBXSIM_MEMORY_WIDTH_LANES ? VBXSIM_MEMORY_WIDTH_LANES : num_lanes);
+	this_mxp->scratchpad_alignment_bytes = 4*num_lanes;
+	this_mxp->vector_lanes               = num_lanes;
+	this_mxp->vci_lanes                  = 0;
+	this_mxp->vci_enabled                = 0;
+	this_mxp->fxp_word_frac_bits         = fxp_word_frac_bits;
+	this_mxp->fxp_half_frac_bits         = fxp_half_frac_bits;
+	this_mxp->fxp_byte_frac_bits         = fxp_byte_frac_bits;
+	this_mxp->sp                         = sp;
+
+	memset( vbxsim.reg, 0, sizeof(vbxsim.reg) );
+	vbxsim.geom.vl    = 1;
+	vbxsim.geom.nrows = 1;
+	vbxsim.geom.nmats = 1;
+	vbxsim.mark       = 0;
+	vbxsim.clock_model = clock && !strcmp( clock, "model" );
+	vbxsim.sim_ns      = 0;
+	vbxsim_reset_counts();
+	vbxsim_simd_select();
+	vbxsim_threads_init( 0 );
+
+	// VBXSIM_STATS=1 prints the counters when the program exits
+	if( !stats_registered && getenv( "VBXSIM_STATS" ) && atoi( getenv( "VBXSIM_STATS" ) ) ) {
+		atexit( vbxsim_print_counts );
+		stats_registered = 1;
+	}
+
+	_vbx_init( this_mxp );
+}
+
+void vbxsim_destroy()
+{
+	vbx_mxp_t *this_mxp = &vbxsim.mxp;
+
+	vbxsim_threads_destroy();
+	free( this_mxp->spstack );
+	free( this_mxp->scratchpad_addr );
+	free( vbxsim.flags );
+	memset( this_mxp, 0, sizeof(*this_mxp) );
+	vbxsim.flags = NULL;
+#if VBX_USE_GLOBAL_MXP_PTR
+	vbx_mxp_ptr = NULL;
+#endif
+}
+
+// --------------------------------------------------------
+// Registers and instruction setup
+
+void vbx_sync()
+{
+	// instructions and DMA transfers complete before they return;
+	// only the timing model has to wait for them
+	vbxsim_timing_sync();
+}
+
+vbx_fence_t vbx_fence()
+{
+	return vbxsim_timing_fence();
+}
+
+int vbx_fence_done( vbx_fence_t fence )
+{
+	return vbxsim_timing_fence_done( fence );
+}
+
+void vbx_fence_wait( vbx_fence_t fence )
+{
+	vbxsim_timing_fence_wait( fence );
+}
+
+void vbx_set_vl_nodebug( int LENGTH )
+{
+	vbxsim.geom.vl = LENGTH;
+	vbxsim_timing_setup();
+}
+
+void vbx_get_vl( int *LENGTH )
+{
+	*LENGTH = vbxsim.geom.vl;
+}
+
+void vbx_set_reg( int REGADDR, int VALUE )
+{
+	if( 0 <= REGADDR && REGADDR < VBXSIM_NUM_REGS )
+		vbxsim.reg[REGADDR] = VALUE;
+}
+
+void vbx_get_reg( int REGADDR, int *VALUE )
+{
+	*VALUE = (0 <= REGADDR && REGADDR < VBXSIM_NUM_REGS) ? vbxsim.reg[REGADDR] : 0;
+}
+
+void vbx_set_2D_nodebug( int ROWS, int ID, int IA, int IB )
+{
+	vbxsim.geom.nrows = ROWS;
+	vbxsim.geom.id2   = ID;
+	vbxsim.geom.ia2   = IA;
+	vbxsim.geom.ib2   = IB;
+	vbxsim_timing_setup();
+}
+
+void vbx_set_3D_nodebug( int MATS, int ID3D, int IA3D, int IB3D )
+{
+	vbxsim.geom.nmats = MATS;
+	vbxsim.geom.id3   = ID3D;
+	vbxsim.geom.ia3   = IA3D;
+	vbxsim.geom.ib3   = IB3D;
+	vbxsim_timing_setup();
+}
+
+void vbx_get_2D( int *ROWS, int *ID, int *IA, int *IB )
+{
+	*ROWS = vbxsim.geom.nrows;
+	*ID   = vbxsim.geom.id2;
+	*IA   = vbxsim.geom.ia2;
+	*IB   = vbxsim.geom.ib2;
+}
+
+void vbx_get_3D( int *MATS, int *ID3D, int *IA3D, int *IB3D )
+{
+	*MATS = vbxsim.geom.nmats;
+	*ID3D = vbxsim.geom.id3;
+	*IA3D = vbxsim.geom.ia3;
+	*IB3D = vbxsim.geom.ib3;
+}
+
+// --------------------------------------------------------
+// DMA
+
+void vbxsim_dma_flags( const void *v_dst, int num_bytes )
+{
+	const uint8_t *s = (const uint8_t *)v_dst;
+	uint8_t *f = vbxsim_flag_ptr( v_dst );
+	int i;
+	for( i = 0; i < num_bytes; i++ )
+		f[i] = s[i] >> 7;
+}
+
+// Statistics and timing of a DMA transfer of num_rows rows of num_bytes
+static void dma_account( int to_host, const void *v_addr, const void *ext, int num_bytes, int num_rows,
+                         int32_t v_stride, int32_t ext_stride )
+{
+	const int width = vbxsim.mxp.dma_alignment_bytes;
+	const int64_t last = num_rows > 1 ? (int64_t)(num_rows-1) * v_stride : 0;
+	vbxsim_range_t sp;
+
+	vbxsim.dma_count++;
+	vbxsim.dma_cycles += (uint64_t)num_rows * ((num_bytes + width-1) / width);
+	vbxsim.dma_bytes  += (uint64_t)num_rows * num_bytes;
+
+	sp.lo = (const uint8_t *)v_addr + (last < 0 ? last : 0);
+	sp.hi = (const uint8_t *)v_addr + (last > 0 ? last : 0) + num_bytes;
+	vbxsim_timing_dma( to_host, &sp, ext, num_bytes, num_rows, ext_stride );
+}
+
+void vbx_dma_to_host_nodebug( void *EXT, vbx_void_t *INT, int LENGTH )
+{
+	uint64_t clock = vbxsim_clock_enter();
+	memcpy( EXT, INT, LENGTH );
+	dma_account( 1, INT, EXT, LENGTH, 1, 0, 0 );
+	vbxsim_clock_leave( clock );
+}
+
+void vbx_dma_to_host_aligned( void *EXT, vbx_void_t *INT, int LENGTH )
+{
+	vbx_dma_to_host_nodebug( EXT, INT, LENGTH );
+}
+
+void vbx_dma_to_vector_nodebug( vbx_void_t *INT, void *EXT, int LENGTH )
+{
+	uint64_t clock = vbxsim_clock_enter();
+	memcpy( INT, EXT, LENGTH );
+	vbxsim_dma_flags( INT, LENGTH );
+	dma_account( 0, INT, EXT, LENGTH, 1, 0, 0 );
+	vbxsim_clock_leave( clock );
+}
+
+void vbx_dma_to_vector_aligned( vbx_void_t *INT, void *EXT, int LENGTH )
+{
+	vbx_dma_to_vector_nodebug( INT, EXT, LENGTH );
+}
+
+void vbx_dma_to_host_2D( void *dst, vbx_void_t *v_src, uint32_t xlen, uint32_t ylen,
+                         int32_t dst_stride, int32_t src_stride )
+{
+	uint64_t clock = vbxsim_clock_enter();
+	uint32_t y;
+	for( y = 0; y < ylen; y++ ) {
+		memcpy( (uint8_t *)dst + y*dst_stride, (uint8_t *)v_src + y*src_stride, xlen );
+	}
+	dma_account( 1, v_src, dst, xlen, ylen, src_stride, dst_stride );
+	vbxsim_clock_leave( clock );
+}
+
+void vbx_dma_to_vector_2D( vbx_void_t *v_dst, void *src, uint32_t xlen, uint32_t ylen,
+                           int32_t dst_stride, int32_t src_stride )
+{
+	uint64_t clock = vbxsim_clock_enter();
+	uint32_t y;
+	for( y = 0; y < ylen; y++ ) {
+		uint8_t *v_row = (uint8_t *)v_dst + y*dst_stride;
+		memcpy( v_row, (uint8_t *)src + y*src_stride, xlen );
+		vbxsim_dma_flags( v_row, xlen );
+	}
+	dma_account( 0, v_dst, src, xlen, ylen, dst_stride, src_stride );
+	vbxsim_clock_leave( clock );
+}
+
+// --------------------------------------------------------
+// Scratchpad helpers
+
+void vbx_sp_mark( uint32_t mark )
+{
+	vbxsim.mark = mark;
+}
+
+int vbx_sp_checkmark( uint32_t mark )
+{
+	return vbxsim.mark == mark;
+}
+
+vbx_void_t *vbx_sp_malloc_extra( size_t num_bytes )
+{
+	return vbx_sp_malloc_nodebug( num_bytes );
+}
+
+void vbx_sp_free_extra( vbx_void_t *old_sp )
+{
+	vbx_sp_set_nodebug( old_sp );
+}
+
+// --------------------------------------------------------
+// Statistics
+
+unsigned vbxsim_get_instr_count( int instr )
+{
+	unsigned count = 0;
+	int i;
+	if( instr >= 0 )
+		return instr < VBXSIM_NUM_INSTR ? vbxsim.instr_count[instr] : 0;
+	for( i = 0; i < VBXSIM_NUM_INSTR; i++ )
+		count += vbxsim.instr_count[i];
+	return count;
+}
+
+unsigned vbxsim_get_instr_cycles( int instr, int lanes )
+{
+	uint64_t cycles = 0;
+	int i;
+	if( instr >= 0 ) {
+		cycles = instr < VBXSIM_NUM_INSTR ? vbxsim.instr_cycles[instr] : 0;
+	} else {
+		for( i = 0; i < VBXSIM_NUM_INSTR; i++ )
+			cycles += vbxsim.instr_cycles[i];
+	}
+	// cycles were counted at the simulated lane count; rescale if asked for another
+	if( lanes > 0 && lanes != vbxsim.mxp.vector_lanes )
+		cycles = cycles * vbxsim.mxp.vector_lanes / lanes;
+	return (unsigned)cycles;
+}
+
+unsigned vbxsim_get_dma_count()
+{
+	return vbxsim.dma_count;
+}
+
+unsigned vbxsim_get_dma_cycles( int width_words )
+{
+	uint64_t cycles = vbxsim.dma_cycles;
+	if( width_words > 0 && 4*width_words != vbxsim.mxp.dma_alignment_bytes )
+		cycles = cycles * vbxsim.mxp.dma_alignment_bytes / (4*width_words);
+	return (unsigned)cycles;
+}
+
+double vbxsim_get_dma_efficiency()
+{
+	const uint64_t busy = vbxsim_timing_dma_busy();
+	if( !busy )
+		return 0.0;
+	return (double)vbxsim.dma_bytes / ((double)busy * vbxsim.mxp.dma_alignment_bytes);
+}
+
+void vbxsim_reset_counts()
+{
+	memset( vbxsim.instr_count,  0, sizeof(vbxsim.instr_count) );
+	memset( vbxsim.instr_cycles, 0, sizeof(vbxsim.instr_cycles) );
+	vbxsim.dma_count  = 0;
+	vbxsim.dma_cycles = 0;
+	vbxsim.dma_bytes  = 0;
+	vbxsim_timing_reset();
+}
+
+void vbxsim_print_counts()
+{
+	printf( "Simulated instructions: %u\n", vbxsim_get_instr_count(-1) );
+	printf( "Simulated instruction cycles: %u\n", vbxsim_get_instr_cycles(-1,vbxsim.mxp.vector_lanes) );
+	printf( "Simulated DMA transfers: %u\n", vbxsim_get_dma_count() );
+	printf( "Simulated DMA cycles: %u\n", vbxsim_get_dma_cycles(vbxsim.mxp.dma_alignment_bytes/4) );
+	printf( "Simulated total cycles: %u\n", vbxsim_get_total_cycles() );
+	printf( "Simulated instruction hazard cycles: %u\n", vbxsim_get_instr_hazard_cycles() );
+	printf( "Simulated DMA hazard cycles: %u\n", vbxsim_get_dma_hazard_cycles() );
+	printf( "Simulated DMA queue stall cycles: %u\n", vbxsim_get_dma_queue_stall_cycles() );
+	printf( "Simulated DMA efficiency: %.3f\n", vbxsim_get_dma_efficiency() );
+	printf( "Simulator kernels: %s\n", vbxsim_simd_name() );
+	printf( "Simulator threads: %d\n", vbxsim_num_threads() );
+}
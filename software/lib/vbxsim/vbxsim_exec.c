@@ -0,0 +1,703 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**@file*/
+
+#include "vbx_copyright.h"
+VBXCOPYRIGHT( vbxsim_exec )
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "vbx.h"
+#include "vbxsim_state.h"
+#include "vbxsim_simd.h"
+
+// Instructions are executed in chunks of VBXSIM_CHUNK elements. Each chunk
+// is widened into 32-bit temporaries, computed and narrowed back into the
+// scratchpad, one simple loop per step so the host compiler can vectorize
+// every step.
+#define VBXSIM_CHUNK 256
+
+// Scratchpad operands need not be naturally aligned (eg. a word vector
+// starting at an odd byte address), so access them through unaligned types.
+typedef uint16_t __attribute__((aligned(1),may_alias)) vbxsim_u16_t;
+typedef int16_t  __attribute__((aligned(1),may_alias)) vbxsim_s16_t;
+typedef uint32_t __attribute__((aligned(1),may_alias)) vbxsim_u32_t;
+
+/** Decoded instruction */
+typedef struct {
+	vinstr_t op;
+	int      is_signed;
+	int      src_bytes;
+	int      dst_bytes;
+	int      bits;       ///< operating width in bits: max(src,dst)
+	int      scalar_a;
+	int      enum_b;
+	int      uses_b;
+	int      uses_flags; ///< instruction reads the flags of srcB
+	int      frac_bits;
+	int32_t  scalar;     ///< srcA scalar, reduced to the operating width
+	vbxsim_kernel_t kernel; ///< specialized kernel, or NULL for the reference engine
+} vbxsim_op_t;
+
+/** Reduce @a x to @a bits, then sign or zero extend it back to 32 bits */
+static inline int32_t vbxsim_extend( int32_t x, int bits, int is_signed )
+{
+	if( bits >= 32 )
+		return x;
+	if( is_signed )
+		return (int32_t)((uint32_t)x << (32-bits)) >> (32-bits);
+	return (int32_t)((uint32_t)x & ((1u<<bits)-1));
+}
+
+// --------------------------------------------------------
+// Widen a chunk of a scratchpad operand to 32 bits
+
+static void load_src( int32_t *restrict t, const void *p, int n, int bytes, int is_signed )
+{
+	int i;
+	switch( bytes*2 + is_signed ) {
+	case 2: { const uint8_t      *s = p; for( i = 0; i < n; i++ ) t[i] = s[i]; } break;
+	case 3: { const int8_t       *s = p; for( i = 0; i < n; i++ ) t[i] = s[i]; } break;
+	case 4: { const vbxsim_u16_t *s = p; for( i = 0; i < n; i++ ) t[i] = s[i]; } break;
+	case 5: { const vbxsim_s16_t *s = p; for( i = 0; i < n; i++ ) t[i] = s[i]; } break;
+	default:  memcpy( t, p, n*sizeof(int32_t) ); break;
+	}
+}
+
+static void load_flags( uint8_t *restrict f, const uint8_t *pf, int n, int bytes )
+{
+	int i;
+	pf += bytes-1; // the flag of an element is the flag of its most significant byte
+	for( i = 0; i < n; i++ )
+		f[i] = pf[i*bytes];
+}
+
+// --------------------------------------------------------
+// Narrow a chunk of 32-bit results into the scratchpad
+
+static void store_dst( void *p, uint8_t *pf, const int32_t *restrict r,
+                       const uint8_t *restrict f, int n, int bytes )
+{
+	int i, k;
+	switch( bytes ) {
+	case 1: { uint8_t      *d = p; for( i = 0; i < n; i++ ) d[i] = r[i]; } break;
+	case 2: { vbxsim_u16_t *d = p; for( i = 0; i < n; i++ ) d[i] = r[i]; } break;
+	default:  memcpy( p, r, n*sizeof(int32_t) ); break;
+	}
+	if( bytes == 1 ) {
+		memcpy( pf, f, n );
+	} else {
+		for( i = 0; i < n; i++ )
+			for( k = 0; k < bytes; k++ )
+				pf[i*bytes+k] = f[i];
+	}
+}
+
+// Conditional move: only elements with m[i] set are written
+static void store_dst_masked( void *p, uint8_t *pf, const int32_t *restrict r,
+                              const uint8_t *restrict f, const uint8_t *restrict m,
+                              int n, int bytes )
+{
+	int i, k;
+	switch( bytes ) {
+	case 1: { uint8_t      *d = p; for( i = 0; i < n; i++ ) d[i] = m[i] ? (uint8_t)r[i]  : d[i]; } break;
+	case 2: { vbxsim_u16_t *d = p; for( i = 0; i < n; i++ ) d[i] = m[i] ? (uint16_t)r[i] : d[i]; } break;
+	default:{ vbxsim_u32_t *d = p; for( i = 0; i < n; i++ ) d[i] = m[i] ? (uint32_t)r[i] : d[i]; } break;
+	}
+	for( i = 0; i < n; i++ )
+		for( k = 0; k < bytes; k++ )
+			pf[i*bytes+k] = m[i] ? f[i] : pf[i*bytes+k];
+}
+
+// Accumulated result of a row: one element, flagged by its MSB
+static void store_sum( void *p, uint32_t sum, int bytes )
+{
+	const int32_t r = (int32_t)sum;
+	const uint8_t f = (sum >> (8*bytes-1)) & 1;
+	store_dst( p, vbxsim_flag_ptr(p), &r, &f, 1, bytes );
+}
+
+// --------------------------------------------------------
+// Compute one chunk. Operands are already extended from the operating width.
+// Returns 1 if the result is conditional, with the condition left in m[].
+
+static int compute( const vbxsim_op_t *o, int n,
+                    const int32_t *restrict a, const int32_t *restrict b, const uint8_t *restrict fb,
+                    int32_t *restrict r, uint8_t *restrict f, uint8_t *restrict m )
+{
+	const int bits = o->bits;
+	const int sh   = bits & 31; // carry position; 0 for word operations, which use 64-bit sums
+	const uint32_t amask = bits-1;
+	int i, carry_flag = 0, masked = 0;
+
+	switch( o->op ) {
+	case VMOV:
+		memcpy( r, a, n*sizeof(int32_t) );
+		break;
+	case VAND:
+		for( i = 0; i < n; i++ ) r[i] = a[i] & b[i];
+		break;
+	case VOR:
+		for( i = 0; i < n; i++ ) r[i] = a[i] | b[i];
+		break;
+	case VXOR:
+		for( i = 0; i < n; i++ ) r[i] = a[i] ^ b[i];
+		break;
+
+	// Add and subtract set the flag to the carry/borrow (unsigned), or to the
+	// true sign of the result (signed), computed from the bit above the
+	// operating width.
+	case VADD:
+	case VADDC:
+	case VSUB:
+	case VSUBB:
+		carry_flag = 1;
+		if( bits < 32 ) {
+			switch( o->op ) {
+			case VADD:  for( i = 0; i < n; i++ ) r[i] = a[i] + b[i];         break;
+			case VSUB:  for( i = 0; i < n; i++ ) r[i] = a[i] - b[i];         break;
+			case VADDC: for( i = 0; i < n; i++ ) r[i] = a[i] + b[i] + fb[i]; break;
+			default:    for( i = 0; i < n; i++ ) r[i] = a[i] - b[i] - fb[i]; break;
+			}
+			for( i = 0; i < n; i++ ) f[i] = (r[i] >> sh) & 1;
+		} else if( o->is_signed ) {
+			for( i = 0; i < n; i++ ) {
+				int64_t s;
+				switch( o->op ) {
+				case VADD:  s = (int64_t)a[i] + b[i];         break;
+				case VSUB:  s = (int64_t)a[i] - b[i];         break;
+				case VADDC: s = (int64_t)a[i] + b[i] + fb[i]; break;
+				default:    s = (int64_t)a[i] - b[i] - fb[i]; break;
+				}
+				r[i] = (int32_t)s;
+				f[i] = (s >> 32) & 1;
+			}
+		} else {
+			for( i = 0; i < n; i++ ) {
+				int64_t s;
+				switch( o->op ) {
+				case VADD:  s = (int64_t)(uint32_t)a[i] + (uint32_t)b[i];         break;
+				case VSUB:  s = (int64_t)(uint32_t)a[i] - (uint32_t)b[i];         break;
+				case VADDC: s = (int64_t)(uint32_t)a[i] + (uint32_t)b[i] + fb[i]; break;
+				default:    s = (int64_t)(uint32_t)a[i] - (uint32_t)b[i] - fb[i]; break;
+				}
+				r[i] = (int32_t)s;
+				f[i] = (s >> 32) & 1;
+			}
+		}
+		break;
+
+	case VMUL:
+		for( i = 0; i < n; i++ ) r[i] = (int32_t)((uint32_t)a[i] * (uint32_t)b[i]);
+		break;
+	case VMULHI:
+	case VMULFXP: {
+		const int shift = (o->op == VMULHI) ? bits : o->frac_bits;
+		if( o->is_signed ) {
+			for( i = 0; i < n; i++ ) r[i] = (int32_t)(((int64_t)a[i] * b[i]) >> shift);
+		} else {
+			for( i = 0; i < n; i++ ) r[i] = (int32_t)(((uint64_t)(uint32_t)a[i] * (uint32_t)b[i]) >> shift);
+		}
+		break;
+	}
+
+	// Shifts and rotates operate on srcB by the amount in srcA
+	case VSHL:
+		for( i = 0; i < n; i++ ) r[i] = (int32_t)((uint32_t)b[i] << (a[i] & amask));
+		break;
+	case VSHR:
+		if( o->is_signed ) {
+			for( i = 0; i < n; i++ ) r[i] = b[i] >> (a[i] & amask);
+		} else {
+			for( i = 0; i < n; i++ ) r[i] = (int32_t)((uint32_t)b[i] >> (a[i] & amask));
+		}
+		break;
+	case VROTL:
+	case VROTR: {
+		const uint64_t vmask = (bits < 32) ? ((1u<<bits)-1) : 0xffffffffu;
+		for( i = 0; i < n; i++ ) {
+			uint64_t x = (uint32_t)b[i] & vmask;
+			uint32_t s = a[i] & amask;
+			if( o->op == VROTR )
+				s = (bits - s) & amask;
+			r[i] = (int32_t)((x << s) | (x >> (bits - s)));
+		}
+		break;
+	}
+
+	case VABSDIFF:
+		if( o->is_signed ) {
+			for( i = 0; i < n; i++ ) {
+				int64_t d = (int64_t)a[i] - b[i];
+				r[i] = (int32_t)(d < 0 ? -d : d);
+			}
+		} else {
+			for( i = 0; i < n; i++ ) {
+				uint32_t x = a[i], y = b[i];
+				r[i] = (int32_t)(x > y ? x - y : y - x);
+			}
+		}
+		break;
+
+	// Conditional moves test srcB: its flag for the sign, its value for zero
+	case VCMV_LEZ:
+		for( i = 0; i < n; i++ ) m[i] = fb[i] | (b[i] == 0);
+		goto cmv;
+	case VCMV_GTZ:
+		for( i = 0; i < n; i++ ) m[i] = !fb[i] & (b[i] != 0);
+		goto cmv;
+	case VCMV_LTZ:
+		for( i = 0; i < n; i++ ) m[i] = fb[i];
+		goto cmv;
+	case VCMV_GEZ:
+		for( i = 0; i < n; i++ ) m[i] = !fb[i];
+		goto cmv;
+	case VCMV_Z:
+		for( i = 0; i < n; i++ ) m[i] = (b[i] == 0);
+		goto cmv;
+	case VCMV_NZ:
+		for( i = 0; i < n; i++ ) m[i] = (b[i] != 0);
+	cmv:
+		memcpy( r, a, n*sizeof(int32_t) );
+		masked = 1;
+		break;
+
+	default:
+		// VCUSTOM0-3 are implemented by optional custom hardware (VCI)
+		// which is not modelled; the destination is left untouched.
+		for( i = 0; i < n; i++ ) {
+			m[i] = 0;
+			r[i] = 0;
+		}
+		masked = 1;
+		break;
+	}
+
+	if( !carry_flag ) {
+		for( i = 0; i < n; i++ )
+			f[i] = ((uint32_t)r[i] >> (bits-1)) & 1;
+	}
+	return masked;
+}
+
+// --------------------------------------------------------
+// Kernel selection
+
+const vbxsim_kernel_table_t *vbxsim_kernels;
+static const char *vbxsim_kernels_name = "none";
+
+void vbxsim_simd_select()
+{
+	const char *isa = getenv( "VBXSIM_ISA" );
+
+	vbxsim_kernels      = &vbxsim_kernels_generic;
+	vbxsim_kernels_name = "generic";
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+	if( isa ? !strcmp( isa, "avx512" ) : __builtin_cpu_supports( "avx512bw" ) ) {
+		vbxsim_kernels      = &vbxsim_kernels_avx512;
+		vbxsim_kernels_name = "avx512";
+	} else if( isa ? !strcmp( isa, "avx2" ) : __builtin_cpu_supports( "avx2" ) ) {
+		vbxsim_kernels      = &vbxsim_kernels_avx2;
+		vbxsim_kernels_name = "avx2";
+	}
+#endif
+	if( isa && !strcmp( isa, "none" ) ) {
+		vbxsim_kernels      = NULL;
+		vbxsim_kernels_name = "none";
+	}
+}
+
+const char *vbxsim_simd_name()
+{
+	return vbxsim_kernels_name;
+}
+
+// A kernel reads a source element and writes the destination element in the
+// same step, which matches the MXP only if the source does not overlap the
+// destination, or is exactly the destination.
+static inline int kernel_safe( const uint8_t *d, int dlen, const uint8_t *s, int slen )
+{
+	return s + slen <= d || d + dlen <= s || (s == d && slen == dlen);
+}
+
+// --------------------------------------------------------
+// Execute one row (1D vector) of an instruction, or a piece of one starting
+// at element number @a enum0. With @a acc, returns the sum of the results
+// instead of writing them.
+
+static uint32_t exec_row( const vbxsim_op_t *o, uint8_t *d, const uint8_t *sa, const uint8_t *sb,
+                          int vl, int acc, int enum0 )
+{
+	int32_t a[VBXSIM_CHUNK], b[VBXSIM_CHUNK], r[VBXSIM_CHUNK];
+	uint8_t fb[VBXSIM_CHUNK], f[VBXSIM_CHUNK], m[VBXSIM_CHUNK];
+	const int sbytes = o->src_bytes;
+	const int dbytes = o->dst_bytes;
+	uint32_t sum = 0;
+	int i, start, n, masked;
+
+	if( o->kernel &&
+	    ( acc ||
+	      ( (o->scalar_a || kernel_safe( d, vl*dbytes, sa, vl*sbytes )) &&
+	        (!o->uses_b  || kernel_safe( d, vl*dbytes, sb, vl*sbytes )) ) ) ) {
+		return o->kernel( d, sa, sb, o->scalar, vl, acc, o->frac_bits );
+	}
+
+	// The MXP reads a source element before the destination overwrites it.
+	// If the destination overlaps a source further along in memory, walk
+	// the chunks backwards so that property holds across chunks too.
+	int backwards = !acc &&
+		( (!o->scalar_a && d > sa && d < sa + vl*sbytes) ||
+		  ( o->uses_b && !o->enum_b && d > sb && d < sb + vl*sbytes) );
+
+	int nchunks = (vl + VBXSIM_CHUNK-1) / VBXSIM_CHUNK;
+	int c;
+	for( c = 0; c < nchunks; c++ ) {
+		start = (backwards ? nchunks-1-c : c) * VBXSIM_CHUNK;
+		n = vl - start;
+		if( n > VBXSIM_CHUNK )
+			n = VBXSIM_CHUNK;
+
+		if( o->scalar_a ) {
+			for( i = 0; i < n; i++ ) a[i] = o->scalar;
+		} else {
+			load_src( a, sa + start*sbytes, n, sbytes, o->is_signed );
+		}
+		if( o->enum_b ) {
+			for( i = 0; i < n; i++ ) b[i] = vbxsim_extend( enum0+start+i, o->bits, o->is_signed );
+			memset( fb, 0, n );
+		} else if( o->uses_b ) {
+			load_src( b, sb + start*sbytes, n, sbytes, o->is_signed );
+			if( o->uses_flags )
+				load_flags( fb, vbxsim_flag_ptr(sb + start*sbytes), n, sbytes );
+		}
+
+		masked = compute( o, n, a, b, fb, r, f, m );
+
+		if( acc ) {
+			if( masked ) {
+				for( i = 0; i < n; i++ ) sum += m[i] ? (uint32_t)r[i] : 0;
+			} else {
+				for( i = 0; i < n; i++ ) sum += (uint32_t)r[i];
+			}
+		} else if( masked ) {
+			store_dst_masked( d + start*dbytes, vbxsim_flag_ptr(d + start*dbytes), r, f, m, n, dbytes );
+		} else {
+			store_dst( d + start*dbytes, vbxsim_flag_ptr(d + start*dbytes), r, f, n, dbytes );
+		}
+	}
+
+	return sum;
+}
+
+// --------------------------------------------------------
+
+static void decode( vbxsim_op_t *o, int mode, vinstr_t v_op, intptr_t srcA )
+{
+	const vbx_mxp_t *this_mxp = &vbxsim.mxp;
+	int op_bytes;
+
+	o->op         = v_op;
+	o->is_signed  = mode & VBXSIM_SIGNED;
+	o->src_bytes  = VBXSIM_SRC_BYTES(mode);
+	o->dst_bytes  = VBXSIM_DST_BYTES(mode);
+	op_bytes      = o->src_bytes > o->dst_bytes ? o->src_bytes : o->dst_bytes;
+	o->bits       = 8*op_bytes;
+	o->scalar_a   = (mode & VBXSIM_SCALAR_A) != 0;
+	o->enum_b     = (mode & VBXSIM_ENUM_B) != 0;
+	o->uses_b     = (v_op != VMOV && v_op < VCUSTOM0);
+	o->uses_flags = (v_op == VADDC || v_op == VSUBB ||
+	                 v_op == VCMV_LEZ || v_op == VCMV_GTZ ||
+	                 v_op == VCMV_LTZ || v_op == VCMV_GEZ);
+	o->frac_bits  = op_bytes == 4 ? this_mxp->fxp_word_frac_bits :
+	                op_bytes == 2 ? this_mxp->fxp_half_frac_bits :
+	                                this_mxp->fxp_byte_frac_bits;
+	o->scalar     = o->scalar_a ? vbxsim_extend( (int32_t)srcA, o->bits, o->is_signed ) : 0;
+	o->kernel     = (vbxsim_kernels && !o->enum_b) ?
+	                (*vbxsim_kernels)[o->scalar_a][mode & (VBXSIM_NUM_TYPES-1)][v_op] : NULL;
+}
+
+// --------------------------------------------------------
+// Splitting instructions across worker threads
+
+#ifndef VBXSIM_PARALLEL_MIN
+#define VBXSIM_PARALLEL_MIN  32768 ///< instructions with fewer elements run on the calling thread
+#endif
+#define VBXSIM_PIECE_ALIGN   64    ///< pieces of a split row start on a multiple of this many elements
+
+/** An instruction as seen by the worker threads */
+typedef struct {
+	const vbxsim_op_t *o;
+	uint8_t       *dest;
+	const uint8_t *srcA;
+	const uint8_t *srcB;
+	int32_t  id2, ia2, ib2, id3, ia3, ib3;
+	int      vl, nrows, nmats, acc;
+	int      npieces; ///< pieces of a single row, or 0 to hand out whole rows
+	uint32_t sum[VBXSIM_MAX_THREADS]; ///< partial sums of a split accumulating row
+} vbxsim_job_t;
+
+static int piece_start( const vbxsim_job_t *j, int piece )
+{
+	if( piece >= j->npieces )
+		return j->vl;
+	return (int)((int64_t)j->vl * piece / j->npieces) & ~(VBXSIM_PIECE_ALIGN-1);
+}
+
+static void exec_rows( void *arg, int first, int last, int worker )
+{
+	vbxsim_job_t *j = arg;
+	const vbxsim_op_t *o = j->o;
+	int u;
+
+	if( j->npieces ) {
+		const int e0 = piece_start( j, first );
+		const int e1 = piece_start( j, last );
+		j->sum[worker] = exec_row( o,
+		                           j->acc ? j->dest : j->dest + e0*o->dst_bytes,
+		                           o->scalar_a ? j->srcA : j->srcA + e0*o->src_bytes,
+		                           o->enum_b   ? j->srcB : j->srcB + e0*o->src_bytes,
+		                           e1 - e0, j->acc, e0 );
+		return;
+	}
+
+	for( u = first; u < last; u++ ) {
+		const int mat = u / j->nrows;
+		const int row = u % j->nrows;
+		uint8_t *d = j->dest + mat*j->id3 + row*j->id2;
+		uint32_t sum = exec_row( o, d,
+		                         j->srcA + mat*j->ia3 + row*j->ia2,
+		                         j->srcB + mat*j->ib3 + row*j->ib2,
+		                         j->vl, j->acc, 0 );
+		if( j->acc )
+			store_sum( d, sum, o->dst_bytes );
+	}
+}
+
+// Address range [lo,hi) covered by an operand over all rows and matrices
+static void extent( const uint8_t *p, int32_t inc2, int32_t inc3, int nrows, int nmats, int span,
+                    const uint8_t **lo, const uint8_t **hi )
+{
+	const int64_t r = (int64_t)(nrows-1) * inc2;
+	const int64_t m = (int64_t)(nmats-1) * inc3;
+	*lo = p + (r < 0 ? r : 0) + (m < 0 ? m : 0);
+	*hi = p + (r > 0 ? r : 0) + (m > 0 ? m : 0) + span;
+}
+
+// A source can be read by any thread if no thread writes it, or if it is
+// laid out exactly like the destination, so each piece reads only what it
+// writes itself.
+static int source_independent( const vbxsim_job_t *j, const uint8_t *s, int32_t inc2, int32_t inc3,
+                               const uint8_t *dlo, const uint8_t *dhi )
+{
+	const uint8_t *lo, *hi;
+	if( s == j->dest && inc2 == j->id2 && inc3 == j->id3 &&
+	    j->o->src_bytes == j->o->dst_bytes && !j->acc )
+		return 1;
+	extent( s, inc2, inc3, j->nrows, j->nmats, j->vl*j->o->src_bytes, &lo, &hi );
+	return hi <= dlo || dhi <= lo;
+}
+
+// Returns 1 if the pieces of the job can run in any order, giving the same
+// result as the MXP running them one after the other.
+static int can_split( const vbxsim_job_t *j )
+{
+	const vbxsim_op_t *o = j->o;
+	const int dspan = j->acc ? o->dst_bytes : j->vl*o->dst_bytes;
+	const uint8_t *dlo, *dhi;
+
+	if( j->npieces ) {
+		if( j->acc )
+			return 1; // the sum is written once all pieces are done
+	} else {
+		// every row and matrix must write its own part of the destination
+		const int64_t mat_span = (int64_t)(j->nrows-1) * abs( j->id2 ) + dspan;
+		if( j->nrows > 1 && abs( j->id2 ) < dspan )
+			return 0;
+		if( j->nmats > 1 && abs( j->id3 ) < mat_span )
+			return 0;
+	}
+
+	extent( j->dest, j->id2, j->id3, j->nrows, j->nmats, dspan, &dlo, &dhi );
+	if( !o->scalar_a && !source_independent( j, j->srcA, j->ia2, j->ia3, dlo, dhi ) )
+		return 0;
+	if( o->uses_b && !o->enum_b && !source_independent( j, j->srcB, j->ib2, j->ib3, dlo, dhi ) )
+		return 0;
+	return 1;
+}
+
+// --------------------------------------------------------
+// Timing
+
+// Waves of one row: a row that starts part way into a wave of the vector
+// lanes takes one more wave, and so does a source that sits at a different
+// offset than the destination, since it goes through the alignment network.
+static uint32_t row_waves( const vbxsim_job_t *j, const uint8_t *d, const uint8_t *a, const uint8_t *b )
+{
+	const vbx_mxp_t *this_mxp = &vbxsim.mxp;
+	const vbxsim_op_t *o = j->o;
+	const uint8_t *sp = (const uint8_t *)this_mxp->scratchpad_addr;
+	const int op_bytes = o->bits/8;
+	const int wave  = 4*this_mxp->vector_lanes;
+	const int align = this_mxp->scratchpad_alignment_bytes;
+	const int d_el  = (int)((d - sp) % align) / o->dst_bytes;
+	const int off   = d_el * op_bytes;
+	uint32_t waves  = (off + j->vl*op_bytes + wave-1) / wave;
+
+	if( (!o->scalar_a && (int)((a - sp) % align) / o->src_bytes != d_el) ||
+	    (o->uses_b && !o->enum_b && (int)((b - sp) % align) / o->src_bytes != d_el) )
+		waves++;
+	return waves;
+}
+
+static void timing( const vbxsim_job_t *j )
+{
+	const vbxsim_op_t *o = j->o;
+	const int dspan = j->acc ? o->dst_bytes : j->vl*o->dst_bytes;
+	vbxsim_range_t wr, rd[2];
+	uint64_t waves = 0;
+	int nrd = 0, latency = 0, mat, row;
+
+	for( mat = 0; mat < j->nmats; mat++ ) {
+		for( row = 0; row < j->nrows; row++ ) {
+			waves += row_waves( j,
+			                    j->dest + mat*j->id3 + row*j->id2,
+			                    j->srcA + mat*j->ia3 + row*j->ia2,
+			                    j->srcB + mat*j->ib3 + row*j->ib2 );
+		}
+	}
+
+	extent( j->dest, j->id2, j->id3, j->nrows, j->nmats, dspan, &wr.lo, &wr.hi );
+	if( !o->scalar_a ) {
+		extent( j->srcA, j->ia2, j->ia3, j->nrows, j->nmats, j->vl*o->src_bytes, &rd[nrd].lo, &rd[nrd].hi );
+		nrd++;
+	}
+	if( o->uses_b && !o->enum_b ) {
+		extent( j->srcB, j->ib2, j->ib3, j->nrows, j->nmats, j->vl*o->src_bytes, &rd[nrd].lo, &rd[nrd].hi );
+		nrd++;
+	}
+
+	// accumulating rows go through an adder tree across the lanes
+	if( j->acc ) {
+		int lanes;
+		for( lanes = vbxsim.mxp.vector_lanes; lanes > 1; lanes >>= 1 )
+			latency++;
+	}
+
+	vbxsim_timing_instr( &wr, rd, nrd, waves, latency );
+}
+
+// --------------------------------------------------------
+
+void vbxsim_instr( int mods, int mode, vinstr_t v_op, intptr_t dest, intptr_t srcA, intptr_t srcB )
+{
+	vbxsim_op_t o;
+	vbxsim_job_t j;
+	const vbx_3d_t *g = &vbxsim.geom;
+	int vl    = (int)g->vl;
+	int nrows = (mods & VBXSIM_MOD_2D) ? (int)g->nrows : 1;
+	int nmats = (mods & VBXSIM_MOD_3D) ? (int)g->nmats : 1;
+	int acc   = (mods & VBXSIM_MOD_ACC) != 0;
+	int units = nrows * nmats;
+	int threads = vbxsim_num_threads();
+	int t;
+	uint32_t lanes_bytes, waves;
+	uint64_t clock = vbxsim_clock_enter();
+
+	if( !vbxsim.flags ) {
+		VBX_PRINTF( "ERROR: vbxsim_init() must be called before issuing instructions.\n" );
+		VBX_FATAL( __LINE__, __FILE__, -1 );
+	}
+
+	decode( &o, mode, v_op, srcA );
+
+	j.o     = &o;
+	j.dest  = (uint8_t *)dest;
+	j.srcA  = (const uint8_t *)srcA;
+	j.srcB  = (const uint8_t *)srcB;
+	j.vl    = vl;
+	j.nrows = nrows;
+	j.nmats = nmats;
+	j.acc   = acc;
+	j.npieces = 0;
+
+	// scalar and enumerated operands do not advance with the row/matrix increments
+	j.id2 = g->id2;
+	j.id3 = g->id3;
+	j.ia2 = o.scalar_a ? 0 : g->ia2;
+	j.ia3 = o.scalar_a ? 0 : g->ia3;
+	j.ib2 = o.enum_b   ? 0 : g->ib2;
+	j.ib3 = o.enum_b   ? 0 : g->ib3;
+
+	if( vl > 0 ) {
+		if( threads > 1 && (int64_t)vl * units >= VBXSIM_PARALLEL_MIN ) {
+			// hand out whole rows/matrices, or split a single long row
+			if( units == 1 )
+				j.npieces = threads;
+			if( !can_split( &j ) )
+				threads = 1;
+		} else {
+			threads = 1;
+		}
+
+		if( threads == 1 ) {
+			j.npieces = 0;
+			exec_rows( &j, 0, units, 0 );
+		} else if( !j.npieces ) {
+			vbxsim_parallel_for( exec_rows, &j, units );
+		} else {
+			memset( j.sum, 0, threads*sizeof(j.sum[0]) );
+			vbxsim_parallel_for( exec_rows, &j, j.npieces );
+			if( acc ) {
+				for( t = 1; t < threads; t++ )
+					j.sum[0] += j.sum[t];
+				store_sum( j.dest, j.sum[0], o.dst_bytes );
+			}
+		}
+
+		timing( &j );
+	}
+
+	// statistics: one wave of vector_lanes 32-bit lanes per cycle
+	lanes_bytes = 4*vbxsim.mxp.vector_lanes;
+	waves = (vl*(o.bits/8) + lanes_bytes-1) / lanes_bytes;
+	vbxsim.instr_count[v_op]++;
+	vbxsim.instr_cycles[v_op] += (uint64_t)waves * nrows * nmats;
+	vbxsim_clock_leave( clock );
+}
@@ -0,0 +1,95 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**
+ * @file
+ * @defgroup VBX_sim_port VBX simulator portability
+ * @brief Host (Linux/POSIX) portability layer used with the simulator
+ *
+ * @ingroup VBXapi
+ */
+/**@{*/
+
+#ifndef __VBXSIM_PORT_H
+#define __VBXSIM_PORT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define VBX_CPU_DCACHE_SIZE      32768
+#define VBX_CPU_DCACHE_LINE_SIZE 64
+
+typedef uint64_t vbx_timestamp_t;
+
+/** Start the timestamp timer for subsequent @ref vbx_timestamp calls */
+int             vbx_timestamp_start();
+
+/** Get the timestamp frequency (nanosecond resolution) */
+uint32_t        vbx_timestamp_freq();
+
+/** Get the current timestamp, from the host monotonic clock */
+vbx_timestamp_t vbx_timestamp();
+
+/** Converts timestamp cycles into simulated mxp cycles
+ *
+ * @param[in] TS_CYCLES
+ */
+#define vbx_mxp_cycles(TS_CYCLES) \
+	((vbx_timestamp_t)( ((double)(TS_CYCLES)) * \
+	                    ((double)VBX_GET_THIS_MXP()->core_freq / (double)vbx_timestamp_freq()) ))
+
+// Host memory is coherent with the simulated DMA engine, so there is
+// nothing to flush and nothing to remap.
+#define vbx_uncached_malloc(BYTES)          malloc(BYTES)
+#define vbx_uncached_free(PTR)              free(PTR)
+#define vbx_dcache_flush_all()              do{}while(0)
+#define vbx_dcache_flush_line(PTR)          do{ (void)(PTR); }while(0)
+#define vbx_dcache_flush(PTR,LEN)           do{ (void)(PTR); (void)(LEN); }while(0)
+#define vbx_remap_cached(PTR,LEN)           ((void *)(PTR))
+#define vbx_remap_uncached(PTR)             ((void *)(PTR))
+#define vbx_remap_uncached_flush(PTR,LEN)   ((void *)(PTR))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __VBXSIM_PORT_H
+/**@}*/
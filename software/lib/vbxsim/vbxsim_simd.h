@@ -0,0 +1,93 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**@file*/
+
+#ifndef __VBXSIM_SIMD_H
+#define __VBXSIM_SIMD_H
+
+#include <stdint.h>
+#include "vbxsim_state.h"
+
+/**
+ * @name Specialized instruction kernels
+ *
+ * Each (operand form, type mode, instruction) combination has a kernel that
+ * works directly on the scratchpad types instead of going through the 32-bit
+ * temporaries of the reference engine. The kernel tables are built once per
+ * host instruction set from vbxsim_simd_template.h; vbxsim_simd_select()
+ * picks the best table the host CPU supports.
+ * @{
+ */
+
+#define VBXSIM_FORM_VV    0
+#define VBXSIM_FORM_SV    1
+#define VBXSIM_NUM_FORMS  2
+#define VBXSIM_NUM_TYPES  32 ///< indexed by the low 5 bits of the mode: signed, dst size, src size
+
+/**
+ * Executes @a n elements of one instruction row.
+ * Writes the destination and its flags, or, if @a acc is set, returns the
+ * sum of the results without writing anything.
+ */
+typedef uint32_t (*vbxsim_kernel_t)( uint8_t *d, const uint8_t *sa, const uint8_t *sb,
+                                     int32_t scalar, int n, int acc, int frac_bits );
+
+typedef vbxsim_kernel_t vbxsim_kernel_table_t[VBXSIM_NUM_FORMS][VBXSIM_NUM_TYPES][VBXSIM_NUM_INSTR];
+
+extern const vbxsim_kernel_table_t vbxsim_kernels_generic;
+#if defined(__x86_64__) || defined(__i386__)
+extern const vbxsim_kernel_table_t vbxsim_kernels_avx2;
+extern const vbxsim_kernel_table_t vbxsim_kernels_avx512;
+#endif
+
+/** Kernel table in use, or NULL to run everything on the reference engine */
+extern const vbxsim_kernel_table_t *vbxsim_kernels;
+
+/**
+ * Selects the kernel table for the host CPU.
+ * The VBXSIM_ISA environment variable overrides the choice:
+ * "avx512", "avx2", "generic", or "none" for the reference engine only.
+ */
+void vbxsim_simd_select();
+
+/** Returns the name of the selected kernel table */
+const char *vbxsim_simd_name();
+
+/**@}*/
+
+#endif // __VBXSIM_SIMD_H
@@ -0,0 +1,252 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**@file*/
+
+#include "vbx_copyright.h"
+VBXCOPYRIGHT( vbxsim_simd_avx2 )
+
+// Kernels for x86 hosts with AVX2: 256-bit integer vectors.
+//
+// AVX2 has no variable shifts of byte or halfword elements, and the compiler
+// does not vectorize the flag-tested conditional moves, so those byte and
+// halfword kernels are written with intrinsics here. The rest come from
+// vbxsim_simd_template.h.
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#pragma GCC target("avx2")
+
+#include <immintrin.h>
+#include "vbxsim_simd.h"
+
+#define VBXSIM_AVX2_TYPES(X, FORM) \
+	X( FORM, BBU, 0x00,  8, 0 ) \
+	X( FORM, BBS, 0x01,  8, 1 ) \
+	X( FORM, HHU, 0x0a, 16, 0 ) \
+	X( FORM, HHS, 0x0b, 16, 1 )
+
+#define VBXSIM_AVX2_OPS(X, FORM, TY, CODE, BITS, SIGNED) \
+	X( FORM, TY, CODE, BITS, SIGNED, VSHL ) \
+	X( FORM, TY, CODE, BITS, SIGNED, VSHR ) \
+	X( FORM, TY, CODE, BITS, SIGNED, VROTL ) \
+	X( FORM, TY, CODE, BITS, SIGNED, VROTR ) \
+	X( FORM, TY, CODE, BITS, SIGNED, VCMV_LEZ ) \
+	X( FORM, TY, CODE, BITS, SIGNED, VCMV_GTZ ) \
+	X( FORM, TY, CODE, BITS, SIGNED, VCMV_LTZ ) \
+	X( FORM, TY, CODE, BITS, SIGNED, VCMV_GEZ )
+
+#define VBXSIM_AVX2_DECL(FORM, TY, CODE, BITS, SIGNED, OP) \
+	static uint32_t vbxsim_avx2_##FORM##_##TY##_##OP( uint8_t *d, const uint8_t *sa, const uint8_t *sb, \
+	                                                  int32_t scalar, int n, int acc, int frac_bits );
+
+#define VBXSIM_AVX2_ENTRY(FORM, TY, CODE, BITS, SIGNED, OP) \
+	[VBXSIM_FORM_##FORM][CODE][OP] = vbxsim_avx2_##FORM##_##TY##_##OP,
+
+#define VBXSIM_AVX2_TYPE_DECLS(FORM, TY, CODE, BITS, SIGNED) \
+	VBXSIM_AVX2_OPS( VBXSIM_AVX2_DECL, FORM, TY, CODE, BITS, SIGNED )
+#define VBXSIM_AVX2_TYPE_ENTRIES(FORM, TY, CODE, BITS, SIGNED) \
+	VBXSIM_AVX2_OPS( VBXSIM_AVX2_ENTRY, FORM, TY, CODE, BITS, SIGNED )
+
+VBXSIM_AVX2_TYPES( VBXSIM_AVX2_TYPE_DECLS, VV )
+VBXSIM_AVX2_TYPES( VBXSIM_AVX2_TYPE_DECLS, SV )
+
+#define VBXSIM_KERNEL_OVERRIDES \
+	VBXSIM_AVX2_TYPES( VBXSIM_AVX2_TYPE_ENTRIES, VV ) \
+	VBXSIM_AVX2_TYPES( VBXSIM_AVX2_TYPE_ENTRIES, SV )
+
+#define VBXSIM_KERNEL_TABLE vbxsim_kernels_avx2
+#include "vbxsim_simd_template.h"
+
+// --------------------------------------------------------
+// Byte and halfword element helpers
+
+#define AVX2_INLINE static inline __attribute__((always_inline))
+
+AVX2_INLINE __m256i avx2_load( const void *p )
+{
+	return _mm256_loadu_si256( (const __m256i *)p );
+}
+
+AVX2_INLINE void avx2_store( void *p, __m256i v )
+{
+	_mm256_storeu_si256( (__m256i *)p, v );
+}
+
+AVX2_INLINE __m256i avx2_set1( int bits, int32_t x )
+{
+	return bits == 8 ? _mm256_set1_epi8( (char)x ) : _mm256_set1_epi16( (short)x );
+}
+
+AVX2_INLINE __m256i avx2_sub( int bits, __m256i a, __m256i b )
+{
+	return bits == 8 ? _mm256_sub_epi8( a, b ) : _mm256_sub_epi16( a, b );
+}
+
+AVX2_INLINE __m256i avx2_cmpeq( int bits, __m256i a, __m256i b )
+{
+	return bits == 8 ? _mm256_cmpeq_epi8( a, b ) : _mm256_cmpeq_epi16( a, b );
+}
+
+// Flag of each element (its MSB) replicated into all of its bytes
+AVX2_INLINE __m256i avx2_msb_flags( int bits, __m256i r )
+{
+	if( bits == 8 )
+		return _mm256_and_si256( _mm256_srli_epi16( r, 7 ), _mm256_set1_epi8( 1 ) );
+	return _mm256_and_si256( _mm256_srai_epi16( r, 15 ), _mm256_set1_epi16( 0x0101 ) );
+}
+
+// Flag of each element of a source, from the flag of its most significant byte
+AVX2_INLINE __m256i avx2_src_flags( int bits, const uint8_t *pf )
+{
+	const __m256i f = avx2_load( pf );
+	return bits == 8 ? f : _mm256_srli_epi16( f, 8 );
+}
+
+// Shift every element by the immediate k
+AVX2_INLINE __m256i avx2_shift_imm( int bits, __m256i v, int k, int left, int is_signed )
+{
+	__m256i m;
+	if( bits == 16 ) {
+		if( left )
+			return _mm256_slli_epi16( v, k );
+		return is_signed ? _mm256_srai_epi16( v, k ) : _mm256_srli_epi16( v, k );
+	}
+	// bytes: shift halfwords, then clear the bits crossing from the neighbour
+	if( left )
+		return _mm256_and_si256( _mm256_slli_epi16( v, k ), _mm256_set1_epi8( (char)(0xff << k) ) );
+	v = _mm256_and_si256( _mm256_srli_epi16( v, k ), _mm256_set1_epi8( (char)(0xff >> k) ) );
+	if( is_signed ) {
+		m = _mm256_set1_epi8( (char)(0x80 >> k) );
+		v = _mm256_sub_epi8( _mm256_xor_si256( v, m ), m );
+	}
+	return v;
+}
+
+// Shift every element of v by the matching element of s (0 to bits-1),
+// one conditional immediate shift per bit of the shift amount
+AVX2_INLINE __m256i avx2_shift( int bits, __m256i v, __m256i s, int left, int is_signed )
+{
+	int k;
+	for( k = bits/2; k >= 1; k /= 2 ) {
+		const __m256i kv = avx2_set1( bits, k );
+		const __m256i m  = avx2_cmpeq( bits, _mm256_and_si256( s, kv ), kv );
+		v = _mm256_blendv_epi8( v, avx2_shift_imm( bits, v, k, left, is_signed ), m );
+	}
+	return v;
+}
+
+AVX2_INLINE __m256i avx2_rotl( int bits, __m256i v, __m256i s )
+{
+	const __m256i mask = avx2_set1( bits, bits-1 );
+	const __m256i t    = _mm256_and_si256( avx2_sub( bits, avx2_set1( bits, bits ), s ), mask );
+	return _mm256_or_si256( avx2_shift( bits, v, s, 1, 0 ), avx2_shift( bits, v, t, 0, 0 ) );
+}
+
+// --------------------------------------------------------
+// Kernel body, specialized by constant arguments. Whole vectors are done
+// here; the remaining elements go to the template kernel @a tail.
+
+AVX2_INLINE uint32_t avx2_kernel( uint8_t *d, const uint8_t *sa, const uint8_t *sb,
+                                  int32_t scalar, int n, vinstr_t op, int bits, int is_signed,
+                                  int scalar_a, vbxsim_kernel_t tail )
+{
+	const int bytes = bits/8;
+	const int step  = 32/bytes;
+	const __m256i xs   = avx2_set1( bits, scalar );
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i one  = avx2_set1( bits, 1 );
+	const __m256i mask = avx2_set1( bits, bits-1 );
+	uint8_t *fd = vbxsim_flag_ptr( d );
+	const uint8_t *fb = vbxsim_flag_ptr( sb );
+	int i;
+
+	for( i = 0; i + step <= n; i += step ) {
+		const int o = i*bytes;
+		const __m256i x = scalar_a ? xs : avx2_load( sa + o );
+		__m256i r, f, c, s;
+
+		switch( op ) {
+		case VSHL:
+		case VSHR:
+			s = _mm256_and_si256( x, mask );
+			r = avx2_shift( bits, avx2_load( sb + o ), s, op == VSHL, is_signed );
+			f = avx2_msb_flags( bits, r );
+			break;
+		case VROTL:
+		case VROTR:
+			s = _mm256_and_si256( x, mask );
+			if( op == VROTR )
+				s = _mm256_and_si256( avx2_sub( bits, avx2_set1( bits, bits ), s ), mask );
+			r = avx2_rotl( bits, avx2_load( sb + o ), s );
+			f = avx2_msb_flags( bits, r );
+			break;
+		default:
+			c = avx2_cmpeq( bits, avx2_src_flags( bits, fb + o ), one );
+			if( op == VCMV_LEZ || op == VCMV_GTZ )
+				c = _mm256_or_si256( c, avx2_cmpeq( bits, avx2_load( sb + o ), zero ) );
+			if( op == VCMV_GTZ || op == VCMV_GEZ )
+				c = _mm256_xor_si256( c, _mm256_cmpeq_epi8( zero, zero ) );
+			r = _mm256_blendv_epi8( avx2_load( d + o ), x, c );
+			f = _mm256_blendv_epi8( avx2_load( fd + o ), avx2_msb_flags( bits, x ), c );
+			break;
+		}
+		avx2_store( d + o, r );
+		avx2_store( fd + o, f );
+	}
+	if( i < n )
+		tail( d + i*bytes, scalar_a ? sa : sa + i*bytes, sb + i*bytes, scalar, n - i, 0, 0 );
+	return 0;
+}
+
+#define VBXSIM_AVX2_KERNEL(FORM, TY, CODE, BITS, SIGNED, OP) \
+	static uint32_t vbxsim_avx2_##FORM##_##TY##_##OP( uint8_t *d, const uint8_t *sa, const uint8_t *sb, \
+	                                                  int32_t scalar, int n, int acc, int frac_bits ) \
+	{ \
+		if( acc ) \
+			return vbxsim_##FORM##_##TY##_##OP( d, sa, sb, scalar, n, acc, frac_bits ); \
+		return avx2_kernel( d, sa, sb, scalar, n, OP, BITS, SIGNED, VBXSIM_FORM_##FORM, \
+		                    vbxsim_##FORM##_##TY##_##OP ); \
+	}
+
+#define VBXSIM_AVX2_TYPE_KERNELS(FORM, TY, CODE, BITS, SIGNED) \
+	VBXSIM_AVX2_OPS( VBXSIM_AVX2_KERNEL, FORM, TY, CODE, BITS, SIGNED )
+
+VBXSIM_AVX2_TYPES( VBXSIM_AVX2_TYPE_KERNELS, VV )
+VBXSIM_AVX2_TYPES( VBXSIM_AVX2_TYPE_KERNELS, SV )
+
+#endif
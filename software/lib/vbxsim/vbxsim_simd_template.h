@@ -0,0 +1,232 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**@file*/
+
+// Instruction kernel template, included once per host instruction set by
+// vbxsim_simd_<isa>.c. The including file selects the code generation target
+// and defines VBXSIM_KERNEL_TABLE, the name of the kernel table to build.
+//
+// Kernels are plain element loops over the scratchpad types, written so the
+// host compiler vectorizes every one of them for the selected target: the
+// operands are extended to the operating width, the result is narrowed to
+// the destination width, and the flag of each element is replicated into
+// all of its bytes with a single store of the destination type.
+//
+// The results and flags match the reference engine in vbxsim_exec.c bit for
+// bit. VE/SE forms and VCUSTOM instructions have no kernel and always use the
+// reference engine.
+
+#ifndef VBXSIM_KERNEL_TABLE
+#error "define VBXSIM_KERNEL_TABLE before including vbxsim_simd_template.h"
+#endif
+
+#include "vbxsim_simd.h"
+
+typedef uint8_t  vbxsim_ub_t;
+typedef int8_t   vbxsim_sb_t;
+typedef uint16_t __attribute__((aligned(1),may_alias)) vbxsim_uh_t;
+typedef int16_t  __attribute__((aligned(1),may_alias)) vbxsim_sh_t;
+typedef uint32_t __attribute__((aligned(1),may_alias)) vbxsim_uw_t;
+typedef int32_t  __attribute__((aligned(1),may_alias)) vbxsim_sw_t;
+
+// --------------------------------------------------------
+// Type modes
+//
+// TY:   name, source then destination size, then signedness
+// CODE: low 5 bits of the mode
+// S:    source element type
+// D:    destination element type; F is the same size, used for its flags
+// T:    operating type, signed or unsigned like the mode
+// U:    unsigned operating type
+// W:    type wide enough for a carry out or a full product
+// BITS: operating width, the larger of the source and destination widths
+
+#define VBXSIM_TYPES(X, FORM) \
+	X( FORM, BBU, 0x00, vbxsim_ub_t, vbxsim_ub_t, vbxsim_ub_t, uint32_t, uint32_t, uint32_t,  8 ) \
+	X( FORM, BBS, 0x01, vbxsim_sb_t, vbxsim_ub_t, vbxsim_ub_t, int32_t,  uint32_t, int32_t,   8 ) \
+	X( FORM, BHU, 0x02, vbxsim_ub_t, vbxsim_uh_t, vbxsim_uh_t, uint32_t, uint32_t, uint32_t, 16 ) \
+	X( FORM, BHS, 0x03, vbxsim_sb_t, vbxsim_uh_t, vbxsim_uh_t, int32_t,  uint32_t, int32_t,  16 ) \
+	X( FORM, BWU, 0x04, vbxsim_ub_t, vbxsim_uw_t, vbxsim_uw_t, uint32_t, uint32_t, uint64_t, 32 ) \
+	X( FORM, BWS, 0x05, vbxsim_sb_t, vbxsim_uw_t, vbxsim_uw_t, int32_t,  uint32_t, int64_t,  32 ) \
+	X( FORM, HBU, 0x08, vbxsim_uh_t, vbxsim_ub_t, vbxsim_ub_t, uint32_t, uint32_t, uint32_t, 16 ) \
+	X( FORM, HBS, 0x09, vbxsim_sh_t, vbxsim_ub_t, vbxsim_ub_t, int32_t,  uint32_t, int32_t,  16 ) \
+	X( FORM, HHU, 0x0a, vbxsim_uh_t, vbxsim_uh_t, vbxsim_uh_t, uint32_t, uint32_t, uint32_t, 16 ) \
+	X( FORM, HHS, 0x0b, vbxsim_sh_t, vbxsim_uh_t, vbxsim_uh_t, int32_t,  uint32_t, int32_t,  16 ) \
+	X( FORM, HWU, 0x0c, vbxsim_uh_t, vbxsim_uw_t, vbxsim_uw_t, uint32_t, uint32_t, uint64_t, 32 ) \
+	X( FORM, HWS, 0x0d, vbxsim_sh_t, vbxsim_uw_t, vbxsim_uw_t, int32_t,  uint32_t, int64_t,  32 ) \
+	X( FORM, WBU, 0x10, vbxsim_uw_t, vbxsim_ub_t, vbxsim_ub_t, uint32_t, uint32_t, uint64_t, 32 ) \
+	X( FORM, WBS, 0x11, vbxsim_sw_t, vbxsim_ub_t, vbxsim_ub_t, int32_t,  uint32_t, int64_t,  32 ) \
+	X( FORM, WHU, 0x12, vbxsim_uw_t, vbxsim_uh_t, vbxsim_uh_t, uint32_t, uint32_t, uint64_t, 32 ) \
+	X( FORM, WHS, 0x13, vbxsim_sw_t, vbxsim_uh_t, vbxsim_uh_t, int32_t,  uint32_t, int64_t,  32 ) \
+	X( FORM, WWU, 0x14, vbxsim_uw_t, vbxsim_uw_t, vbxsim_uw_t, uint32_t, uint32_t, uint64_t, 32 ) \
+	X( FORM, WWS, 0x15, vbxsim_sw_t, vbxsim_uw_t, vbxsim_uw_t, int32_t,  uint32_t, int64_t,  32 )
+
+// --------------------------------------------------------
+// Instructions
+//
+// SHAPE:  PLAIN results flag their MSB, CARRY results flag the bit above the
+//         operating width, CMV results are conditional moves of srcA
+// USES_B: reads the values of srcB
+// USES_F: reads the flags of srcB
+// EXPR:   result (PLAIN, CARRY) or condition (CMV) from srcA x, srcB y and
+//         the flag fy of srcB. Shifts and rotates operate on y by x.
+
+#define VBXSIM_ROT(V, S, BITS) \
+	( ((V) << (S)) | ((V) >> (((BITS) - (S)) & ((BITS)-1))) )
+
+#define VBXSIM_VMASK(BITS) ((uop_t)(((uint64_t)1 << (BITS)) - 1))
+
+#define VBXSIM_OPS(X, FORM, TY, CODE, S, D, F, T, U, W, BITS) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VMOV,     PLAIN, 0, 0, x ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VAND,     PLAIN, 1, 0, x & y ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VOR,      PLAIN, 1, 0, x | y ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VXOR,     PLAIN, 1, 0, x ^ y ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VADD,     CARRY, 1, 0, (wide_t)x + (wide_t)y ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VSUB,     CARRY, 1, 0, (wide_t)x - (wide_t)y ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VADDC,    CARRY, 1, 1, (wide_t)x + (wide_t)y + (wide_t)fy ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VSUBB,    CARRY, 1, 1, (wide_t)x - (wide_t)y - (wide_t)fy ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VMUL,     PLAIN, 1, 0, (uop_t)x * (uop_t)y ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VMULHI,   PLAIN, 1, 0, ((wide_t)x * (wide_t)y) >> (BITS) ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VMULFXP,  PLAIN, 1, 0, ((wide_t)x * (wide_t)y) >> frac_bits ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VSHL,     PLAIN, 1, 0, (uop_t)y << (x & ((BITS)-1)) ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VSHR,     PLAIN, 1, 0, y >> (x & ((BITS)-1)) ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VROTL,    PLAIN, 1, 0, \
+	   VBXSIM_ROT( (uop_t)y & VBXSIM_VMASK(BITS), x & ((BITS)-1), BITS ) ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VROTR,    PLAIN, 1, 0, \
+	   VBXSIM_ROT( (uop_t)y & VBXSIM_VMASK(BITS), ((BITS) - (x & ((BITS)-1))) & ((BITS)-1), BITS ) ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VABSDIFF, PLAIN, 1, 0, \
+	   x > y ? (uop_t)x - (uop_t)y : (uop_t)y - (uop_t)x ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VCMV_LEZ, CMV,   1, 1, fy | (y == 0) ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VCMV_GTZ, CMV,   1, 1, !fy & (y != 0) ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VCMV_LTZ, CMV,   0, 1, fy ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VCMV_GEZ, CMV,   0, 1, !fy ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VCMV_Z,   CMV,   1, 0, y == 0 ) \
+	X( FORM, TY, CODE, S, D, F, T, U, W, BITS, VCMV_NZ,  CMV,   1, 0, y != 0 )
+
+// --------------------------------------------------------
+// Kernel bodies
+
+// Operands of element i. Scalar srcA was already reduced to the operating width.
+#define VBXSIM_OPERANDS_VV(S, USES_B, USES_F) \
+	const op_t x  = (op_t)a[i]; \
+	const op_t y  = USES_B ? (op_t)b[i] : 0; \
+	const int  fy = USES_F ? fb[i*sizeof(S)] : 0; \
+	(void)x; (void)y; (void)fy
+
+#define VBXSIM_OPERANDS_SV(S, USES_B, USES_F) \
+	const op_t x  = (op_t)scalar; \
+	const op_t y  = USES_B ? (op_t)b[i] : 0; \
+	const int  fy = USES_F ? fb[i*sizeof(S)] : 0; \
+	(void)x; (void)y; (void)fy
+
+// The flag bit replicated into every byte of an element of type F
+#define VBXSIM_FLAGS(F, BIT) ((F)((BIT) * 0x01010101u))
+
+#define VBXSIM_STORE_PLAIN(D, F, BITS, EXPR) \
+	const uop_t r = (uop_t)(EXPR); \
+	dd[i] = (D)r; \
+	fd[i] = VBXSIM_FLAGS( F, (r >> ((BITS)-1)) & 1 )
+
+#define VBXSIM_STORE_CARRY(D, F, BITS, EXPR) \
+	const wide_t s = EXPR; \
+	dd[i] = (D)s; \
+	fd[i] = VBXSIM_FLAGS( F, (uint32_t)(s >> (BITS)) & 1 )
+
+#define VBXSIM_STORE_CMV(D, F, BITS, EXPR) \
+	const int c = EXPR; \
+	const uop_t r = (uop_t)x; \
+	dd[i] = c ? (D)r : dd[i]; \
+	fd[i] = c ? VBXSIM_FLAGS( F, (r >> ((BITS)-1)) & 1 ) : fd[i]
+
+#define VBXSIM_ACC_PLAIN(EXPR) sum += (uint32_t)(uop_t)(EXPR)
+#define VBXSIM_ACC_CARRY(EXPR) sum += (uint32_t)(EXPR)
+#define VBXSIM_ACC_CMV(EXPR)   sum += (EXPR) ? (uint32_t)x : 0
+
+#define VBXSIM_KERNEL(FORM, TY, CODE, S, D, F, T, U, W, BITS, OP, SHAPE, USES_B, USES_F, EXPR) \
+static uint32_t vbxsim_##FORM##_##TY##_##OP( uint8_t *d, const uint8_t *sa, const uint8_t *sb, \
+                                             int32_t scalar, int n, int acc, int frac_bits ) \
+{ \
+	typedef T op_t   __attribute__((unused)); \
+	typedef U uop_t  __attribute__((unused)); \
+	typedef W wide_t __attribute__((unused)); \
+	const S *a = (const S *)sa; \
+	const S *b = (const S *)sb; \
+	const uint8_t *fb = USES_F ? vbxsim_flag_ptr(sb) + sizeof(S)-1 : 0; \
+	D *dd = (D *)d; \
+	F *fd = (F *)vbxsim_flag_ptr(d); \
+	uint32_t sum = 0; \
+	int i; \
+	(void)a; (void)b; (void)scalar; (void)frac_bits; \
+	if( acc ) { \
+		for( i = 0; i < n; i++ ) { \
+			VBXSIM_OPERANDS_##FORM( S, USES_B, USES_F ); \
+			VBXSIM_ACC_##SHAPE( EXPR ); \
+		} \
+		return sum; \
+	} \
+	for( i = 0; i < n; i++ ) { \
+		VBXSIM_OPERANDS_##FORM( S, USES_B, USES_F ); \
+		VBXSIM_STORE_##SHAPE( D, F, BITS, EXPR ); \
+	} \
+	return 0; \
+}
+
+#define VBXSIM_ENTRY(FORM, TY, CODE, S, D, F, T, U, W, BITS, OP, SHAPE, USES_B, USES_F, EXPR) \
+	[VBXSIM_FORM_##FORM][CODE][OP] = vbxsim_##FORM##_##TY##_##OP,
+
+#define VBXSIM_TYPE_KERNELS(FORM, TY, CODE, S, D, F, T, U, W, BITS) \
+	VBXSIM_OPS( VBXSIM_KERNEL, FORM, TY, CODE, S, D, F, T, U, W, BITS )
+
+#define VBXSIM_TYPE_ENTRIES(FORM, TY, CODE, S, D, F, T, U, W, BITS) \
+	VBXSIM_OPS( VBXSIM_ENTRY, FORM, TY, CODE, S, D, F, T, U, W, BITS )
+
+VBXSIM_TYPES( VBXSIM_TYPE_KERNELS, VV )
+VBXSIM_TYPES( VBXSIM_TYPE_KERNELS, SV )
+
+// The including file may replace some kernels with hand-written ones by
+// declaring them first and listing their table entries in
+// VBXSIM_KERNEL_OVERRIDES; later designated initializers take precedence.
+#ifndef VBXSIM_KERNEL_OVERRIDES
+#define VBXSIM_KERNEL_OVERRIDES
+#endif
+
+const vbxsim_kernel_table_t VBXSIM_KERNEL_TABLE = {
+	VBXSIM_TYPES( VBXSIM_TYPE_ENTRIES, VV )
+	VBXSIM_TYPES( VBXSIM_TYPE_ENTRIES, SV )
+	VBXSIM_KERNEL_OVERRIDES
+};
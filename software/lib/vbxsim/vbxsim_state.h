@@ -0,0 +1,146 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**@file*/
+
+#ifndef __VBXSIM_STATE_H
+#define __VBXSIM_STATE_H
+
+#include <stdint.h>
+#include "vbx.h"
+
+#define VBXSIM_NUM_REGS   32
+#define VBXSIM_NUM_INSTR  (MAX_INSTR_VAL+1)
+
+/** Simulated MXP processor state */
+typedef struct {
+	vbx_mxp_t  mxp;
+	uint8_t   *flags;      ///< one flag bit (stored as a byte) per scratchpad byte
+	union {
+		vbx_3d_t geom;     ///< 1D/2D/3D address generator state
+		int32_t  reg[VBXSIM_NUM_REGS];
+	};
+	uint32_t   mark;
+
+	/* Statistics */
+	uint32_t   instr_count[VBXSIM_NUM_INSTR];
+	uint64_t   instr_cycles[VBXSIM_NUM_INSTR];
+	uint32_t   dma_count;
+	uint64_t   dma_cycles;
+	uint64_t   dma_bytes;
+
+	/* Modelled clock */
+	int        clock_model; ///< timestamps follow the timing model (VBXSIM_CLOCK=model)
+	uint64_t   sim_ns;      ///< host time spent inside the simulator
+} vbxsim_state_t;
+
+extern vbxsim_state_t vbxsim;
+
+/** Returns the flag array entry that shadows scratchpad address @a p */
+static inline uint8_t *vbxsim_flag_ptr( const void *p )
+{
+	return vbxsim.flags + ((const uint8_t *)p - (const uint8_t *)vbxsim.mxp.scratchpad_addr);
+}
+
+/**
+ * @name Worker threads
+ *
+ * Large instructions are split across a pool of worker threads. The caller
+ * takes part in the work, and vbxsim_parallel_for() returns only when every
+ * piece is done, so instructions and DMA transfers still complete in issue
+ * order.
+ * @{
+ */
+
+#define VBXSIM_MAX_THREADS 64
+
+/** Work function: runs pieces [@a first, @a last) on worker number @a worker */
+typedef void (*vbxsim_work_fn_t)( void *arg, int first, int last, int worker );
+
+/**
+ * Starts the worker threads. The pool has @a num_threads threads including
+ * the caller; 0 means one per online CPU, unless the VBXSIM_THREADS
+ * environment variable sets the count.
+ */
+void vbxsim_threads_init( int num_threads );
+void vbxsim_threads_destroy();
+int  vbxsim_num_threads();
+
+/** Splits pieces 0 to @a count-1 evenly among the threads, and waits for them */
+void vbxsim_parallel_for( vbxsim_work_fn_t fn, void *arg, int count );
+
+/**@}*/
+
+/**
+ * @name Timing model
+ *
+ * See vbxsim_timing.c. Instructions and DMA transfers report the scratchpad
+ * bytes they read and write, so the model can find hazards between them.
+ * @{
+ */
+
+/** Scratchpad byte range [lo,hi) */
+typedef struct {
+	const uint8_t *lo;
+	const uint8_t *hi;
+} vbxsim_range_t;
+
+void vbxsim_timing_reset();
+void vbxsim_timing_setup(); ///< a vl/2D/3D setup command
+void vbxsim_timing_instr( const vbxsim_range_t *wr, const vbxsim_range_t *rd, int nrd,
+                          uint64_t waves, int latency );
+void vbxsim_timing_dma( int to_host, const vbxsim_range_t *sp, const void *host,
+                        uint32_t row_bytes, uint32_t rows, int32_t host_stride );
+void vbxsim_timing_sync();
+vbx_fence_t vbxsim_timing_fence();
+int  vbxsim_timing_fence_done( vbx_fence_t fence ); ///< a poll of the fence
+void vbxsim_timing_fence_wait( vbx_fence_t fence );
+
+uint64_t vbxsim_timing_host();      ///< modelled host time, in MXP cycles
+uint64_t vbxsim_timing_dma_busy();  ///< cycles the DMA engine was busy since the last reset
+
+/** Returns the host time on entry to the simulator, for vbxsim_clock_leave() */
+uint64_t vbxsim_clock_enter();
+/** Removes the host time spent in the simulator since @a start from the modelled clock */
+void     vbxsim_clock_leave( uint64_t start );
+
+/**@}*/
+
+/** Recompute flags after a DMA write to the scratchpad: each byte's flag is its MSB. */
+void vbxsim_dma_flags( const void *v_dst, int num_bytes );
+
+#endif // __VBXSIM_STATE_H
@@ -0,0 +1,174 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**@file*/
+
+#include "vbx_copyright.h"
+VBXCOPYRIGHT( vbxsim_thread )
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "vbx.h"
+#include "vbxsim_state.h"
+
+/** Thread pool. Workers wait for a new generation of work, run their share,
+ *  and the last one to finish wakes the caller. */
+static struct {
+	int              num_threads; ///< including the calling thread
+	pthread_t        threads[VBXSIM_MAX_THREADS];
+	pthread_mutex_t  lock;
+	pthread_cond_t   start;
+	pthread_cond_t   done;
+	unsigned         generation;
+	int              pending;
+	int              quit;
+
+	vbxsim_work_fn_t fn;
+	void            *arg;
+	int              count;
+} pool = {
+	.num_threads = 1,
+	.lock        = PTHREAD_MUTEX_INITIALIZER,
+	.start       = PTHREAD_COND_INITIALIZER,
+	.done        = PTHREAD_COND_INITIALIZER,
+};
+
+static void run_share( int worker )
+{
+	const int first = (int)((int64_t)pool.count *  worker    / pool.num_threads);
+	const int last  = (int)((int64_t)pool.count * (worker+1) / pool.num_threads);
+	if( first < last )
+		pool.fn( pool.arg, first, last, worker );
+}
+
+static void *worker_main( void *p )
+{
+	const int worker = (int)(intptr_t)p;
+	unsigned seen = 0;
+
+	pthread_mutex_lock( &pool.lock );
+	for(;;) {
+		while( pool.generation == seen && !pool.quit )
+			pthread_cond_wait( &pool.start, &pool.lock );
+		if( pool.quit )
+			break;
+		seen = pool.generation;
+		pthread_mutex_unlock( &pool.lock );
+
+		run_share( worker );
+
+		pthread_mutex_lock( &pool.lock );
+		if( --pool.pending == 0 )
+			pthread_cond_signal( &pool.done );
+	}
+	pthread_mutex_unlock( &pool.lock );
+	return NULL;
+}
+
+void vbxsim_threads_init( int num_threads )
+{
+	const char *env = getenv( "VBXSIM_THREADS" );
+	int t;
+
+	vbxsim_threads_destroy();
+
+	if( num_threads <= 0 )
+		num_threads = env ? atoi( env ) : (int)sysconf( _SC_NPROCESSORS_ONLN );
+	if( num_threads < 1 )
+		num_threads = 1;
+	if( num_threads > VBXSIM_MAX_THREADS )
+		num_threads = VBXSIM_MAX_THREADS;
+
+	pool.quit       = 0;
+	pool.generation = 0; // workers start out having seen generation 0
+	for( t = 1; t < num_threads; t++ ) {
+		if( pthread_create( &pool.threads[t], NULL, worker_main, (void *)(intptr_t)t ) ) {
+			VBX_PRINTF( "WARNING: vbxsim could only start %d threads.\n", t );
+			break;
+		}
+	}
+	pool.num_threads = t;
+}
+
+void vbxsim_threads_destroy()
+{
+	int t;
+
+	if( pool.num_threads <= 1 )
+		return;
+
+	pthread_mutex_lock( &pool.lock );
+	pool.quit = 1;
+	pthread_cond_broadcast( &pool.start );
+	pthread_mutex_unlock( &pool.lock );
+
+	for( t = 1; t < pool.num_threads; t++ )
+		pthread_join( pool.threads[t], NULL );
+	pool.num_threads = 1;
+}
+
+int vbxsim_num_threads()
+{
+	return pool.num_threads;
+}
+
+void vbxsim_parallel_for( vbxsim_work_fn_t fn, void *arg, int count )
+{
+	if( pool.num_threads <= 1 || count <= 1 ) {
+		if( count > 0 )
+			fn( arg, 0, count, 0 );
+		return;
+	}
+
+	pthread_mutex_lock( &pool.lock );
+	pool.fn      = fn;
+	pool.arg     = arg;
+	pool.count   = count;
+	pool.pending = pool.num_threads - 1;
+	pool.generation++;
+	pthread_cond_broadcast( &pool.start );
+	pthread_mutex_unlock( &pool.lock );
+
+	run_share( 0 );
+
+	pthread_mutex_lock( &pool.lock );
+	while( pool.pending )
+		pthread_cond_wait( &pool.done, &pool.lock );
+	pthread_mutex_unlock( &pool.lock );
+}
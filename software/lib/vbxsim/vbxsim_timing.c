@@ -0,0 +1,357 @@
+/* VECTORBLOX MXP SOFTWARE DEVELOPMENT KIT
+ *
+ * Copyright (C) 2012-2014 VectorBlox Computing Inc., Vancouver, British Columbia, Canada.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *
+ *     * Neither the name of VectorBlox Computing Inc. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * This agreement shall be governed in all respects by the laws of the Province
+ * of British Columbia and by the laws of Canada.
+ *
+ * This file is part of the VectorBlox MXP Software Development Kit.
+ *
+ */
+
+/**@file*/
+
+#include "vbx_copyright.h"
+VBXCOPYRIGHT( vbxsim_timing )
+
+// Cycle-approximate timing model of the MXP, used for the vbx_counters.h
+// counters. The host issues commands into the instruction queue; the MXP
+// dispatches them in order, either to the vector pipeline or to the DMA
+// queue, which the DMA engine drains in order, overlapped with the vector
+// pipeline. The model tracks when each command starts and completes, and
+// counts the cycles lost to:
+//   - instruction hazards: an instruction reading a result of a recent
+//     instruction waits until that result has come out of the pipeline;
+//   - DMA hazards: an instruction waits for a DMA transfer to or from the
+//     scratchpad data it uses, or a DMA transfer waits for instructions;
+//   - DMA queue stalls: dispatch waits for a free slot in the DMA queue.
+// The host is modelled as taking VBXSIM_ISSUE_CYCLES per command and no
+// time between commands, so total cycles are a lower bound for code that
+// also does scalar work.
+
+#include <string.h>
+
+#include "vbx.h"
+#include "vbxsim_state.h"
+
+#ifndef VBXSIM_PIPELINE_CYCLES
+#define VBXSIM_PIPELINE_CYCLES   8   ///< vector pipeline latency, from operand read to writeback
+#endif
+#ifndef VBXSIM_ISSUE_CYCLES
+#define VBXSIM_ISSUE_CYCLES      4   ///< host cycles to issue one command
+#endif
+#ifndef VBXSIM_INSTR_QUEUE_DEPTH
+#define VBXSIM_INSTR_QUEUE_DEPTH 16  ///< commands issued but not yet dispatched
+#endif
+#ifndef VBXSIM_DMA_QUEUE_DEPTH
+#define VBXSIM_DMA_QUEUE_DEPTH   4   ///< DMA transfers dispatched but not yet complete
+#endif
+#ifndef VBXSIM_DMA_LATENCY_NS
+#define VBXSIM_DMA_LATENCY_NS    100 ///< external memory latency of a DMA transfer
+#endif
+#ifndef VBXSIM_DMA_ROW_CYCLES
+#define VBXSIM_DMA_ROW_CYCLES    2   ///< extra cycles for each additional row of a 2D DMA
+#endif
+
+#define VBXSIM_HISTORY 32 ///< recent instructions and DMAs checked for hazards (power of 2)
+#define VBXSIM_FENCES  64 ///< recent fences whose completion times are kept (power of 2)
+
+/** A vector instruction or DMA transfer in flight */
+typedef struct {
+	vbxsim_range_t wr;     ///< scratchpad bytes written
+	vbxsim_range_t rd[2];  ///< scratchpad bytes read
+	int            nrd;
+	uint64_t       start;  ///< first wave or beat
+	uint64_t       end;    ///< last wave or beat
+	uint64_t       done;   ///< last result written
+} vbxsim_cmd_t;
+
+static struct {
+	uint64_t     epoch;        ///< time of the last counter reset
+	uint64_t     host;         ///< host issue time
+	uint64_t     dispatch;     ///< dispatch time of the last command
+	uint64_t     vec_free;     ///< vector pipeline ready for the next wave
+	uint64_t     vec_done;     ///< all vector results written
+	uint64_t     dma_free;     ///< DMA engine idle
+
+	uint64_t     queue[VBXSIM_INSTR_QUEUE_DEPTH]; ///< dispatch times of recent commands
+	unsigned     nqueue;
+
+	vbxsim_cmd_t instr[VBXSIM_HISTORY];
+	vbxsim_cmd_t dma[VBXSIM_HISTORY];
+	unsigned     ninstr;
+	unsigned     ndma;
+
+	uint64_t     fence[VBXSIM_FENCES]; ///< completion times of recent fences
+	vbx_fence_t  nfence;
+
+	uint64_t     instr_hazard_cycles;
+	uint64_t     dma_hazard_cycles;
+	uint64_t     dma_queue_stall_cycles;
+	uint64_t     dma_busy_cycles;
+} timing;
+
+static inline uint64_t max64( uint64_t a, uint64_t b )
+{
+	return a > b ? a : b;
+}
+
+static inline int overlaps( const vbxsim_range_t *a, const vbxsim_range_t *b )
+{
+	return a->lo < b->hi && b->lo < a->hi;
+}
+
+static int reads( const vbxsim_cmd_t *c, const vbxsim_range_t *r )
+{
+	int i;
+	for( i = 0; i < c->nrd; i++ )
+		if( overlaps( &c->rd[i], r ) )
+			return 1;
+	return 0;
+}
+
+// Host issue: the host blocks while the instruction queue is full
+static void issue()
+{
+	const unsigned slot = timing.nqueue % VBXSIM_INSTR_QUEUE_DEPTH;
+	timing.host += VBXSIM_ISSUE_CYCLES;
+	if( timing.nqueue >= VBXSIM_INSTR_QUEUE_DEPTH )
+		timing.host = max64( timing.host, timing.queue[slot] );
+}
+
+static void dispatched( uint64_t t )
+{
+	timing.queue[timing.nqueue % VBXSIM_INSTR_QUEUE_DEPTH] = t;
+	timing.nqueue++;
+	timing.dispatch = t;
+}
+
+// --------------------------------------------------------
+
+void vbxsim_timing_reset()
+{
+	timing.epoch = max64( timing.host, max64( timing.vec_done, timing.dma_free ) );
+	timing.instr_hazard_cycles    = 0;
+	timing.dma_hazard_cycles      = 0;
+	timing.dma_queue_stall_cycles = 0;
+	timing.dma_busy_cycles        = 0;
+}
+
+void vbxsim_timing_setup()
+{
+	issue();
+	dispatched( max64( timing.host, timing.dispatch ) );
+}
+
+void vbxsim_timing_instr( const vbxsim_range_t *wr, const vbxsim_range_t *rd, int nrd,
+                          uint64_t waves, int latency )
+{
+	vbxsim_cmd_t *c = &timing.instr[timing.ninstr % VBXSIM_HISTORY];
+	uint64_t t, need;
+	unsigned i, n;
+	int k;
+
+	issue();
+	t = max64( max64( timing.host, timing.dispatch ), timing.vec_free );
+
+	// A source written by a recent instruction is read in the same order it
+	// is written, so only its first results need to be out of the pipeline.
+	need = t;
+	n = timing.ninstr < VBXSIM_HISTORY ? timing.ninstr : VBXSIM_HISTORY;
+	for( i = 1; i <= n; i++ ) {
+		const vbxsim_cmd_t *p = &timing.instr[(timing.ninstr - i) % VBXSIM_HISTORY];
+		if( p->done <= t )
+			continue;
+		for( k = 0; k < nrd; k++ ) {
+			if( overlaps( &p->wr, &rd[k] ) )
+				need = max64( need, p->start + VBXSIM_PIPELINE_CYCLES );
+		}
+	}
+	timing.instr_hazard_cycles += need - t;
+	t = need;
+
+	// Scratchpad data being written by DMA, or still to be read by a DMA to the host
+	n = timing.ndma < VBXSIM_HISTORY ? timing.ndma : VBXSIM_HISTORY;
+	for( i = 1; i <= n; i++ ) {
+		const vbxsim_cmd_t *p = &timing.dma[(timing.ndma - i) % VBXSIM_HISTORY];
+		if( p->done <= t )
+			continue;
+		for( k = 0; k < nrd; k++ ) {
+			if( overlaps( &p->wr, &rd[k] ) )
+				need = max64( need, p->done );
+		}
+		if( overlaps( &p->wr, wr ) || reads( p, wr ) )
+			need = max64( need, p->done );
+	}
+	timing.dma_hazard_cycles += need - t;
+	t = need;
+
+	c->wr    = *wr;
+	c->nrd   = nrd;
+	for( k = 0; k < nrd; k++ )
+		c->rd[k] = rd[k];
+	c->start = t;
+	c->end   = t + waves;
+	c->done  = c->end + VBXSIM_PIPELINE_CYCLES + latency;
+	timing.ninstr++;
+
+	timing.vec_free = c->end;
+	timing.vec_done = max64( timing.vec_done, c->done );
+	dispatched( t );
+}
+
+void vbxsim_timing_dma( int to_host, const vbxsim_range_t *sp, const void *host,
+                        uint32_t row_bytes, uint32_t rows, int32_t host_stride )
+{
+	const vbx_mxp_t *this_mxp = &vbxsim.mxp;
+	const uint32_t width = this_mxp->dma_alignment_bytes;
+	vbxsim_cmd_t *c = &timing.dma[timing.ndma % VBXSIM_HISTORY];
+	uint64_t t, need, beats = 0;
+	unsigned i, n;
+	uint32_t y;
+
+	issue();
+	t = max64( timing.host, timing.dispatch );
+
+	// wait for a free slot in the DMA queue
+	if( timing.ndma >= VBXSIM_DMA_QUEUE_DEPTH ) {
+		const vbxsim_cmd_t *p = &timing.dma[(timing.ndma - VBXSIM_DMA_QUEUE_DEPTH) % VBXSIM_HISTORY];
+		if( p->done > t ) {
+			timing.dma_queue_stall_cycles += p->done - t;
+			t = p->done;
+		}
+	}
+	dispatched( t );
+
+	// The DMA engine waits for instructions still using the scratchpad data
+	need = max64( t, timing.dma_free );
+	t = need;
+	n = timing.ninstr < VBXSIM_HISTORY ? timing.ninstr : VBXSIM_HISTORY;
+	for( i = 1; i <= n; i++ ) {
+		const vbxsim_cmd_t *p = &timing.instr[(timing.ninstr - i) % VBXSIM_HISTORY];
+		if( p->done <= t )
+			continue;
+		if( overlaps( &p->wr, sp ) )
+			need = max64( need, p->done );
+		else if( !to_host && reads( p, sp ) )
+			need = max64( need, p->end );
+	}
+	timing.dma_hazard_cycles += need - t;
+	t = need;
+
+	// Each row moves whole memory words; a row that starts part way into a
+	// word takes one more beat.
+	for( y = 0; y < rows; y++ ) {
+		const uint32_t off = (uint32_t)((uintptr_t)host + y*host_stride) % width;
+		beats += (off + row_bytes + width-1) / width;
+	}
+
+	c->wr    = to_host ? (vbxsim_range_t){ NULL, NULL } : *sp;
+	c->rd[0] = to_host ? *sp : (vbxsim_range_t){ NULL, NULL };
+	c->nrd   = to_host;
+	c->start = t;
+	c->end   = t + (uint64_t)VBXSIM_DMA_LATENCY_NS * this_mxp->core_freq / 1000000000u +
+	           beats + (uint64_t)(rows-1) * VBXSIM_DMA_ROW_CYCLES;
+	c->done  = c->end;
+	timing.ndma++;
+
+	timing.dma_busy_cycles += c->end - c->start;
+	timing.dma_free = c->done;
+}
+
+void vbxsim_timing_sync()
+{
+	timing.host = max64( timing.host, max64( timing.vec_done, timing.dma_free ) );
+}
+
+// A fence is one command. It completes when everything issued before it
+// has; a fence older than the ones kept completed before them.
+static uint64_t fence_time( vbx_fence_t fence )
+{
+	if( timing.nfence - fence >= VBXSIM_FENCES )
+		fence = timing.nfence - (VBXSIM_FENCES-1);
+	return timing.fence[fence % VBXSIM_FENCES];
+}
+
+vbx_fence_t vbxsim_timing_fence()
+{
+	issue();
+	dispatched( max64( timing.host, timing.dispatch ) );
+	timing.nfence++;
+	timing.fence[timing.nfence % VBXSIM_FENCES] =
+		max64( timing.dispatch, max64( timing.vec_done, timing.dma_free ) );
+	return timing.nfence;
+}
+
+int vbxsim_timing_fence_done( vbx_fence_t fence )
+{
+	if( fence_time( fence ) <= timing.host )
+		return 1;
+	// polling takes host time, so a loop waiting for the fence makes progress
+	timing.host += VBXSIM_ISSUE_CYCLES;
+	return 0;
+}
+
+void vbxsim_timing_fence_wait( vbx_fence_t fence )
+{
+	timing.host = max64( timing.host, fence_time( fence ) );
+}
+
+uint64_t vbxsim_timing_host()
+{
+	return timing.host;
+}
+
+uint64_t vbxsim_timing_dma_busy()
+{
+	return timing.dma_busy_cycles;
+}
+
+// --------------------------------------------------------
+// Counters
+
+unsigned vbxsim_get_total_cycles()
+{
+	return (unsigned)(max64( timing.host, max64( timing.vec_done, timing.dma_free ) ) - timing.epoch);
+}
+
+unsigned vbxsim_get_instr_hazard_cycles()
+{
+	return (unsigned)timing.instr_hazard_cycles;
+}
+
+unsigned vbxsim_get_dma_hazard_cycles()
+{
+	return (unsigned)timing.dma_hazard_cycles;
+}
+
+unsigned vbxsim_get_dma_queue_stall_cycles()
+{
+	return (unsigned)timing.dma_queue_stall_cycles;
+}
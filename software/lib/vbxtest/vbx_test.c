@@ -40,6 +40,7 @@
 VBXCOPYRIGHT( vbx_test )
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
 
 #include "vbx_test.h"
@@ -192,6 +193,85 @@ double vbx_print_vector_time(vbx_timestamp_t time_start,
 	                                 scalar_time);
 }
 
+///////////////////////////////////////////////////////////////////////////
+static int vbx_bench_warmup = VBX_BENCH_WARMUP;
+static int vbx_bench_reps   = VBX_BENCH_REPS;
+
+void vbx_bench_set_reps( int warmup, int reps )
+{
+	vbx_bench_warmup = warmup < 0 ? 0 : warmup;
+	vbx_bench_reps   = reps < 1 ? 1 : reps > VBX_BENCH_MAX_REPS ? VBX_BENCH_MAX_REPS : reps;
+}
+
+void vbx_bench_begin( vbx_bench_t *bench, const char *name )
+{
+	bench->name   = name;
+	bench->warmup = vbx_bench_warmup;
+	bench->reps   = vbx_bench_reps;
+	bench->runs   = 0;
+}
+
+int vbx_bench_runs( const vbx_bench_t *bench )
+{
+	return bench->warmup + bench->reps;
+}
+
+void vbx_bench_record( vbx_bench_t *bench, vbx_timestamp_t time_start, vbx_timestamp_t time_stop )
+{
+	int i = bench->runs - bench->warmup;
+	if( i >= 0 && i < bench->reps ) {
+		// keep the samples sorted
+		for( ; i > 0 && bench->sample[i-1] > time_stop - time_start; i-- ) {
+			bench->sample[i] = bench->sample[i-1];
+		}
+		bench->sample[i] = time_stop - time_start;
+	}
+	bench->runs++;
+}
+
+double vbx_bench_end( vbx_bench_t *bench, double cycles_divisor, char *divisor_str, double scalar_time )
+{
+	int n = bench->runs - bench->warmup;
+	vbx_timestamp_t min, median, p95;
+	double seconds;
+
+	if( n > bench->reps ) {
+		n = bench->reps;
+	}
+	if( n <= 0 ) {
+		printf( "Error: no runs of %s were recorded.\n", bench->name );
+		return 0.0;
+	}
+
+	min    = bench->sample[0];
+	median = n % 2 ? bench->sample[n/2] : (bench->sample[n/2-1] + bench->sample[n/2]) / 2;
+	p95    = bench->sample[(95*n + 99)/100 - 1];
+	seconds = vbx_print_metrics( 0, median, cycles_divisor, divisor_str,
+	                             (char *)bench->name, scalar_time );
+	if( n > 1 ) {
+		printf( "%s time in cycles min/median/p95 of %d runs: %llu/%llu/%llu\n", bench->name, n,
+		        (unsigned long long) vbx_mxp_cycles(min),
+		        (unsigned long long) vbx_mxp_cycles(median),
+		        (unsigned long long) vbx_mxp_cycles(p95) );
+	}
+
+	printf( "{\"bench\": \"%s\", \"runs\": %d, \"warmup\": %d, "
+	        "\"min_cycles\": %llu, \"median_cycles\": %llu, \"p95_cycles\": %llu, \"seconds\": %g",
+	        bench->name, n, bench->warmup,
+	        (unsigned long long) vbx_mxp_cycles(min),
+	        (unsigned long long) vbx_mxp_cycles(median),
+	        (unsigned long long) vbx_mxp_cycles(p95),
+	        seconds );
+	if( cycles_divisor > 0.0 ) {
+		printf( ", \"cycles_per_%s\": %g", divisor_str, vbx_mxp_cycles(median)/cycles_divisor );
+	}
+	if( scalar_time > 0.0 && seconds > 0.0 ) {
+		printf( ", \"speedup\": %g", scalar_time/seconds );
+	}
+	printf( "}\n" );
+	return seconds;
+}
+
 ///////////////////////////////////////////////////////////////////////////
 int lfsr_32( int previous_value )
 {
@@ -853,11 +933,41 @@ int vbx_test_init()
 	return 0;
 }
 #elif VBX_SIMULATOR==1
+// The simulated configuration defaults to 4 lanes and 64kb of sp memory,
+// word,half,byte fraction bits 16,15,4 respectively. The host makefile
+// (bmark/common/Makefile.sim) overrides these from the selected BSP.
+#ifndef VBXSIM_VECTOR_LANES
+#define VBXSIM_VECTOR_LANES 4
+#endif
+#ifndef VBXSIM_SCRATCHPAD_KB
+#define VBXSIM_SCRATCHPAD_KB 64
+#endif
+#ifndef VBXSIM_FXP_WORD_FRAC_BITS
+#define VBXSIM_FXP_WORD_FRAC_BITS 16
+#endif
+#ifndef VBXSIM_FXP_HALF_FRAC_BITS
+#define VBXSIM_FXP_HALF_FRAC_BITS 15
+#endif
+#ifndef VBXSIM_FXP_BYTE_FRAC_BITS
+#define VBXSIM_FXP_BYTE_FRAC_BITS 4
+#endif
+
 int vbx_test_init()
 {
-	//initialize with 4 lanes, and 64kb of sp memory
-	//word,half,byte fraction bits 25,15,4 respectively
-	vbxsim_init(4,64,16,15,4);
+	char *reps   = getenv("VBX_BENCH_REPS");
+	char *warmup = getenv("VBX_BENCH_WARMUP");
+
+	vbxsim_init(VBXSIM_VECTOR_LANES,
+	            VBXSIM_SCRATCHPAD_KB,
+	            VBXSIM_FXP_WORD_FRAC_BITS,
+	            VBXSIM_FXP_HALF_FRAC_BITS,
+	            VBXSIM_FXP_BYTE_FRAC_BITS);
+
+	// the benchmark runs can be changed without rebuilding on the host
+	if (reps || warmup) {
+		vbx_bench_set_reps(warmup ? atoi(warmup) : VBX_BENCH_WARMUP,
+		                   reps ? atoi(reps) : VBX_BENCH_REPS);
+	}
 	return 0;
 }
 ///////////////////////////////////////////////////////////////////////////
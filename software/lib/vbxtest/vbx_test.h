@@ -71,6 +71,71 @@ double vbx_print_vector_time(vbx_timestamp_t time_start,
 							 vbx_timestamp_t time_stop,
 							 double scalar_time);
 
+/**
+ * @name Benchmark measurements
+ *
+ * A measurement times the same code over several runs. The first runs are
+ * warm-up runs and are discarded; the others are summarized as the min,
+ * median and 95th percentile time. vbx_bench_end() prints the summary as
+ * text and as one JSON line starting with {"bench": for scripts to parse.
+ *
+ *     vbx_bench_t bench;
+ *     vbx_bench_begin( &bench, "Vector" );
+ *     for( run = 0; run < vbx_bench_runs( &bench ); run++ ) {
+ *         time_start = vbx_timestamp();
+ *         ...code to time...
+ *         time_stop = vbx_timestamp();
+ *         vbx_bench_record( &bench, time_start, time_stop );
+ *     }
+ *     vector_time = vbx_bench_end( &bench, 0.0, "", scalar_time );
+ *
+ * The timed code must give the same result on every run.
+ * @{
+ */
+
+#define VBX_BENCH_MAX_REPS 64
+
+// Default number of runs recorded and warm-up runs discarded. The
+// simulator's modelled clock gives the same time on every run.
+#ifndef VBX_BENCH_REPS
+#if VBX_SIMULATOR
+#define VBX_BENCH_REPS   1
+#else
+#define VBX_BENCH_REPS   5
+#endif
+#endif
+#ifndef VBX_BENCH_WARMUP
+#if VBX_SIMULATOR
+#define VBX_BENCH_WARMUP 0
+#else
+#define VBX_BENCH_WARMUP 1
+#endif
+#endif
+
+typedef struct {
+	const char      *name;   ///< name of the measurement, eg. "Vector"; printed as is in the JSON line
+	int              warmup; ///< warm-up runs
+	int              reps;   ///< recorded runs
+	int              runs;   ///< runs so far
+	vbx_timestamp_t  sample[VBX_BENCH_MAX_REPS]; ///< recorded run times, in timestamp cycles
+} vbx_bench_t;
+
+/** Sets the number of warm-up and recorded runs of the measurements begun after it */
+void   vbx_bench_set_reps( int warmup, int reps );
+void   vbx_bench_begin( vbx_bench_t *bench, const char *name );
+/** Number of times to run the timed code, warm-up included */
+int    vbx_bench_runs( const vbx_bench_t *bench );
+void   vbx_bench_record( vbx_bench_t *bench, vbx_timestamp_t time_start, vbx_timestamp_t time_stop );
+/**
+ * Prints the summary of a measurement. Times per @a divisor_str are printed
+ * if @a cycles_divisor is non-zero, and the speedup if @a scalar_time is.
+ *
+ * @returns the median time in seconds
+ */
+double vbx_bench_end( vbx_bench_t *bench, double cycles_divisor, char *divisor_str, double scalar_time );
+
+/**@}*/
+
 int lfsr_32(int previous_value);
 
 void test_inc_array_byte( int8_t *d, int size, int seed, int increase );